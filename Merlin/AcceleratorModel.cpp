@@ -27,20 +27,6 @@ using namespace std;
 namespace
 {
 
-struct MatchName
-{
-	StringPattern pattern;
-	MatchName(const string& pat) :
-		pattern(pat)
-	{
-	}
-	bool operator()(const ComponentFrame* frm)
-	{
-		return pattern((*frm).GetComponent().GetQualifiedName());
-	}
-
-};
-
 struct ModelStats
 {
 	map<string, int>& s;
@@ -131,33 +117,31 @@ AcceleratorModel::Beamline AcceleratorModel::GetBeamline(const string& pat1, con
 {
 	assert(n1 >= 1 && n2 >= 1);
 
-	StringPattern p1(pat1), p2(pat2);
-	BeamlineIterator i1 = lattice.end();
-	BeamlineIterator i2 = lattice.end();
-	int nn1(0), nn2(0);
-	int ni = 0, ni1 = 0, ni2 = 0; // initialise to please gcc. Paths where they don't get set result in throw.
+	vector<Index> match1, match2;
+	GetIndex().FindFrames(StringPattern(pat1), false, match1);
+	GetIndex().FindFrames(StringPattern(pat2), false, match2);
 
-	for(BeamlineIterator i = lattice.begin(); i != lattice.end() && (nn1 != n1 || nn2 != n2); i++, ni++)
+	if(match1.size() < size_t(n1))
 	{
-		string id = (*i)->IsComponent() ? ((*i)->GetComponent()).GetQualifiedName() : (*i)->GetQualifiedName();
-		if(nn1 < n1 && p1(id) && ++nn1 == n1)
+		throw BadRange();
+	}
+	Index ni1 = match1[n1 - 1];
+
+	// Frames before the end frame that match both patterns count as
+	// occurrences of pat1 only.
+	int nn2 = 0;
+	for(vector<Index>::iterator i = match2.begin(); i != match2.end(); i++)
+	{
+		if(*i <= ni1 && binary_search(match1.begin(), match1.end(), *i))
 		{
-			i1 = i;
-			ni1 = ni;
+			continue;
 		}
-		else if(nn2 < n2 && p2(id) && ++nn2 == n2)
+		if(++nn2 == n2)
 		{
-			i2 = i;
-			ni2 = ni;
+			return Beamline(lattice.begin() + ni1, lattice.begin() + *i, ni1, *i);
 		}
 	}
-
-	if(i1 == lattice.end() || i2 == lattice.end())
-	{
-		throw BadRange();
-	}
-
-	return Beamline(i1, i2, ni1, ni2);
+	throw BadRange();
 }
 
 AcceleratorModel::RingIterator AcceleratorModel::GetRing(int n)
@@ -183,13 +167,11 @@ int AcceleratorModel::ExtractComponents(const string& pat, vector<ComponentFrame
 	}
 	else
 	{
-		MatchName mname(pat);
-		for(BeamlineIterator bi = lattice.begin(); bi != lattice.end(); bi++)
+		vector<Index> indexes;
+		GetIndex().FindFrames(StringPattern(pat), true, indexes);
+		for(vector<Index>::iterator i = indexes.begin(); i != indexes.end(); i++)
 		{
-			if(mname(*bi))
-			{
-				results.push_back(*bi);
-			}
+			results.push_back(lattice[*i]);
 		}
 	}
 	frames.swap(results);
@@ -228,6 +210,7 @@ void AcceleratorModel::AddModelElement(ModelElement* element)
 	if(element != nullptr)
 	{
 		theElements->Add(element);
+		InvalidateIndex();
 	}
 }
 
@@ -302,6 +285,7 @@ void AcceleratorModel::InstallModelElement(AcceleratorComponent* element, double
 	theElements->Add(c_drift1);
 	theElements->Add(c_drift2);
 	theElements->Add(c_element);
+	InvalidateIndex();
 }
 
 void AcceleratorModel::ReportModelStatistics(std::ostream& os) const
@@ -343,20 +327,14 @@ size_t AcceleratorModel::GetIndexes(const AcceleratorModel::Beamline& bline, con
 	std::vector<AcceleratorModel::Index>& iarray) const
 {
 	vector<Index> iarray1;
-	StringPattern pattern(pat);
+	GetIndex().FindFrames(StringPattern(pat), true, iarray1);
 
+	// restrict to the beamline
 	Index n0 = distance(lattice.begin(), bline.begin());
-	for(ConstBeamlineIterator fi = bline.begin(); fi != bline.end(); fi++, n0++)
-	{
-		if((*fi)->IsComponent())
-		{
-			string id = (*(*fi)).GetComponent().GetQualifiedName();
-			if(pattern(id))
-			{
-				iarray1.push_back(n0);
-			}
-		}
-	}
+	Index n1 = distance(lattice.begin(), bline.end());
+	iarray1.erase(iarray1.begin(), lower_bound(iarray1.begin(), iarray1.end(), n0));
+	iarray1.erase(lower_bound(iarray1.begin(), iarray1.end(), n1), iarray1.end());
+
 	iarray.swap(iarray1);
 	return iarray.size();
 }
@@ -368,31 +346,24 @@ size_t AcceleratorModel::GetAcceleratorSupports(AcceleratorSupportList& supports
 	return eas.nFound;
 }
 
-static bool SortComponent(const AcceleratorComponent* first, const AcceleratorComponent* last)
+int AcceleratorModel::FindElementLatticePosition(string RequestedElement)
 {
-	return first->GetComponentLatticePosition() < last->GetComponentLatticePosition();
+	int n = GetIndex().SortedPosition(RequestedElement);
+	return n < 0 ? 0 : n;
 }
 
-static vector<AcceleratorComponent*> SortAcceleratorModel(AcceleratorModel* model)
+void AcceleratorModel::InvalidateIndex()
 {
-	vector<AcceleratorComponent*> elements;
-
-	model->ExtractTypedElements(elements, "*");
-
-	sort(elements.begin(), elements.end(), SortComponent);
-	return elements;
+	std::lock_guard<std::mutex> guard(indexLock);
+	index.Clear();
 }
 
-int AcceleratorModel::FindElementLatticePosition(string RequestedElement)
+AcceleratorModelIndex& AcceleratorModel::GetIndex() const
 {
-	vector<AcceleratorComponent*> elements = SortAcceleratorModel(this);
-	size_t nelm = elements.size();
-	for(size_t n = 0; n < nelm; n++)
+	std::lock_guard<std::mutex> guard(indexLock);
+	if(!index.IsCurrent(lattice.size(), theElements->Size()))
 	{
-		if(elements[n]->GetName() == RequestedElement)
-		{
-			return n;
-		}
+		index.Build(lattice, *theElements);
 	}
-	return 0;
+	return index;
 }
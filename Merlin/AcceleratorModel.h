@@ -10,6 +10,7 @@
 
 #include "merlin_config.h"
 #include <algorithm>
+#include <mutex>
 #include <set>
 #include <vector>
 #include <string>
@@ -23,6 +24,7 @@
 #include "ring_iterator.h"
 #include "MerlinException.h"
 #include "AcceleratorSupport.h"
+#include "AcceleratorModelIndex.h"
 
 class ChannelServer;
 class ComponentFrame;
@@ -346,10 +348,14 @@ public:
 	{
 		typedef typename T::value_type value_type;
 		StringPattern p(pattern);
-		for(ElementRepository::iterator i = theElements->begin(); i != theElements->end(); i++)
+		AcceleratorModelIndex& idx = GetIndex();
+		const vector<ModelElement*>& candidates = p.IsLiteral() ? idx.ElementsNamed(pattern)
+			: idx.TypedElements<value_type>(*theElements);
+		const bool all = pattern == "*";
+		for(vector<ModelElement*>::const_iterator i = candidates.begin(); i != candidates.end(); i++)
 		{
 			value_type mi = dynamic_cast<value_type>(*i);
-			if(mi && p(mi->GetName()))
+			if(mi && (all || p(mi->GetName())))
 			{
 				results.push_back(mi);
 			}
@@ -485,6 +491,14 @@ public:
 	 */
 	int FindElementLatticePosition(string RequestedElement);
 
+	/**
+	 * Discards the name and type index, so that it is rebuilt on
+	 * the next query. Adding components or elements does this
+	 * automatically, but it must be called after renaming or
+	 * moving existing elements.
+	 */
+	void InvalidateIndex();
+
 private:
 
 	FlatLattice lattice;
@@ -492,6 +506,15 @@ private:
 	ElementRepository* theElements;
 	ChannelServer* chServer;
 
+	/// Built on first use, see GetIndex()
+	mutable AcceleratorModelIndex index;
+
+	/// Serialises building the index, so that the model may be queried from several threads
+	mutable std::mutex indexLock;
+
+	/// The index, rebuilt if the model has changed size
+	AcceleratorModelIndex& GetIndex() const;
+
 	friend class AcceleratorModelConstructor;
 
 	//Disable copying
@@ -0,0 +1,111 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+
+#include "AcceleratorModelIndex.h"
+#include "AcceleratorComponent.h"
+#include "ComponentFrame.h"
+
+using namespace std;
+
+namespace
+{
+
+bool SortComponent(const AcceleratorComponent* first, const AcceleratorComponent* last)
+{
+	return first->GetComponentLatticePosition() < last->GetComponentLatticePosition();
+}
+
+} // end anonymous namespace
+
+AcceleratorModelIndex::AcceleratorModelIndex() :
+	built(false), nFrames(0), nElements(0)
+{
+}
+
+void AcceleratorModelIndex::Clear()
+{
+	built = false;
+	nFrames = nElements = 0;
+	frameNames.clear();
+	hasComponent.clear();
+	sortedPosition.clear();
+	byName.clear();
+	typed.clear();
+}
+
+void AcceleratorModelIndex::Build(const vector<ComponentFrame*>& lattice, const ElementRepository& elements)
+{
+	Clear();
+
+	frameNames.reserve(lattice.size());
+	hasComponent.resize(lattice.size());
+	for(Index n = 0; n < lattice.size(); n++)
+	{
+		const ComponentFrame* frame = lattice[n];
+		hasComponent[n] = frame->IsComponent();
+		frameNames.push_back(make_pair(hasComponent[n] ? frame->GetComponent().GetQualifiedName()
+			: frame->GetQualifiedName(), n));
+	}
+	sort(frameNames.begin(), frameNames.end());
+
+	vector<AcceleratorComponent*> components;
+	for(ElementRepository::const_iterator i = elements.begin(); i != elements.end(); i++)
+	{
+		byName[(*i)->GetName()].push_back(*i);
+		AcceleratorComponent* ac = dynamic_cast<AcceleratorComponent*>(*i);
+		if(ac)
+		{
+			components.push_back(ac);
+		}
+	}
+
+	stable_sort(components.begin(), components.end(), SortComponent);
+	for(size_t n = components.size(); n-- > 0;)
+	{
+		sortedPosition[components[n]->GetName()] = n;
+	}
+
+	nFrames = lattice.size();
+	nElements = elements.Size();
+	built = true;
+}
+
+void AcceleratorModelIndex::FindFrames(const StringPattern& pat, bool componentsOnly, vector<Index>& result) const
+{
+	result.clear();
+	const string prefix = pat.LiteralPrefix();
+	const bool literal = pat.IsLiteral();
+
+	auto first = lower_bound(frameNames.begin(), frameNames.end(), make_pair(prefix, Index(0)));
+	for(auto i = first; i != frameNames.end() && i->first.compare(0, prefix.size(), prefix) == 0; i++)
+	{
+		if(literal && i->first.size() != prefix.size())
+		{
+			break;
+		}
+		if((!componentsOnly || hasComponent[i->second]) && (literal || pat(i->first)))
+		{
+			result.push_back(i->second);
+		}
+	}
+	sort(result.begin(), result.end());
+}
+
+int AcceleratorModelIndex::SortedPosition(const string& name) const
+{
+	auto it = sortedPosition.find(name);
+	return it == sortedPosition.end() ? -1 : it->second;
+}
+
+const vector<ModelElement*>& AcceleratorModelIndex::ElementsNamed(const string& name) const
+{
+	static const vector<ModelElement*> none;
+	auto it = byName.find(name);
+	return it == byName.end() ? none : it->second;
+}
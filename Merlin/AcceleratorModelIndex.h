@@ -0,0 +1,137 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef AcceleratorModelIndex_h
+#define AcceleratorModelIndex_h 1
+
+#include "merlin_config.h"
+#include <map>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include "ElementRepository.h"
+#include "StringPattern.h"
+
+class ComponentFrame;
+
+/**
+ *	Lookup tables used by AcceleratorModel to answer name and
+ *	type queries without scanning the whole model.
+ *
+ *	Frame names are kept sorted, so a pattern with a literal
+ *	prefix (e.g. "Quadrupole.MQ*") only tests the names in the
+ *	matching range. Exact element names map directly to the
+ *	elements and to their position along the lattice, and the
+ *	elements that convert to a given type are cached the first
+ *	time that type is requested.
+ *
+ *	The index is built by AcceleratorModel when first needed, and
+ *	rebuilt when components or elements are added. Renaming or
+ *	moving existing elements requires
+ *	AcceleratorModel::InvalidateIndex().
+ */
+class AcceleratorModelIndex
+{
+public:
+	typedef size_t Index;
+
+	AcceleratorModelIndex();
+
+	/**
+	 *	Builds all tables from the flat lattice and the element
+	 *	repository.
+	 */
+	void Build(const std::vector<ComponentFrame*>& lattice, const ElementRepository& elements);
+
+	/**
+	 *	Discards all tables.
+	 */
+	void Clear();
+
+	/**
+	 *	True if the index was built for a model of this size.
+	 */
+	bool IsCurrent(size_t nframes, size_t nelements) const
+	{
+		return built && nframes == nFrames && nelements == nElements;
+	}
+
+	/**
+	 *	Returns in result, in beamline order, the lattice indices
+	 *	of frames whose qualified name matches pat. Component
+	 *	frames are named by their component. If componentsOnly
+	 *	is true, frames without a component are skipped.
+	 */
+	void FindFrames(const StringPattern& pat, bool componentsOnly, std::vector<Index>& result) const;
+
+	/**
+	 *	Returns the position of the first component called name
+	 *	in the list of all components sorted by lattice position,
+	 *	or -1 if there is no such component.
+	 */
+	int SortedPosition(const std::string& name) const;
+
+	/**
+	 *	Returns all elements with the (unqualified) name, in
+	 *	repository order.
+	 */
+	const std::vector<ModelElement*>& ElementsNamed(const std::string& name) const;
+
+	/**
+	 *	Returns, in repository order, the elements which can be
+	 *	converted to the pointer type P with dynamic_cast. The
+	 *	list for each type is found on first use, and may be
+	 *	requested from several threads.
+	 */
+	template<class P>
+	const std::vector<ModelElement*>& TypedElements(const ElementRepository& elements)
+	{
+		std::lock_guard<std::mutex> guard(typedLock);
+		std::type_index key(typeid(P));
+		auto it = typed.find(key);
+		if(it == typed.end())
+		{
+			std::vector<ModelElement*>& list = typed[key];
+			for(ElementRepository::const_iterator i = elements.begin(); i != elements.end(); i++)
+			{
+				if(dynamic_cast<P>(*i))
+				{
+					list.push_back(*i);
+				}
+			}
+			return list;
+		}
+		return it->second;
+	}
+
+private:
+	bool built;
+	size_t nFrames;
+	size_t nElements;
+
+	/// Qualified frame names and lattice indices, sorted by name
+	std::vector<std::pair<std::string, Index> > frameNames;
+
+	/// Set for lattice indices of frames holding a component
+	std::vector<bool> hasComponent;
+
+	/// Element name to position in the lattice position ordering
+	std::unordered_map<std::string, int> sortedPosition;
+
+	/// Element name to elements
+	std::unordered_map<std::string, std::vector<ModelElement*> > byName;
+
+	/// Elements convertible to each requested pointer type
+	std::map<std::type_index, std::vector<ModelElement*> > typed;
+	std::mutex typedLock;
+};
+
+#endif
@@ -0,0 +1,944 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <typeindex>
+#include <typeinfo>
+#include <vector>
+
+#ifndef _MSC_VER
+#include <unistd.h>
+#endif
+
+#include "AcceleratorModelSnapshot.h"
+#include "AcceleratorModel.h"
+#include "AcceleratorModelConstructor.h"
+#include "Aperture.h"
+#include "CollimatorAperture.h"
+#include "Components.h"
+#include "InterpolatedApertures.h"
+#include "MaterialDatabase.h"
+#include "MerlinException.h"
+#include "MerlinIO.h"
+#include "TComponentFrame.h"
+
+const uint32_t AcceleratorModelSnapshot::version = 1;
+
+namespace
+{
+
+const char magic[8] = {'M', 'E', 'R', 'L', 'I', 'N', 'M', 'S'};
+const uint32_t byte_order = 0x01020304;
+
+/// Limit on stored string and array lengths, to reject corrupt files early
+const uint32_t max_count = 1u << 28;
+
+enum ComponentTag
+{
+	tag_drift = 1,
+	tag_marker,
+	tag_quadrupole,
+	tag_skew_quadrupole,
+	tag_sextupole,
+	tag_skew_sextupole,
+	tag_octupole,
+	tag_decapole,
+	tag_xcor,
+	tag_ycor,
+	tag_sector_bend,
+	tag_solenoid,
+	tag_swrf,
+	tag_transverse_rf,
+	tag_crab_marker,
+	tag_collimator,
+	tag_bpm,
+	tag_rms_profile_monitor
+};
+
+enum ApertureTag
+{
+	ap_none = 0,
+	ap_circle,
+	ap_rectangle,
+	ap_ellipse,
+	ap_rect_ellipse,
+	ap_octagon,
+	ap_interpolated,
+	ap_collimator,
+	ap_unaligned_collimator,
+	ap_one_sided_collimator
+};
+
+enum PoleFaceMode
+{
+	pf_none = 0,
+	pf_shared,
+	pf_separate
+};
+
+class SnapshotWriter
+{
+public:
+	explicit SnapshotWriter(std::ostream& s) :
+		os(s)
+	{
+	}
+
+	template<class T>
+	void Put(T x)
+	{
+		os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+	}
+
+	void PutBytes(const char* data, size_t n)
+	{
+		os.write(data, n);
+	}
+
+	void PutString(const std::string& s)
+	{
+		Put<uint32_t>(s.size());
+		PutBytes(s.data(), s.size());
+	}
+
+private:
+	std::ostream& os;
+};
+
+class SnapshotReader
+{
+public:
+	explicit SnapshotReader(std::istream& s) :
+		is(s)
+	{
+	}
+
+	template<class T>
+	T Get()
+	{
+		T x;
+		if(!is.read(reinterpret_cast<char*>(&x), sizeof(T)))
+		{
+			throw MerlinException("AcceleratorModelSnapshot: file is truncated");
+		}
+		return x;
+	}
+
+	uint32_t GetCount()
+	{
+		uint32_t n = Get<uint32_t>();
+		if(n > max_count)
+		{
+			throw MerlinException("AcceleratorModelSnapshot: file is corrupt");
+		}
+		return n;
+	}
+
+	std::string GetString()
+	{
+		std::string s(GetCount(), '\0');
+		if(!s.empty() && !is.read(&s[0], s.size()))
+		{
+			throw MerlinException("AcceleratorModelSnapshot: file is truncated");
+		}
+		return s;
+	}
+
+private:
+	std::istream& is;
+};
+
+void PutField(SnapshotWriter& out, const MultipoleField& field)
+{
+	out.Put(field.GetFieldScale());
+	uint32_t n = field.HighestMultipole() + 1;
+	out.Put(n);
+	for(size_t i = 0; i < n; i++)
+	{
+		Complex b = field.GetCoefficient(i);
+		out.Put(b.real());
+		out.Put(b.imag());
+	}
+}
+
+void GetField(SnapshotReader& in, MultipoleField& field)
+{
+	field.SetFieldScale(in.Get<double>());
+	uint32_t n = in.GetCount();
+	for(size_t i = 0; i < n; i++)
+	{
+		double re = in.Get<double>();
+		double im = in.Get<double>();
+		field.SetCoefficient(i, Complex(re, im));
+	}
+}
+
+template<class T>
+T* GetMultipole(SnapshotReader& in, const std::string& name, double len)
+{
+	T* c = new T(name, len, 1.0);
+	GetField(in, c->GetField());
+	return c;
+}
+
+void PutAperture(SnapshotWriter& out, Aperture* ap, const std::string& owner)
+{
+	if(!ap)
+	{
+		out.Put<uint8_t>(ap_none);
+		return;
+	}
+
+	const std::type_info& t = typeid(*ap);
+	uint8_t tag = ap_none;
+	if(t == typeid(CircularAperture))
+	{
+		tag = ap_circle;
+	}
+	else if(t == typeid(RectangularAperture))
+	{
+		tag = ap_rectangle;
+	}
+	else if(t == typeid(EllipticalAperture))
+	{
+		tag = ap_ellipse;
+	}
+	else if(t == typeid(RectEllipseAperture))
+	{
+		tag = ap_rect_ellipse;
+	}
+	else if(t == typeid(OctagonalAperture))
+	{
+		tag = ap_octagon;
+	}
+
+	if(tag != ap_none)
+	{
+		out.Put(tag);
+		out.PutString(ap->getApertureType());
+		out.Put(ap->getSlongitudinal());
+		out.Put(ap->getRectHalfWidth());
+		out.Put(ap->getRectHalfHeight());
+		out.Put(ap->getEllipHalfWidth());
+		out.Put(ap->getEllipHalfHeight());
+		return;
+	}
+
+	if(t == typeid(InterpolatedRectEllipseAperture))
+	{
+		InterpolatedRectEllipseAperture* iap = static_cast<InterpolatedRectEllipseAperture*>(ap);
+		out.Put<uint8_t>(ap_interpolated);
+		out.PutString(ap->getApertureType());
+		out.Put(ap->getSlongitudinal());
+		out.Put<uint32_t>(iap->ElementApertures.size());
+		for(Aperture* sub : iap->ElementApertures)
+		{
+			PutAperture(out, sub, owner);
+		}
+		return;
+	}
+
+	if(t == typeid(CollimatorAperture) || t == typeid(UnalignedCollimatorAperture)
+		|| t == typeid(OneSidedUnalignedCollimatorAperture))
+	{
+		CollimatorAperture* cap = static_cast<CollimatorAperture*>(ap);
+		if(t == typeid(CollimatorAperture))
+		{
+			out.Put<uint8_t>(ap_collimator);
+		}
+		else if(t == typeid(UnalignedCollimatorAperture))
+		{
+			out.Put<uint8_t>(ap_unaligned_collimator);
+		}
+		else
+		{
+			out.Put<uint8_t>(ap_one_sided_collimator);
+			out.Put<uint8_t>(static_cast<OneSidedUnalignedCollimatorAperture*>(ap)->GetJawSide());
+		}
+		out.Put(cap->getSlongitudinal());
+		out.Put(cap->GetFullEntranceWidth());
+		out.Put(cap->GetFullEntranceHeight());
+		out.Put(cap->GetCollimatorTilt());
+		out.Put(cap->GetCollimatorLength());
+		out.Put(cap->GetEntranceXOffset());
+		out.Put(cap->GetEntranceYOffset());
+		out.Put(cap->GetFullExitWidth());
+		out.Put(cap->GetFullExitHeight());
+		out.Put(cap->GetExitXOffset());
+		out.Put(cap->GetExitYOffset());
+		return;
+	}
+
+	throw MerlinException("AcceleratorModelSnapshot: cannot store aperture of type " + ap->getType() + " on "
+			  + owner);
+}
+
+Aperture* GetAperture(SnapshotReader& in)
+{
+	uint8_t tag = in.Get<uint8_t>();
+	switch(tag)
+	{
+	case ap_none:
+		return nullptr;
+	case ap_circle:
+	case ap_rectangle:
+	case ap_ellipse:
+	case ap_rect_ellipse:
+	case ap_octagon:
+	{
+		std::string type = in.GetString();
+		double s = in.Get<double>();
+		double a[4];
+		for(double& x : a)
+		{
+			x = in.Get<double>();
+		}
+		switch(tag)
+		{
+		case ap_circle:
+			return CircularAperture::getInstance(type, s, a[0], a[1], a[2], a[3]);
+		case ap_rectangle:
+			return RectangularAperture::getInstance(type, s, a[0], a[1], a[2], a[3]);
+		case ap_ellipse:
+			return EllipticalAperture::getInstance(type, s, a[0], a[1], a[2], a[3]);
+		case ap_rect_ellipse:
+			return RectEllipseAperture::getInstance(type, s, a[0], a[1], a[2], a[3]);
+		default:
+			return OctagonalAperture::getInstance(type, s, a[0], a[1], a[2], a[3]);
+		}
+	}
+	case ap_interpolated:
+	{
+		std::string type = in.GetString();
+		double s = in.Get<double>();
+		std::vector<Aperture*> points(in.GetCount());
+		for(Aperture*& p : points)
+		{
+			p = GetAperture(in);
+		}
+		Aperture* ap = new InterpolatedRectEllipseAperture(points);
+		ap->setApertureType(type);
+		ap->setSlongitudinal(s);
+		return ap;
+	}
+	case ap_collimator:
+	case ap_unaligned_collimator:
+	case ap_one_sided_collimator:
+	{
+		bool side = tag == ap_one_sided_collimator ? in.Get<uint8_t>() : true;
+		double v[11];
+		for(double& x : v)
+		{
+			x = in.Get<double>();
+		}
+		CollimatorAperture* ap;
+		if(tag == ap_collimator)
+		{
+			ap = new CollimatorAperture(v[1], v[2], v[3], v[4], v[5], v[6]);
+		}
+		else if(tag == ap_unaligned_collimator)
+		{
+			ap = new UnalignedCollimatorAperture(v[1], v[2], v[3], v[4], v[5], v[6]);
+		}
+		else
+		{
+			ap = new OneSidedUnalignedCollimatorAperture(v[1], v[2], v[3], v[4], v[5], v[6], side);
+		}
+		ap->setSlongitudinal(v[0]);
+		ap->SetExitWidth(v[7]);
+		ap->SetExitHeight(v[8]);
+		ap->SetExitXOffset(v[9]);
+		ap->SetExitYOffset(v[10]);
+		return ap;
+	}
+	default:
+		throw MerlinException("AcceleratorModelSnapshot: file is corrupt");
+	}
+}
+
+uint8_t TagOf(const AcceleratorComponent& c)
+{
+	static const std::map<std::type_index, uint8_t> tags = {
+		{typeid(Drift), tag_drift},
+		{typeid(Marker), tag_marker},
+		{typeid(Quadrupole), tag_quadrupole},
+		{typeid(SkewQuadrupole), tag_skew_quadrupole},
+		{typeid(Sextupole), tag_sextupole},
+		{typeid(SkewSextupole), tag_skew_sextupole},
+		{typeid(Octupole), tag_octupole},
+		{typeid(Decapole), tag_decapole},
+		{typeid(XCor), tag_xcor},
+		{typeid(YCor), tag_ycor},
+		{typeid(SectorBend), tag_sector_bend},
+		{typeid(Solenoid), tag_solenoid},
+		{typeid(SWRFStructure), tag_swrf},
+		{typeid(TransverseRFStructure), tag_transverse_rf},
+		{typeid(CrabMarker), tag_crab_marker},
+		{typeid(Collimator), tag_collimator},
+		{typeid(BPM), tag_bpm},
+		{typeid(RMSProfileMonitor), tag_rms_profile_monitor}
+	};
+	auto it = tags.find(typeid(c));
+	if(it == tags.end())
+	{
+		throw MerlinException("AcceleratorModelSnapshot: cannot store component " + c.GetQualifiedName());
+	}
+	return it->second;
+}
+
+void PutComponent(SnapshotWriter& out, AcceleratorComponent& c)
+{
+	uint8_t tag = TagOf(c);
+	out.Put(tag);
+	out.PutString(c.GetName());
+	out.Put(c.GetLength());
+	out.Put(c.GetComponentLatticePosition());
+
+	switch(tag)
+	{
+	case tag_quadrupole:
+	case tag_skew_quadrupole:
+	case tag_sextupole:
+	case tag_skew_sextupole:
+	case tag_octupole:
+	case tag_decapole:
+	case tag_xcor:
+	case tag_ycor:
+		PutField(out, static_cast<RectMultipole&>(c).GetField());
+		break;
+	case tag_sector_bend:
+	{
+		SectorBend& bend = static_cast<SectorBend&>(c);
+		out.Put(bend.GetGeometry().GetCurvature());
+		out.Put(bend.GetGeometry().GetTilt());
+		PutField(out, bend.GetField());
+		const SectorBend::PoleFaceInfo& pf = bend.GetPoleFaceInfo();
+		if(!pf.entrance && !pf.exit)
+		{
+			out.Put<uint8_t>(pf_none);
+		}
+		else if(pf.entrance && pf.exit)
+		{
+			out.Put<uint8_t>(pf.entrance == pf.exit ? pf_shared : pf_separate);
+			for(const SectorBend::PoleFace* face : {pf.entrance, pf.exit})
+			{
+				out.Put(face->rot);
+				out.Put(face->fint);
+				out.Put(face->hgap);
+			}
+		}
+		else
+		{
+			throw MerlinException("AcceleratorModelSnapshot: " + c.GetQualifiedName()
+					  + " has only one pole face");
+		}
+		break;
+	}
+	case tag_solenoid:
+		out.Put(static_cast<Solenoid&>(c).GetBz());
+		break;
+	case tag_swrf:
+	{
+		SWRFStructure& rf = static_cast<SWRFStructure&>(c);
+		// the length is not stored separately, it must be a whole number of half wavelengths
+		double halfWavelength = rf.GetWavelength() / 2;
+		long ncells = std::lround(rf.GetLength() / halfWavelength);
+		if(ncells < 1 || std::fabs(ncells * halfWavelength - rf.GetLength()) > 1e-9 * rf.GetLength())
+		{
+			throw MerlinException("AcceleratorModelSnapshot: length of " + c.GetQualifiedName()
+					  + " is not a whole number of cells");
+		}
+		out.Put<int32_t>(ncells);
+		out.Put(rf.GetFrequency());
+		out.Put(rf.GetAmplitude());
+		out.Put(rf.GetPhase());
+		break;
+	}
+	case tag_transverse_rf:
+	{
+		TransverseRFStructure& rf = static_cast<TransverseRFStructure&>(c);
+		out.Put(rf.GetFrequency());
+		out.Put(rf.GetAmplitude());
+		out.Put(rf.GetPhase());
+		out.Put(rf.GetFieldOrientation());
+		break;
+	}
+	case tag_crab_marker:
+	{
+		CrabMarker& crab = static_cast<CrabMarker&>(c);
+		out.Put(crab.GetMuX());
+		out.Put(crab.GetMuY());
+		break;
+	}
+	case tag_collimator:
+	{
+		Collimator& coll = static_cast<Collimator&>(c);
+		out.Put(coll.GetMaterialRadiationLength());
+		out.Put<int32_t>(coll.GetCollID());
+		out.PutString(coll.GetMaterial() ? coll.GetMaterial()->GetSymbol() : std::string());
+		break;
+	}
+	case tag_bpm:
+	{
+		BPM& bpm = static_cast<BPM&>(c);
+		out.Put(bpm.GetMeasurementPt());
+		out.Put<uint8_t>(bpm.IsActive());
+		break;
+	}
+	case tag_rms_profile_monitor:
+	{
+		RMSProfileMonitor& mon = static_cast<RMSProfileMonitor&>(c);
+		out.Put(mon.GetMeasurementPt());
+		out.Put<uint8_t>(mon.IsActive());
+		double rx, ry, ru;
+		mon.GetResolution(rx, ry, ru);
+		out.Put(mon.GetUAngle());
+		out.Put(rx);
+		out.Put(ry);
+		out.Put(ru);
+		break;
+	}
+	default:
+		break;
+	}
+
+	PutAperture(out, c.GetAperture(), c.GetQualifiedName());
+}
+
+AcceleratorComponent* GetComponent(SnapshotReader& in, uint8_t tag, MaterialDatabase* materials)
+{
+	std::string name = in.GetString();
+	double len = in.Get<double>();
+	double pos = in.Get<double>();
+
+	std::unique_ptr<AcceleratorComponent> c;
+	switch(tag)
+	{
+	case tag_drift:
+		c.reset(new Drift(name, len));
+		break;
+	case tag_marker:
+		c.reset(new Marker(name));
+		break;
+	case tag_quadrupole:
+		c.reset(GetMultipole<Quadrupole>(in, name, len));
+		break;
+	case tag_skew_quadrupole:
+		c.reset(GetMultipole<SkewQuadrupole>(in, name, len));
+		break;
+	case tag_sextupole:
+		c.reset(GetMultipole<Sextupole>(in, name, len));
+		break;
+	case tag_skew_sextupole:
+		c.reset(GetMultipole<SkewSextupole>(in, name, len));
+		break;
+	case tag_octupole:
+		c.reset(GetMultipole<Octupole>(in, name, len));
+		break;
+	case tag_decapole:
+		c.reset(GetMultipole<Decapole>(in, name, len));
+		break;
+	case tag_xcor:
+		c.reset(GetMultipole<XCor>(in, name, len));
+		break;
+	case tag_ycor:
+		c.reset(GetMultipole<YCor>(in, name, len));
+		break;
+	case tag_sector_bend:
+	{
+		double h = in.Get<double>();
+		double tilt = in.Get<double>();
+		SectorBend* bend = new SectorBend(name, len, h, 0.0);
+		c.reset(bend);
+		bend->GetGeometry().SetTilt(tilt);
+		GetField(in, bend->GetField());
+		uint8_t mode = in.Get<uint8_t>();
+		if(mode == pf_shared || mode == pf_separate)
+		{
+			SectorBend::PoleFace* faces[2];
+			for(SectorBend::PoleFace*& face : faces)
+			{
+				double rot = in.Get<double>();
+				double fint = in.Get<double>();
+				double hgap = in.Get<double>();
+				face = new SectorBend::PoleFace(rot, fint, hgap);
+			}
+			if(mode == pf_shared)
+			{
+				delete faces[1];
+				bend->SetPoleFaceInfo(faces[0]);
+			}
+			else
+			{
+				bend->SetPoleFaceInfo(faces[0], faces[1]);
+			}
+		}
+		else if(mode != pf_none)
+		{
+			throw MerlinException("AcceleratorModelSnapshot: file is corrupt");
+		}
+		break;
+	}
+	case tag_solenoid:
+		c.reset(new Solenoid(name, len, in.Get<double>()));
+		break;
+	case tag_swrf:
+	{
+		int32_t ncells = in.Get<int32_t>();
+		double f = in.Get<double>();
+		double e0 = in.Get<double>();
+		double phi = in.Get<double>();
+		c.reset(new SWRFStructure(name, ncells, f, e0, phi));
+		break;
+	}
+	case tag_transverse_rf:
+	{
+		double f = in.Get<double>();
+		double epk = in.Get<double>();
+		double phi = in.Get<double>();
+		double theta = in.Get<double>();
+		c.reset(new TransverseRFStructure(name, len, f, epk, phi, theta));
+		break;
+	}
+	case tag_crab_marker:
+	{
+		double mux = in.Get<double>();
+		double muy = in.Get<double>();
+		c.reset(new CrabMarker(name, len, mux, muy));
+		break;
+	}
+	case tag_collimator:
+	{
+		double xr = in.Get<double>();
+		int32_t id = in.Get<int32_t>();
+		std::string symbol = in.GetString();
+		Collimator* coll = new Collimator(name, len, xr);
+		c.reset(coll);
+		coll->SetCollID(id);
+		if(!symbol.empty())
+		{
+			if(!materials || !materials->db.count(symbol))
+			{
+				throw MerlinException("AcceleratorModelSnapshot: material " + symbol + " of collimator " + name
+						  + " not found");
+			}
+			coll->SetMaterial(materials->db[symbol]);
+		}
+		break;
+	}
+	case tag_bpm:
+	{
+		double mpt = in.Get<double>();
+		BPM* bpm = new BPM(name, len, mpt);
+		c.reset(bpm);
+		bpm->SetActive(in.Get<uint8_t>());
+		break;
+	}
+	case tag_rms_profile_monitor:
+	{
+		double mpt = in.Get<double>();
+		bool active = in.Get<uint8_t>();
+		double uangle = in.Get<double>();
+		RMSProfileMonitor* mon = new RMSProfileMonitor(name, uangle, len, mpt);
+		c.reset(mon);
+		mon->SetActive(active);
+		double rx = in.Get<double>();
+		double ry = in.Get<double>();
+		double ru = in.Get<double>();
+		mon->SetResolution(rx, ry, ru);
+		break;
+	}
+	default:
+		throw MerlinException("AcceleratorModelSnapshot: file is corrupt");
+	}
+
+	c->SetComponentLatticePosition(pos);
+	c->SetAperture(GetAperture(in));
+	return c.release();
+}
+
+template<class T>
+void AppendAs(AcceleratorModelConstructor& ctor, AcceleratorComponent* c, bool generic)
+{
+	if(generic)
+	{
+		ctor.AppendComponent(*c);
+	}
+	else
+	{
+		ctor.AppendComponent(static_cast<T&>(*c));
+	}
+}
+
+/// Appends c in a frame of the type the model constructor gives it
+void AppendFrame(AcceleratorModelConstructor& ctor, uint8_t tag, AcceleratorComponent* c, bool generic)
+{
+	switch(tag)
+	{
+	case tag_drift:
+		AppendAs<Drift>(ctor, c, generic);
+		break;
+	case tag_marker:
+		AppendAs<Marker>(ctor, c, generic);
+		break;
+	case tag_quadrupole:
+		AppendAs<Quadrupole>(ctor, c, generic);
+		break;
+	case tag_skew_quadrupole:
+		AppendAs<SkewQuadrupole>(ctor, c, generic);
+		break;
+	case tag_sextupole:
+		AppendAs<Sextupole>(ctor, c, generic);
+		break;
+	case tag_skew_sextupole:
+		AppendAs<SkewSextupole>(ctor, c, generic);
+		break;
+	case tag_octupole:
+		AppendAs<Octupole>(ctor, c, generic);
+		break;
+	case tag_decapole:
+		AppendAs<Decapole>(ctor, c, generic);
+		break;
+	case tag_xcor:
+		AppendAs<XCor>(ctor, c, generic);
+		break;
+	case tag_ycor:
+		AppendAs<YCor>(ctor, c, generic);
+		break;
+	case tag_sector_bend:
+		AppendAs<SectorBend>(ctor, c, generic);
+		break;
+	case tag_solenoid:
+		AppendAs<Solenoid>(ctor, c, generic);
+		break;
+	case tag_swrf:
+		AppendAs<SWRFStructure>(ctor, c, generic);
+		break;
+	case tag_transverse_rf:
+		AppendAs<TransverseRFStructure>(ctor, c, generic);
+		break;
+	case tag_crab_marker:
+		AppendAs<CrabMarker>(ctor, c, generic);
+		break;
+	case tag_collimator:
+		AppendAs<Collimator>(ctor, c, generic);
+		break;
+	case tag_bpm:
+		AppendAs<BPM>(ctor, c, generic);
+		break;
+	default:
+		AppendAs<RMSProfileMonitor>(ctor, c, generic);
+		break;
+	}
+}
+
+} // end of anonymous namespace
+
+ModelSnapshotKey::ModelSnapshotKey() :
+	hash(14695981039346656037ULL)
+{
+}
+
+void ModelSnapshotKey::AddBytes(const char* data, size_t n)
+{
+	// 64 bit FNV-1a
+	for(size_t i = 0; i < n; i++)
+	{
+		hash ^= static_cast<unsigned char>(data[i]);
+		hash *= 1099511628211ULL;
+	}
+}
+
+void ModelSnapshotKey::AddFile(const std::string& filename)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if(!file)
+	{
+		throw MerlinException("ModelSnapshotKey: cannot read " + filename);
+	}
+	Add(filename);
+	char buffer[1 << 16];
+	while(file.read(buffer, sizeof(buffer)) || file.gcount() > 0)
+	{
+		AddBytes(buffer, file.gcount());
+	}
+}
+
+void ModelSnapshotKey::Add(const std::string& s)
+{
+	uint64_t n = s.size();
+	AddBytes(reinterpret_cast<const char*>(&n), sizeof(n));
+	AddBytes(s.data(), s.size());
+}
+
+void ModelSnapshotKey::Add(double x)
+{
+	AddBytes(reinterpret_cast<const char*>(&x), sizeof(x));
+}
+
+void AcceleratorModelSnapshot::Write(AcceleratorModel* model, const std::string& filename, uint64_t key)
+{
+	std::ostringstream buffer;
+	SnapshotWriter out(buffer);
+	out.PutBytes(magic, sizeof(magic));
+	out.Put(version);
+	out.Put(byte_order);
+	out.Put(key);
+
+	// each component is stored once, and frames refer to it by number
+	std::map<AcceleratorComponent*, uint32_t> numbers;
+	std::vector<AcceleratorComponent*> components;
+	std::vector<std::pair<uint32_t, uint8_t> > frames;
+	AcceleratorModel::Beamline bl = model->GetBeamline();
+	for(AcceleratorModel::BeamlineIterator i = bl.begin(); i != bl.end(); i++)
+	{
+		ComponentFrame* frame = *i;
+		if(!frame->IsComponent())
+		{
+			throw MerlinException("AcceleratorModelSnapshot: cannot store frame " + frame->GetQualifiedName());
+		}
+		if(!frame->GetLocalFrameTransform().isIdentity())
+		{
+			throw MerlinException("AcceleratorModelSnapshot: cannot store misaligned frame "
+					  + frame->GetQualifiedName());
+		}
+		AcceleratorComponent* c = &frame->GetComponent();
+		auto n = numbers.insert(std::make_pair(c, components.size()));
+		if(n.second)
+		{
+			components.push_back(c);
+		}
+		bool generic = typeid(*frame) == typeid(TComponentFrame<AcceleratorComponent>);
+		frames.push_back(std::make_pair(n.first->second, generic));
+	}
+
+	out.Put<uint32_t>(components.size());
+	for(AcceleratorComponent* c : components)
+	{
+		PutComponent(out, *c);
+	}
+	out.Put<uint32_t>(frames.size());
+	for(const auto& f : frames)
+	{
+		out.Put(f.first);
+		out.Put(f.second);
+	}
+
+	// write under a temporary name so readers never see a partial file
+	std::ostringstream tmpname;
+	tmpname << filename << ".tmp";
+#ifndef _MSC_VER
+	tmpname << "." << getpid();
+#endif
+	{
+		std::ofstream file(tmpname.str(), std::ios::binary);
+		const std::string data = buffer.str();
+		if(!file || !file.write(data.data(), data.size()) || !file.flush())
+		{
+			std::remove(tmpname.str().c_str());
+			throw MerlinException("AcceleratorModelSnapshot: cannot write " + tmpname.str());
+		}
+	}
+	if(std::rename(tmpname.str().c_str(), filename.c_str()) != 0)
+	{
+		std::remove(tmpname.str().c_str());
+		throw MerlinException("AcceleratorModelSnapshot: cannot rename " + tmpname.str() + " to " + filename);
+	}
+}
+
+AcceleratorModel* AcceleratorModelSnapshot::Read(const std::string& filename, uint64_t key,
+	MaterialDatabase* materials)
+{
+	std::ifstream file(filename, std::ios::binary);
+	if(!file)
+	{
+		return nullptr;
+	}
+	SnapshotReader in(file);
+
+	char header[sizeof(magic)];
+	for(char& x : header)
+	{
+		x = in.Get<char>();
+	}
+	if(std::memcmp(header, magic, sizeof(magic)) != 0)
+	{
+		throw MerlinException("AcceleratorModelSnapshot: " + filename + " is not a model snapshot");
+	}
+	if(in.Get<uint32_t>() != version || in.Get<uint32_t>() != byte_order || in.Get<uint64_t>() != key)
+	{
+		return nullptr;
+	}
+
+	// components are owned here until they are in the model
+	std::vector<std::unique_ptr<AcceleratorComponent> > components(in.GetCount());
+	std::vector<uint8_t> tags(components.size());
+	for(size_t n = 0; n < components.size(); n++)
+	{
+		tags[n] = in.Get<uint8_t>();
+		components[n].reset(GetComponent(in, tags[n], materials));
+	}
+
+	std::vector<std::pair<uint32_t, bool> > frames(in.GetCount());
+	for(auto& f : frames)
+	{
+		f.first = in.Get<uint32_t>();
+		f.second = in.Get<uint8_t>();
+		if(f.first >= components.size())
+		{
+			throw MerlinException("AcceleratorModelSnapshot: file is corrupt");
+		}
+	}
+
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	for(const auto& f : frames)
+	{
+		AppendFrame(ctor, tags[f.first], components[f.first].get(), f.second);
+	}
+	// the model now owns every component that is in a frame
+	for(const auto& f : frames)
+	{
+		components[f.first].release();
+	}
+	return ctor.GetModel();
+}
+
+AcceleratorModel* AcceleratorModelSnapshot::Cached(const std::string& filename, uint64_t key,
+	const std::function<AcceleratorModel* ()>& build, MaterialDatabase* materials)
+{
+	AcceleratorModel* model = nullptr;
+	try
+	{
+		model = Read(filename, key, materials);
+	}
+	catch(MerlinException& error)
+	{
+		MerlinIO::warning() << error.Msg() << ", rebuilding the model" << std::endl;
+	}
+	if(model)
+	{
+		return model;
+	}
+
+	model = build();
+	try
+	{
+		Write(model, filename, key);
+	}
+	catch(MerlinException& error)
+	{
+		MerlinIO::warning() << error.Msg() << ", no snapshot written" << std::endl;
+	}
+	return model;
+}
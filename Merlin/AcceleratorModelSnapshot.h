@@ -0,0 +1,107 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef AcceleratorModelSnapshot_h
+#define AcceleratorModelSnapshot_h 1
+
+#include "merlin_config.h"
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class AcceleratorModel;
+class MaterialDatabase;
+
+/**
+ *	Key identifying the inputs a model was built from. Mixes
+ *	the contents of input files and any other parameters of the
+ *	construction (beam energy, settings) into a 64 bit hash, so
+ *	that a snapshot is only used when nothing has changed.
+ */
+class ModelSnapshotKey
+{
+public:
+	ModelSnapshotKey();
+
+	/**
+	 *	Mixes in the contents of the file. Throws MerlinException
+	 *	if the file cannot be read.
+	 */
+	void AddFile(const std::string& filename);
+
+	void Add(const std::string& s);
+	void Add(double x);
+
+	uint64_t Value() const
+	{
+		return hash;
+	}
+
+private:
+	void AddBytes(const char* data, size_t n);
+	uint64_t hash;
+};
+
+/**
+ *	Stores a constructed AcceleratorModel in a versioned binary
+ *	file, and restores it without the MAD, aperture or collimator
+ *	inputs.
+ *
+ *	The components (fields, geometry, pole faces, RF settings,
+ *	collimator material and ID), their apertures (including
+ *	interpolated and collimator jaw apertures) and the order of
+ *	the lattice are stored. Models with frames that are not
+ *	components, misaligned frames or component types without a
+ *	stored form are rejected by Write(). Wake potentials, BPM
+ *	buffers and other run time settings are not stored. The
+ *	length of a standing wave cavity is rebuilt from its cell
+ *	count and frequency, so agrees to rounding.
+ *
+ *	The file is written in native byte order; a snapshot from a
+ *	machine with a different byte order is treated as stale.
+ *
+ *	Typical use, with the model rebuilt only when an input file
+ *	changes:
+ *
+ *	    ModelSnapshotKey key;
+ *	    key.AddFile(lattice_file);
+ *	    key.AddFile(aperture_file);
+ *	    key.Add(beam_energy);
+ *	    AcceleratorModel* model = AcceleratorModelSnapshot::Cached("lhc.model", key.Value(), build, &materials);
+ */
+class AcceleratorModelSnapshot
+{
+public:
+	/// Incremented when the file layout changes
+	static const uint32_t version;
+
+	/**
+	 *	Writes the model to filename, tagged with key. The file
+	 *	is written under a temporary name and renamed, so that
+	 *	concurrent readers never see a partial file. Throws
+	 *	MerlinException if the model cannot be stored.
+	 */
+	static void Write(AcceleratorModel* model, const std::string& filename, uint64_t key);
+
+	/**
+	 *	Restores a model. Returns nullptr if the file does not
+	 *	exist, or was written by another version or for another
+	 *	key. Collimator materials are looked up in materials.
+	 *	Throws MerlinException if the file is corrupt or a
+	 *	material is not found.
+	 */
+	static AcceleratorModel* Read(const std::string& filename, uint64_t key, MaterialDatabase* materials = nullptr);
+
+	/**
+	 *	Reads the snapshot if it is current, otherwise calls build
+	 *	and writes a new snapshot of the result.
+	 */
+	static AcceleratorModel* Cached(const std::string& filename, uint64_t key,
+		const std::function<AcceleratorModel* ()>& build, MaterialDatabase* materials = nullptr);
+};
+
+#endif
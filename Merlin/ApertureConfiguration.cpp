@@ -37,15 +37,22 @@ ApertureConfiguration::ApertureConfiguration(string InputFileName) :
 void ApertureConfiguration::AssignAperturesToList(unique_ptr<DataTable>& dt)
 {
 	ApertureFactory factory;
+	const DataTable::ColumnHandle aper1 = dt->GetColumnHandle("APER_1");
+	const DataTable::ColumnHandle aper2 = dt->GetColumnHandle("APER_2");
+	const DataTable::ColumnHandle aper3 = dt->GetColumnHandle("APER_3");
+	const DataTable::ColumnHandle aper4 = dt->GetColumnHandle("APER_4");
+	const DataTable::ColumnHandle apertype = dt->GetColumnHandle("APERTYPE");
+	const DataTable::ColumnHandle s = dt->GetColumnHandle("S");
+	const DataTable::ColumnHandle l = dt->GetColumnHandle("L");
+
 	for(auto row : *dt)
 	{
-		if(row.Get_d("APER_1") == 0 && row.Get_d("APER_2") == 0 && row.Get_d("APER_3") == 0
-			&& row.Get_d("APER_4") == 0)
+		if(row.Get_d(aper1) == 0 && row.Get_d(aper2) == 0 && row.Get_d(aper3) == 0 && row.Get_d(aper4) == 0)
 			continue;
-		ApertureEntry = factory.getInstance(row.Get_s("APERTYPE"), row.Get_d("S") - row.Get_d("L"),
-			row.Get_d("APER_1"), row.Get_d("APER_2"), row.Get_d("APER_3"), row.Get_d("APER_4"));
+		ApertureEntry = factory.getInstance(row.Get_s(apertype), row.Get_d(s) - row.Get_d(l), row.Get_d(aper1),
+			row.Get_d(aper2), row.Get_d(aper3), row.Get_d(aper4));
 		ApertureList.push_back(ApertureEntry);
-		ApertureEntry->setSlongitudinal(row.Get_d("S"));
+		ApertureEntry->setSlongitudinal(row.Get_d(s));
 		ApertureList.push_back(ApertureEntry);
 	}
 }
@@ -0,0 +1,114 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "AsyncOutput.h"
+
+using namespace std;
+
+AsyncOutput::AsyncOutput(size_t nbuffers) :
+	buffers(max(nbuffers, size_t(1))), writing(false), stop(false)
+{
+	for(Buffer& b : buffers)
+	{
+		freeBuffers.push_back(&b);
+	}
+	writer = thread(&AsyncOutput::Run, this);
+}
+
+AsyncOutput::~AsyncOutput()
+{
+	{
+		lock_guard<mutex> guard(lock);
+		stop = true;
+	}
+	work.notify_one();
+	writer.join();
+}
+
+AsyncOutput::Buffer& AsyncOutput::Acquire()
+{
+	unique_lock<mutex> guard(lock);
+	done.wait(guard, [this]
+	{
+		return !freeBuffers.empty() || error;
+	});
+	Rethrow();
+
+	Buffer* b = freeBuffers.front();
+	freeBuffers.pop_front();
+	return *b;
+}
+
+void AsyncOutput::Submit(Buffer& buffer)
+{
+	{
+		lock_guard<mutex> guard(lock);
+		pending.push_back(&buffer);
+	}
+	work.notify_one();
+}
+
+void AsyncOutput::Flush()
+{
+	unique_lock<mutex> guard(lock);
+	done.wait(guard, [this]
+	{
+		return (pending.empty() && !writing) || error;
+	});
+	Rethrow();
+}
+
+void AsyncOutput::Rethrow()
+{
+	// called with the lock held
+	if(error)
+	{
+		exception_ptr e = error;
+		error = nullptr;
+		rethrow_exception(e);
+	}
+}
+
+void AsyncOutput::Run()
+{
+	unique_lock<mutex> guard(lock);
+	while(true)
+	{
+		work.wait(guard, [this]
+		{
+			return stop || !pending.empty();
+		});
+		if(pending.empty())
+		{
+			return;
+		}
+
+		Buffer* b = pending.front();
+		pending.pop_front();
+		writing = true;
+		guard.unlock();
+
+		exception_ptr e;
+		try
+		{
+			b->write(*b);
+		}
+		catch(...)
+		{
+			e = current_exception();
+		}
+
+		guard.lock();
+		writing = false;
+		if(e && !error)
+		{
+			error = e;
+		}
+		freeBuffers.push_back(b);
+		done.notify_all();
+	}
+}
@@ -0,0 +1,110 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef AsyncOutput_h
+#define AsyncOutput_h 1
+
+#include "merlin_config.h"
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "PSTypes.h"
+
+/**
+ * Background writer for particle output.
+ *
+ * The tracking thread copies a snapshot of the particles into one of a
+ * fixed ring of buffers and submits it; a writer thread then formats and
+ * writes it, so text formatting and disk I/O overlap with tracking.
+ * Buffers are reused, so their particle arrays keep their capacity from
+ * one snapshot to the next. When every buffer is waiting to be written,
+ * Acquire() blocks until the writer has caught up, which limits the
+ * memory held by pending output.
+ *
+ * Buffers are written in the order they are submitted. An exception
+ * thrown while writing is passed on by the next Acquire() or Flush().
+ *
+ *     AsyncOutput::Buffer& b = writer.Acquire();
+ *     b.particles.assign(bunch.begin(), bunch.end());
+ *     b.write = [&os](const AsyncOutput::Buffer& b) { ... };
+ *     writer.Submit(b);
+ */
+class AsyncOutput
+{
+public:
+	/**
+	 * A snapshot waiting to be written
+	 */
+	struct Buffer
+	{
+		/// Particle coordinates
+		PSvectorArray particles;
+
+		/// Description of the snapshot, for use by write
+		std::string name;
+		int turn;
+		double s;
+		double time;
+		double momentum;
+
+		/// Formats and writes the snapshot, on the writer thread
+		std::function<void(const Buffer&)> write;
+	};
+
+	/**
+	 * Start the writer thread
+	 * @param[in] nbuffers Number of snapshots that can wait to be written
+	 */
+	explicit AsyncOutput(size_t nbuffers = 4);
+
+	/// Writes any pending snapshots and stops the writer thread
+	~AsyncOutput();
+
+	AsyncOutput(const AsyncOutput&) = delete;
+	AsyncOutput& operator=(const AsyncOutput&) = delete;
+
+	/**
+	 * Returns a free buffer, waiting for the writer if every buffer is
+	 * in use. The buffer holds the data of an earlier snapshot.
+	 */
+	Buffer& Acquire();
+
+	/// Queues a buffer returned by Acquire() to be written
+	void Submit(Buffer& buffer);
+
+	/// Waits until every submitted buffer has been written
+	void Flush();
+
+	size_t GetNumberOfBuffers() const
+	{
+		return buffers.size();
+	}
+
+private:
+	void Run();
+	void Rethrow();
+
+	std::vector<Buffer> buffers;
+	std::deque<Buffer*> freeBuffers;
+	std::deque<Buffer*> pending;
+	bool writing;
+	bool stop;
+	std::exception_ptr error;
+
+	std::mutex lock;
+	std::condition_variable work;
+	std::condition_variable done;
+	std::thread writer;
+};
+
+#endif
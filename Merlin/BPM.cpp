@@ -24,6 +24,11 @@ void BPM::SetScale(double xs, double ys)
 	scale_y = ys;
 }
 
+bool BPM::IsRecording() const
+{
+	return TakeData();
+}
+
 void BPM::MakeMeasurement(const Bunch& aBunch)
 {
 	if(TakeData())
@@ -120,6 +120,11 @@ public:
 	 */
 	virtual void MakeMeasurement(const Bunch& aBunch);
 
+	/**
+	 *	Returns true if the BPM is active and has a buffer.
+	 */
+	virtual bool IsRecording() const;
+
 	/**
 	 *	Returns the index for a BPM.
 	 */
@@ -89,6 +89,15 @@ public:
 	 *	concrete bunch representations).
 	 */
 	virtual bool ApplyTransformation(const Transform3D& t) = 0;
+
+	/**
+	 *	Returns the number of (macro-)particles in the bunch. Used
+	 *	for profiling, see ScopeProfiler.
+	 */
+	virtual size_t GetParticleCount() const
+	{
+		return 0;
+	}
 };
 
 inline Bunch::Bunch(double p, double q) :
@@ -9,6 +9,7 @@
 #define BunchProcess_h 1
 
 #include "merlin_config.h"
+#include "ScopeProfiler.h"
 #include <string>
 
 class AcceleratorComponent;
@@ -88,6 +89,14 @@ public:
 
 	const string& GetID() const;
 
+	/**
+	 *	Returns the ScopeProfiler scope registered for this process.
+	 */
+	ScopeProfiler::ScopeID GetProfileID() const
+	{
+		return profileID;
+	}
+
 protected:
 
 	bool active;
@@ -103,6 +112,7 @@ private:
 
 	string ID;
 	int priority;
+	ScopeProfiler::ScopeID profileID;
 };
 
 /**
@@ -132,7 +142,8 @@ protected:
 };
 
 inline BunchProcess::BunchProcess(const string& anID, int aPriority) :
-	active(false), currentComponent(nullptr), ID(anID), priority(aPriority)
+	active(false), currentComponent(nullptr), ID(anID), priority(aPriority),
+	profileID(ScopeProfiler::RegisterScope(anID, ScopeProfiler::process_scope))
 {
 }
 
@@ -0,0 +1,158 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+#include <exception>
+
+#include "BunchTrainTracker.h"
+#include "ComponentFrame.h"
+#include "LongRangeWakePotentials.h"
+#include "MerlinException.h"
+#include "ParticleComponentTracker.h"
+#include "ProcessStepManager.h"
+#include "TTrackSim.h"
+
+using namespace std;
+
+namespace ParticleTracking
+{
+
+BunchTrainTracker::BunchTrainTracker(const AcceleratorModel::Beamline& bline) :
+	beamline(bline), longRangeWakes(false), wakePriority(0)
+{
+}
+
+BunchTrainTracker::~BunchTrainTracker()
+{
+	for(TrainBunch& b : bunches)
+	{
+		delete b.stepper;
+	}
+}
+
+size_t BunchTrainTracker::AddBunch(ParticleBunch* bunch, double t)
+{
+	if(!bunches.empty() && t < bunches.back().t)
+	{
+		throw MerlinException("BunchTrainTracker: bunches must be added in train order");
+	}
+
+	TrainBunch b = {bunch, t, new ProcessStepManager(), false};
+	b.stepper->AddProcess(new TTrnsProc<ParticleComponentTracker>());
+	bunches.push_back(b);
+	if(longRangeWakes)
+	{
+		IncludeLongRangeWakes(wakePriority);
+	}
+	return bunches.size() - 1;
+}
+
+void BunchTrainTracker::AddProcess(size_t n, BunchProcess* aProcess)
+{
+	bunches.at(n).stepper->AddProcess(aProcess);
+}
+
+void BunchTrainTracker::IncludeLongRangeWakes(int prio)
+{
+	longRangeWakes = true;
+	wakePriority = prio;
+	for(TrainBunch& b : bunches)
+	{
+		if(!b.hasWakeProcess)
+		{
+			b.stepper->AddProcess(new LongRangeWakeProcess(prio, wakeMemory, b.t));
+			b.hasWakeProcess = true;
+		}
+	}
+}
+
+void BunchTrainTracker::TrackFrame(TrainBunch& b, ComponentFrame* frame)
+{
+	ParticleBunch& bunch = *b.bunch;
+	bunch.ApplyTransformation(frame->GetEntrancePlaneTransform());
+	if(const Transform3D* t = frame->GetEntranceGeometryPatch())
+	{
+		bunch.ApplyTransformation(*t);
+	}
+
+	if(frame->IsComponent())
+	{
+		b.stepper->Track(frame->GetComponent());
+	}
+
+	if(const Transform3D* t = frame->GetExitGeometryPatch())
+	{
+		bunch.ApplyTransformation(*t);
+	}
+	bunch.ApplyTransformation(frame->GetExitPlaneTransform());
+}
+
+void BunchTrainTracker::Track()
+{
+	const vector<ComponentFrame*> frames(beamline.begin(), beamline.end());
+
+	// every cavity gets its wake before any thread looks for one
+	wakeMemory.Clear();
+	if(longRangeWakes)
+	{
+		for(ComponentFrame* frame : frames)
+		{
+			if(frame->IsComponent() && dynamic_cast<LongRangeWakePotentials*>(frame->GetComponent().GetWakePotentials())
+				&& !wakeMemory.AddCavity(frame->GetComponent()))
+			{
+				throw MerlinException("BunchTrainTracker: " + frame->GetComponent().GetQualifiedName()
+					+ " has a long-range wake and appears more than once in the beamline");
+			}
+		}
+	}
+
+	for(TrainBunch& b : bunches)
+	{
+		b.stepper->Initialise(*b.bunch);
+	}
+
+	// at each step bunch n tracks through frame step - n, which the bunch
+	// ahead of it left on the step before
+	const int nf = frames.size();
+	const int nb = bunches.size();
+	exception_ptr error;
+	for(int step = 0; step < nf + nb - 1 && !error; step++)
+	{
+		const int first = max(0, step - nf + 1);
+		const int last = min(step, nb - 1);
+
+#ifdef ENABLE_OPENMP
+		#pragma omp parallel for schedule(dynamic) if(last > first)
+#endif
+		for(int n = first; n <= last; n++)
+		{
+			try
+			{
+				TrackFrame(bunches[n], frames[step - n]);
+			}
+			catch(...)
+			{
+#ifdef ENABLE_OPENMP
+				#pragma omp critical(BunchTrainTracker)
+#endif
+				{
+					if(!error)
+					{
+						error = current_exception();
+					}
+				}
+			}
+		}
+	}
+
+	if(error)
+	{
+		rethrow_exception(error);
+	}
+}
+
+} // end namespace ParticleTracking
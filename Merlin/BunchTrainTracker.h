@@ -0,0 +1,108 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef BunchTrainTracker_h
+#define BunchTrainTracker_h 1
+
+#include <vector>
+
+#include "merlin_config.h"
+#include "AcceleratorModel.h"
+#include "LongRangeWakeProcess.h"
+#include "ParticleBunch.h"
+
+class BunchProcess;
+class ProcessStepManager;
+
+namespace ParticleTracking
+{
+
+/**
+ * Tracks a train of particle bunches through a beamline, one element
+ * at a time, so that each element sees the bunches in train order.
+ *
+ * Each bunch has its own set of processes, starting with particle
+ * transport, and the cavities carry the long-range wakes from one bunch
+ * to the next through a LongRangeWakeMemory, once IncludeLongRangeWakes()
+ * has been called.
+ *
+ * With OpenMP the bunches are tracked in parallel as a wavefront: a bunch
+ * enters an element as soon as the bunch ahead of it has left, so a
+ * train of n bunches takes n - 1 more steps than a single bunch, and
+ * every cavity is still passed in train order. The processes of
+ * different bunches must not share any other state.
+ */
+class BunchTrainTracker
+{
+public:
+
+	explicit BunchTrainTracker(const AcceleratorModel::Beamline& bline);
+	~BunchTrainTracker();
+
+	/**
+	 * Add a bunch to the tail of the train. The bunch is not owned by the
+	 * tracker, and must exist while the train is tracked.
+	 * @param[in] bunch The bunch
+	 * @param[in] t The arrival time of the bunch in s, behind the head of the train
+	 * @return The index of the bunch in the train
+	 */
+	size_t AddBunch(ParticleBunch* bunch, double t);
+
+	size_t GetNumberOfBunches() const
+	{
+		return bunches.size();
+	}
+
+	ParticleBunch& GetBunch(size_t n)
+	{
+		return *bunches[n].bunch;
+	}
+
+	/**
+	 * Add a process for bunch n. The process is owned by the tracker.
+	 */
+	void AddProcess(size_t n, BunchProcess* aProcess);
+
+	/**
+	 * Apply the long-range wakes of cavities with LongRangeWakePotentials
+	 * to every bunch, including those added later.
+	 * @param[in] prio The priority of the LongRangeWakeProcess
+	 */
+	void IncludeLongRangeWakes(int prio = 0);
+
+	/**
+	 * Track the train through the beamline. The long-range wakes are
+	 * cleared first, so the train enters empty cavities.
+	 */
+	void Track();
+
+private:
+
+	struct TrainBunch
+	{
+		ParticleBunch* bunch;
+		double t;
+		ProcessStepManager* stepper;
+		bool hasWakeProcess;
+	};
+
+	void TrackFrame(TrainBunch& b, ComponentFrame* frame);
+
+	AcceleratorModel::Beamline beamline;
+	std::vector<TrainBunch> bunches;
+	LongRangeWakeMemory wakeMemory;
+	bool longRangeWakes;
+	int wakePriority;
+
+	//Copy protection
+	BunchTrainTracker(const BunchTrainTracker& rhs);
+	BunchTrainTracker& operator=(const BunchTrainTracker& rhs);
+};
+
+} // end namespace ParticleTracking
+
+#endif
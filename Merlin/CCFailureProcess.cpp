@@ -32,9 +32,6 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 {
 	ATLAS_on = 1;
 	CMS_on = 1;
-	Horizontal_CC = 0;
-	upstream = 0;
-	ATLAS = 0;
 	IP1_up = 0;
 	IP1_down = 0;
 	IP5_up = 0;
@@ -44,28 +41,23 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 	IP5_up_count = 0;
 	IP5_down_count = 0;
 	Turn = 1;
-	failure_on = 1;
-	testn = 0;
-
-	for(int i = 0; i < 4; i++)
-	{
-		Atlas_Upstream_V1[i] = 0.;
-		CMS_Upstream_V1[i] = 0.;
-		Atlas_Upstream_deltamu[i] = 0.;
-		CMS_Upstream_deltamu[i] = 0.;
-		Atlas_Upstream_elno[i] = 0.;
-		CMS_Upstream_elno[i] = 0.;
-		Atlas_Upstream_M12[i] = 0;
-		CMS_Upstream_M12[i] = 0;
-	}
-
 	EnergyCC = 7E12;
+	n = 4;
+	failure_on = 1;
+	opticsValid = false;
+	currentCrab = nullptr;
+	Gamma_p = 0;
+	Beta_p = 0;
 	theta = 590e-6 / 2;           // Crossing angle
 	omega = 400.79E6 * 2 * pi;  // Freq of CC
 	phi_s = 0.0;                // CC phase - usually 0.0
-	n = 4;
 	fail_turns = 3;
 	non_fail_turns = 10;
+	CalcFailureProfile();
+}
+
+CCFailureProcess::~CCFailureProcess()
+{
 }
 
 CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* model, LatticeFunctionTable* twiss, double
@@ -75,9 +67,6 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 {
 	ATLAS_on = 1;
 	CMS_on = 1;
-	Horizontal_CC = 0;
-	upstream = 0;
-	ATLAS = 0;
 	IP1_up = 0;
 	IP1_down = 0;
 	IP5_up = 0;
@@ -90,20 +79,13 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 	EnergyCC = 7E12;
 	n = 4;
 	failure_on = 1;
-	testn = 0;
-
-	for(int i = 0; i < 4; i++)
-	{
-		Atlas_Upstream_V1[i] = 0.;
-		CMS_Upstream_V1[i] = 0.;
-		Atlas_Upstream_deltamu[i] = 0.;
-		CMS_Upstream_deltamu[i] = 0.;
-		Atlas_Upstream_elno[i] = 0.;
-		CMS_Upstream_elno[i] = 0.;
-	}
-
+	opticsValid = false;
+	currentCrab = nullptr;
+	Gamma_p = 0;
+	Beta_p = 0;
 	fail_turns = 3;
 	non_fail_turns = 10;
+	CalcFailureProfile();
 }
 
 CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* model, LatticeFunctionTable* twiss, double
@@ -113,9 +95,6 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 {
 	ATLAS_on = 1;
 	CMS_on = 1;
-	Horizontal_CC = 0;
-	upstream = 0;
-	ATLAS = 0;
 	IP1_up = 0;
 	IP1_down = 0;
 	IP5_up = 0;
@@ -128,17 +107,11 @@ CCFailureProcess::CCFailureProcess(int priority, int mode, AcceleratorModel* mod
 	EnergyCC = 7E12;
 	n = 4;
 	failure_on = 1;
-	testn = 0;
-
-	for(int i = 0; i < 4; i++)
-	{
-		Atlas_Upstream_V1[i] = 0.;
-		CMS_Upstream_V1[i] = 0.;
-		Atlas_Upstream_deltamu[i] = 0.;
-		CMS_Upstream_deltamu[i] = 0.;
-		Atlas_Upstream_elno[i] = 0.;
-		CMS_Upstream_elno[i] = 0.;
-	}
+	opticsValid = false;
+	currentCrab = nullptr;
+	Gamma_p = 0;
+	Beta_p = 0;
+	CalcFailureProfile();
 }
 
 void CCFailureProcess::InitialiseProcess(Bunch& bunch)
@@ -148,16 +121,145 @@ void CCFailureProcess::InitialiseProcess(Bunch& bunch)
 	{
 		cout << "CCFailure warning: !currentBunch" << endl;
 	}
+	if(!opticsValid)
+	{
+		CalcCrabOptics();
+	}
+}
+
+namespace
+{
+
+// Which set of cavities a CrabMarker belongs to, from its position in the LHC. Note that in order to use
+// this process we must inject a Gaussian bunch immediately before a set of upstream CCs
+bool FindCrabSet(double s, bool& upstream, bool& ATLAS)
+{
+	if(s >= 10000 && s <= 13200)
+	{
+		upstream = true;
+		ATLAS = false;
+	}
+	else if(s >= 13300 && s <= 15000)
+	{
+		upstream = false;
+		ATLAS = false;
+	}
+	else if(s <= 200)
+	{
+		upstream = false;
+		ATLAS = true;
+	}
+	else if(s >= 20000 && s <= 30000)
+	{
+		upstream = true;
+		ATLAS = true;
+	}
+	else
+	{
+		return false;
+	}
+	return true;
+}
+
+} // end anonymous namespace
+
+void CCFailureProcess::CalcCrabOptics()
+{
+	crabs.clear();
+	currentCrab = nullptr;
+
+	// the cavities of each set, in lattice order: [ATLAS][upstream]
+	vector<pair<const AcceleratorComponent*, int> > sets[2][2];
+	AcceleratorModel::Beamline bline = AccModelCC->GetBeamline();
+	for(AcceleratorModel::BeamlineIterator f = bline.begin(); f != bline.end(); f++)
+	{
+		if(!(*f)->IsComponent())
+		{
+			continue;
+		}
+		const CrabMarker* crab = dynamic_cast<const CrabMarker*>(&(*f)->GetComponent());
+		bool upstream, ATLAS;
+		if(crab && !crabs.count(crab) && FindCrabSet(crab->GetComponentLatticePosition(), upstream, ATLAS))
+		{
+			CrabCavity& c = crabs[crab];
+			c.ATLAS = ATLAS;
+			c.upstream = upstream;
+			c.slot = sets[ATLAS][upstream].size();
+			sets[ATLAS][upstream].push_back(make_pair(crab, AccModelCC->FindElementLatticePosition(crab->GetName())));
+		}
+	}
+
+	for(int ATLAS = 0; ATLAS < 2; ATLAS++)
+	{
+		const bool horizontal = !ATLAS;
+		int n2;
+		if(ATLAS)
+		{
+			n2 = AccModelCC->FindElementLatticePosition("IP1.L1");
+		}
+		else
+		{
+			n2 = AccModelCC->FindElementLatticePosition("IP5") + 1; //+1 as phase is incorrect
+		}
+
+		// V1 of the upstream cavities, from M12 to the IP
+		for(const auto& up : sets[ATLAS][1])
+		{
+			CrabCavity& c = crabs[up.first];
+			const int n1 = up.second;
+			const pair<double, double> DeltaMu = CalcDeltaMu(n1, n2);
+			c.deltamu = fabs(horizontal ? DeltaMu.first : DeltaMu.second) * 2 * pi;
+			c.M12 = CalcM_12(n1, n2, horizontal);
+			c.M22 = 0;
+			c.V = CalcV1(c.M12);
+		}
+
+		// V2 of the downstream cavities, from M22 to the upstream cavity in the same slot
+		for(const auto& down : sets[ATLAS][0])
+		{
+			CrabCavity& c = crabs[down.first];
+			const int n1 = down.second;
+			if(c.slot >= (int) sets[ATLAS][1].size())
+			{
+				crabs.erase(down.first);
+				continue;
+			}
+			const CrabCavity& up = crabs[sets[ATLAS][1][c.slot].first];
+			const int n_up = sets[ATLAS][1][c.slot].second;
+
+			const pair<double, double> DeltaMu = ATLAS ? CalcMu(n1) : CalcDeltaMu(n1, n2);
+			c.deltamu = fabs(horizontal ? DeltaMu.first : DeltaMu.second) * 2 * pi + up.deltamu;
+			c.M12 = CalcM_12(n2, n1, c.deltamu / 2, horizontal);
+			c.M22 = CalcM_22(n_up, n1, c.deltamu, horizontal);
+			c.V = CalcV2(up.V, c.M22);
+		}
+	}
+	opticsValid = true;
+}
+
+void CCFailureProcess::CalcFailureProfile()
+{
+	// V1 of the failing cavities falls linearly to zero, or the phase moves to 90 degrees, over fail_turns
+	const double fail_interval = 1 / (double) fail_turns;
+	const int nturns = max(non_fail_turns + fail_turns, 0);
+	failAmplitude.assign(nturns, 1.0);
+	failPhase.assign(nturns, 0.0);
+	for(int turn = max(non_fail_turns, 0); turn < nturns && failure_on; turn++)
+	{
+		failAmplitude[turn] = 1 - (((turn + 1) - non_fail_turns) * fail_interval);
+		failPhase[turn] = ((turn - (non_fail_turns - 1)) * fail_interval) * pi / 2;
+	}
 }
 
 void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 {
-	CrabMarker* aCrabMarker = dynamic_cast<CrabMarker*>(&component);
-	active = (currentBunch != nullptr) && (aCrabMarker);
+	auto crab = crabs.find(&component);
+	active = (currentBunch != nullptr) && (crab != crabs.end());
 
 	if(active)
 	{
 		currentComponent = &component;
+		currentCrab = &crab->second;
 
 		if(!ATLAS_on && !CMS_on)
 		{
@@ -171,7 +273,6 @@ void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 			if(IP1_up && IP1_down && IP5_up && IP5_down)
 			{
 				Turn++;
-				cout << "CrabFailureProcess ++TURN, Turn = " << Turn << endl;
 				//Reset turn
 				IP1_up = 0;
 				IP1_down = 0;
@@ -190,7 +291,6 @@ void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 			if(IP5_up && IP5_down)
 			{
 				Turn++;
-				cout << "CrabFailureProcess ++TURN, Turn = " << Turn << endl;
 				//Reset turn
 				IP5_up = 0;
 				IP5_down = 0;
@@ -206,7 +306,6 @@ void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 			if(IP1_up && IP1_down)
 			{
 				Turn++;
-				cout << "CrabFailureProcess ++TURN, Turn = " << Turn << endl;
 				//Reset turn
 				IP1_up = 0;
 				IP1_down = 0;
@@ -216,74 +315,22 @@ void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 			}
 		}
 
-		//Here we check which set of CCs we are using, and count each so that we can know when we have traversed all 16 for beam1
-		//Note that in order to use process this we must inject a Gaussian bunch immediately before a set of upstream CCs
-		if((currentComponent->GetComponentLatticePosition() >= 10000) &&
-			((currentComponent->GetComponentLatticePosition() <= 13200)))
+		//Count each set of CCs so that we can know when we have traversed all 16 for beam1
+		if(currentCrab->upstream && !currentCrab->ATLAS)
 		{
-			upstream = 1;
-			ATLAS = 0;
-			Horizontal_CC = 1;
-			IP5_up_count++;
-
-			if(IP5_up_count == 4)
-			{
-				IP5_up = 1;
-			}
-			else
-			{
-				IP5_up = 0;
-			}
+			IP5_up = (++IP5_up_count == 4);
 		}
-		else if((currentComponent->GetComponentLatticePosition() >= 13300) &&
-			((currentComponent->GetComponentLatticePosition() <= 15000)))
+		else if(!currentCrab->ATLAS)
 		{
-			upstream = 0;
-			ATLAS = 0;
-			Horizontal_CC = 1;
-			IP5_down_count++;
-
-			if(IP5_down_count == 4)
-			{
-				IP5_down = 1;
-			}
-			else
-			{
-				IP5_down = 0;
-			}
+			IP5_down = (++IP5_down_count == 4);
 		}
-		else if(currentComponent->GetComponentLatticePosition() <= 200)
+		else if(!currentCrab->upstream)
 		{
-			upstream = 0;
-			ATLAS = 1;
-			Horizontal_CC = 0;
-			IP1_down_count++;
-
-			if(IP1_down_count == 4)
-			{
-				IP1_down = 1;
-			}
-			else
-			{
-				IP1_down = 0;
-			}
+			IP1_down = (++IP1_down_count == 4);
 		}
-		else if((currentComponent->GetComponentLatticePosition() >= 20000) &&
-			((currentComponent->GetComponentLatticePosition() <= 30000)))
+		else
 		{
-			upstream = 1;
-			ATLAS = 1;
-			Horizontal_CC = 0;
-			IP1_up_count++;
-
-			if(IP1_up_count == 4)
-			{
-				IP1_up = 1;
-			}
-			else
-			{
-				IP1_up = 0;
-			}
+			IP1_up = (++IP1_up_count == 4);
 		}
 
 		Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
@@ -292,6 +339,7 @@ void CCFailureProcess::SetCurrentComponent(AcceleratorComponent& component)
 	else
 	{
 		currentComponent = nullptr;
+		currentCrab = nullptr;
 	}
 }
 
@@ -302,425 +350,78 @@ double CCFailureProcess::GetMaxAllowedStepSize() const
 
 void CCFailureProcess::DoProcess(double ds)
 {
-
-	if(!ATLAS_on && !CMS_on)
+	if(!currentCrab || Turn >= (non_fail_turns + fail_turns))
 	{
+		return;
 	}
 
-	else if(ATLAS_on && CMS_on)
+	double V = currentCrab->V;
+	double phase = phi_s;
+	if(ATLAS_on && CMS_on)
 	{
-		if(Turn < (non_fail_turns + fail_turns))
+		// Only the ATLAS cavities kick, with a voltage failure upstream; the CMS cavities just remove lost particles
+		if(!currentCrab->ATLAS)
 		{
-			ParticleBunch* newbunch = new ParticleBunch(currentBunch->GetReferenceMomentum(),
-				currentBunch->GetTotalCharge() / currentBunch->size());
-			newbunch->clear();
-			newbunch->reserve(currentBunch->size());
-
-			if(Beta_p == 0)
-			{
-				Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
-				Beta_p = LorentzBeta(Gamma_p);
-			}
-
-			double DeltaMuX(0.), DeltaMuY(0.), MuX(0.), MuY(0.), M12(0.), M22(0.), V1(0.), V2(0.);
-			int n1(0.), n2(0.);
-
-			++testn;
-			cout << "\n\t CCFAILUREPROCESS Called " << testn << " times " << endl;
-
-			// These depend on whether we are pre or post IP
-			n1 = AccModelCC->FindElementLatticePosition(currentComponent->GetName());
-			if(ATLAS)
-			{
-				n2 = AccModelCC->FindElementLatticePosition("IP1.L1");
-			}
-			else
-			{
-				n2 = AccModelCC->FindElementLatticePosition("IP5") + 1; //+1 as phase is incorrect
-			}
-
-			//Calc Mu / DeltaMu
-			if(upstream)
-			{
-				pair<double, double> DeltaMu = CalcDeltaMu(n1, n2);
-				DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi;
-				DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi;
-			}
-			else
-			{
-				pair<double, double> DeltaMu;
-				if(ATLAS)       //Vertical
-				{
-					DeltaMu = CalcMu(n1);
-
-					DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi;
-					DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi + Atlas_Upstream_deltamu[IP1_down_count - 1];
-				}
-				else            //Horizontal
-				{
-					DeltaMu = CalcDeltaMu(n1, n2);
-
-					DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi + CMS_Upstream_deltamu[IP1_down_count - 1];
-					DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi;
-				}
-			}
-
-			//Calc M12 & M22
-			if(Horizontal_CC)  //CMS
-			{
-				if(upstream)
-				{
-					M12 = CalcM_12(n1, n2, Horizontal_CC);
-				}
-				else
-				{
-					M12 = CalcM_12(n2, n1, DeltaMuX / 2, Horizontal_CC);
-					M22 = CalcM_22(CMS_Upstream_elno[IP5_down_count - 1], n1, DeltaMuX, Horizontal_CC);
-				}
-			}
-			else  //ATLAS
-			{
-				if(upstream)
-				{
-					M12 = CalcM_12(n1, n2, Horizontal_CC);
-				}
-				else
-				{
-					M12 = CalcM_12(n2, n1, DeltaMuY / 2, Horizontal_CC);
-					M22 = CalcM_22(Atlas_Upstream_elno[IP1_down_count - 1], n1, DeltaMuY, Horizontal_CC);
-				}
-			}
-
-			//Store V1s
-			if(ATLAS && upstream)
-			{
-				V1 = CalcV1(M12);
-
-				Atlas_Upstream_elno[IP1_up_count - 1] = n1;
-				Atlas_Upstream_V1[IP1_up_count - 1] = V1;
-				Atlas_Upstream_deltamu[IP1_up_count - 1] = DeltaMuY;
-				Atlas_Upstream_M12[IP1_up_count - 1] = M12;
-			}
-			else if(upstream)
-			{
-				V1 = CalcV1(M12);
-
-				CMS_Upstream_elno[IP5_up_count - 1] = n1;
-				CMS_Upstream_V1[IP5_up_count - 1] = V1;
-				CMS_Upstream_deltamu[IP5_up_count - 1] = DeltaMuX;
-				CMS_Upstream_M12[IP5_up_count - 1] = M12;
-			}
-			//Load V1s
-			if(ATLAS && !upstream)
-			{
-				V2 = CalcV2(Atlas_Upstream_V1[IP1_down_count - 1], M22);
-			}
-			else if(!upstream)
-			{
-				V2 = CalcV2(CMS_Upstream_V1[IP5_down_count - 1], M22);
-			}
-
-//FAILURE
-			double fail_interval = 1 / (double) fail_turns;
-			if(upstream && ATLAS && (Turn >= non_fail_turns) && (failure_on))
-			{
-				V1 = V1 * (1 - (((Turn + 1) - non_fail_turns) * fail_interval));
-			}
-
-			cout << "\nElement = " << currentComponent->GetName() << ", position = "
-				 << currentComponent->GetComponentLatticePosition() << endl;
-			if(upstream)
-			{
-				if(ATLAS)
-				{
-					cout << "Upstream ATLAS V1 = " << V1 << " \nDeltaMuY = " << DeltaMuY * (360 / (2 * pi))
-						 << " M12 = " << M12 << endl;
-				}
-				else
-				{
-					cout << "Upstream CMS V1 = " << V1 << " \nDeltaMuX = " << DeltaMuX * (360 / (2 * pi))
-						 << " M12 = " << M12 << endl;
-				}
-			}
-			else
-			{
-				if(ATLAS && (Atlas_Upstream_V1[3] != 0.))
-				{
-					cout << "Downstream ATLAS V2 = " << V2 << "\nDeltaMuY = " << DeltaMuY * (360 / (2 * pi))
-						 << " M12 = " << M12 << " M22 = " << M22 << endl;
-				}
-				else if(!ATLAS && (CMS_Upstream_V1[3] != 0.))
-				{
-					cout << "Downstream CMS V2 = " << V2 << "\nDeltaMuX = " << DeltaMuX * (360 / (2 * pi))
-						 << " M12 = " << M12 << " M22 = " << M22 << endl;
-				}
-
-			}
-
-			for(PSvectorArray::iterator p = currentBunch->begin(); p != currentBunch->end(); p++)
-			{
-				if(ATLAS)
-				{
-					if(upstream)
-					{
-						ApplyPreCCKick(*p, V1, M12, Horizontal_CC);
-					}
-					else
-					{
-						ApplyPostCCKick(*p, V2, M12, Horizontal_CC);
-					}
-				}
-				if(std::isnan(p->x()) || std::isnan(p->xp()) || std::isnan(p->y()) || std::isnan(p->yp()) || std::isnan(
-						p->ct()) || std::isnan(p->dp()))
-				{
-					cout << "CC Particle Lost" << endl;
-				}
-				else
-				{
-					newbunch->AddParticle(*p);
-				}
-			}
-
-			//Apply changes to particle bunch
-			currentBunch->clear();
-			currentBunch->swap(*newbunch);
+			V = 0;
+		}
+		else if(currentCrab->upstream)
+		{
+			V *= failAmplitude[Turn];
 		}
 	}
-
-	else if(ATLAS_on && !CMS_on && ATLAS)
+	else if(ATLAS_on && !CMS_on && currentCrab->ATLAS)
 	{
-		if(Turn < (non_fail_turns + fail_turns))
+		// Phase failure downstream. The failure phase replaces phi_s, which is zero after the first pass
+		if(!currentCrab->upstream && Turn >= non_fail_turns && failure_on)
 		{
-			ParticleBunch* newbunch = new ParticleBunch(currentBunch->GetReferenceMomentum(),
-				currentBunch->GetTotalCharge() / currentBunch->size());
-			newbunch->clear();
-			newbunch->reserve(currentBunch->size());
-
-			if(Beta_p == 0)
-			{
-				Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
-				Beta_p = LorentzBeta(Gamma_p);
-			}
-
-			double DeltaMuY(0.), MuX(0.), MuY(0.), M12(0.), M22(0.), V1(0.), V2(0.);
-			int n1(0.), n2(0.);
-
-			++testn;
-			cout << "\n\t CCFAILUREPROCESS Called " << testn << " times " << endl;
-
-			// These depend on whether we are pre or post IP
-			n1 = AccModelCC->FindElementLatticePosition(currentComponent->GetName());
-			n2 = AccModelCC->FindElementLatticePosition("IP1.L1");
-
-			//Calc Mu / DeltaMu
-			if(upstream)
-			{
-				pair<double, double> DeltaMu = CalcDeltaMu(n1, n2);
-				DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi;
-			}
-			else
-			{
-				pair<double, double> DeltaMu;
-				DeltaMu = CalcMu(n1);
-				DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi + Atlas_Upstream_deltamu[IP1_down_count - 1];
-			}
-
-			//Calc M12 & M22
-			if(upstream)
-			{
-				M12 = CalcM_12(n1, n2, Horizontal_CC);
-			}
-			else
-			{
-				M12 = CalcM_12(n2, n1, DeltaMuY / 2, Horizontal_CC);
-				M22 = CalcM_22(Atlas_Upstream_elno[IP1_down_count - 1], n1, DeltaMuY, Horizontal_CC);
-			}
-
-			//Store V1s
-			if(upstream)
-			{
-				V1 = CalcV1(M12);
-
-				Atlas_Upstream_elno[IP1_up_count - 1] = n1;
-				Atlas_Upstream_V1[IP1_up_count - 1] = V1;
-				Atlas_Upstream_deltamu[IP1_up_count - 1] = DeltaMuY;
-				Atlas_Upstream_M12[IP1_up_count - 1] = M12;
-			}
-			//Load V1s
-			else if(!upstream)
-			{
-				V2 = CalcV2(Atlas_Upstream_V1[IP1_down_count - 1], M22);
-			}
-
-//FAILURE
-			double fail_interval = 1 / (double) fail_turns;
-			if(!upstream && (Turn >= non_fail_turns) && (failure_on))
-			{
-				//140 degrees is 2.443 radians 140 * (2*pi)/360
-				double phi = 90 * (2 * pi) / 360;
-				phi_s = (((Turn) - (non_fail_turns - 1)) * fail_interval) * phi;
-			}
-
-			cout << "\nElement = " << currentComponent->GetName() << ", position = "
-				 << currentComponent->GetComponentLatticePosition() << endl;
-			if(upstream)
-			{
-				if(ATLAS)
-				{
-					cout << "Upstream ATLAS V1 = " << V1 << " \nDeltaMuY = " << DeltaMuY * (360 / (2 * pi))
-						 << " M12 = " << M12 << " Phi = " << phi_s << endl;
-				}
-			}
-			else
-			{
-				if(ATLAS && (Atlas_Upstream_V1[3] != 0.))
-				{
-					cout << "Downstream ATLAS V2 = " << V2 << "\nDeltaMuY = " << DeltaMuY * (360 / (2 * pi))
-						 << " M12 = " << M12 << " M22 = " << M22 << " Phi = " << phi_s << endl;
-				}
-
-			}
-
-			for(PSvectorArray::iterator p = currentBunch->begin(); p != currentBunch->end(); p++)
-			{
-				if(upstream)
-				{
-					ApplyPreCCKick(*p, V1, M12, Horizontal_CC);
-				}
-				else
-				{
-					ApplyPostCCKick(*p, V2, M12, Horizontal_CC);
-				}
-
-				if(std::isnan(p->x()) || std::isnan(p->xp()) || std::isnan(p->y()) || std::isnan(p->yp()) || std::isnan(
-						p->ct()) || std::isnan(p->dp()))
-				{
-					cout << "CC Particle Lost" << endl;
-				}
-				else
-				{
-					newbunch->AddParticle(*p);
-				}
-			}
-
-			//Apply changes to particle bunch
-			currentBunch->clear();
-			currentBunch->swap(*newbunch);
-			phi_s = 0.0;
+			phase = failPhase[Turn];
 		}
+		ApplyCrabKicks(V, phase, false);
+		phi_s = 0.0;
+		return;
 	}
-
-	else if(!ATLAS_on && CMS_on && !ATLAS)
+	else if(!ATLAS_on && CMS_on && !currentCrab->ATLAS)
 	{
-		if(Turn < (non_fail_turns + fail_turns))
+		// Voltage failure upstream
+		if(currentCrab->upstream)
 		{
-			ParticleBunch* newbunch = new ParticleBunch(currentBunch->GetReferenceMomentum(),
-				currentBunch->GetTotalCharge() / currentBunch->size());
-			newbunch->clear();
-			newbunch->reserve(currentBunch->size());
-
-			if(Beta_p == 0)
-			{
-				Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
-				Beta_p = LorentzBeta(Gamma_p);
-			}
-
-			double DeltaMuX(0.), MuX(0.), MuY(0.), M12(0.), M22(0.), V1(0.), V2(0.);
-
-			int n1(0.), n2(0.);
-
-			++testn;
-			cout << "\n\t CCFAILUREPROCESS Called " << testn << " times " << endl;
-
-			// These depend on whether we are pre or post IP
-			n1 = AccModelCC->FindElementLatticePosition(currentComponent->GetName());
-			n2 = AccModelCC->FindElementLatticePosition("IP5") + 1; //+1 as phase is incorrect
-
-			//Calc Mu / DeltaMu
-
-			pair<double, double> DeltaMu = CalcDeltaMu(n1, n2);
-			if(upstream)
-			{
-				DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi;
-			}
-			else
-			{
-				DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi + CMS_Upstream_deltamu[IP5_down_count - 1];
-			}
-
-			//Calc M12 & M22
-			if(upstream)
-			{
-				M12 = CalcM_12(n1, n2, Horizontal_CC);
-			}
-			else
-			{
-				M12 = CalcM_12(n2, n1, DeltaMuX / 2, Horizontal_CC);
-				M22 = CalcM_22(CMS_Upstream_elno[IP5_down_count - 1], n1, DeltaMuX, Horizontal_CC);
-			}
-
-			//Store V1s
-			if(upstream)
-			{
-				V1 = CalcV1(M12);
-
-				CMS_Upstream_elno[IP5_up_count - 1] = n1;
-				CMS_Upstream_V1[IP5_up_count - 1] = V1;
-				CMS_Upstream_deltamu[IP5_up_count - 1] = DeltaMuX;
-				CMS_Upstream_M12[IP5_up_count - 1] = M12;
-			}
-			//Load V1s
-			else
-			{
-				V2 = CalcV2(CMS_Upstream_V1[IP5_down_count - 1], M22);
-			}
-
-//FAILURE
-			double fail_interval = 1 / (double) fail_turns;
-			if(upstream && (Turn >= non_fail_turns) && (failure_on))
-			{
-				V1 = V1 * (1 - (((Turn + 1) - non_fail_turns) * fail_interval));
-			}
+			V *= failAmplitude[Turn];
+		}
+	}
+	else
+	{
+		return;
+	}
 
-			cout << "\nElement = " << currentComponent->GetName() << ", position = "
-				 << currentComponent->GetComponentLatticePosition() << endl;
-			if(upstream)
-			{
-				cout << "Upstream CMS V1 = " << V1 << " \nDeltaMuX = " << DeltaMuX * (360 / (2 * pi)) << " M12 = "
-					 << M12 << endl;
-			}
-			else
-			{
-				cout << "Downstream CMS V2 = " << V2 << "\nDeltaMuX = " << DeltaMuX * (360 / (2 * pi)) << " M12 = "
-					 << M12 << " M22 = " << M22 << endl;
-			}
+	ApplyCrabKicks(V, phase, !currentCrab->ATLAS);
+}
 
-			for(PSvectorArray::iterator p = currentBunch->begin(); p != currentBunch->end(); p++)
-			{
-				if(upstream)
-				{
-					ApplyPreCCKick(*p, V1, M12, Horizontal_CC);
-				}
-				else
-				{
-					ApplyPostCCKick(*p, V2, M12, Horizontal_CC);
-				}
-
-				if(std::isnan(p->x()) || std::isnan(p->xp()) || std::isnan(p->y()) || std::isnan(p->yp()) || std::isnan(
-						p->ct()) || std::isnan(p->dp()))
-				{
-					cout << "CC Particle Lost" << endl;
-				}
-				else
-				{
-					newbunch->AddParticle(*p);
-				}
-			}
+void CCFailureProcess::ApplyCrabKicks(double V, double phase, bool horizontal)
+{
+	PSvectorArray& particles = currentBunch->GetParticles();
+	const size_t np = particles.size();
+	const double scale = V / EnergyCC;
+	const double omega_ov_c = omega / SpeedOfLight;
+	const PScoord plane = horizontal ? ps_XP : ps_YP;
+	lost.resize(np);
+	size_t nlost = 0;
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for reduction(+:nlost)
+#endif
+	for(size_t i = 0; i < np; i++)
+	{
+		PSvector& p = particles[i];
+		p[plane] -= scale * sin(phase + (p.ct() * omega_ov_c));
+		lost[i] = std::isnan(p.x()) || std::isnan(p.xp()) || std::isnan(p.y()) || std::isnan(p.yp()) || std::isnan(
+			p.ct()) || std::isnan(p.dp());
+		nlost += lost[i];
+	}
 
-			//Apply changes to particle bunch
-			currentBunch->clear();
-			currentBunch->swap(*newbunch);
-		}
+	if(nlost)
+	{
+		cout << "CCFailureProcess: " << nlost << " particles lost at " << currentComponent->GetName() << endl;
+		currentBunch->RemoveParticles(lost);
 	}
 }
 
@@ -763,56 +464,29 @@ double CCFailureProcess::CalcM_22(int start, int end, double deltamu, bool horiz
 
 double CCFailureProcess::CalcM_12(int start, int end, bool horizontal)
 {
-	double beta1(0.), beta2(0.), deltamu(0.);
-	pair<double, double> DeltaMu = CalcDeltaMu(start, end);
-	double DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi;
-	double DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi;
-
-	if(horizontal)
-	{
-		deltamu = DeltaMuX;
-		beta1 = TwissCC->Value(1, 1, 1, start);
-		beta2 = TwissCC->Value(1, 1, 1, end);
-	}
-	else
-	{
-		deltamu = DeltaMuY;
-		beta1 = TwissCC->Value(3, 3, 2, start);
-		beta2 = TwissCC->Value(3, 3, 2, end);
-	}
-
-	return sqrt(beta1 * beta2) * sin(deltamu);
+	const RealMatrix M = GetPhaseAdvance().GetTransferMaps().MapBetween(min(start, end), max(start, end));
+	return horizontal ? M(0, 1) : M(2, 3);
 }
 
 double CCFailureProcess::CalcM_22(int start, int end, bool horizontal)
 {
-	//Simplified calculation omitting Alpha_2*sin(deltamu) term
-	double beta1(0.), beta2(0.), deltamu(0.);
-	pair<double, double> DeltaMu = CalcDeltaMu(start, end);
-	double DeltaMuX = sqrt(pow(DeltaMu.first, 2)) * 2 * pi;
-	double DeltaMuY = sqrt(pow(DeltaMu.second, 2)) * 2 * pi;
-
-	if(horizontal)
-	{
-		deltamu = DeltaMuX;
-		beta1 = TwissCC->Value(1, 1, 1, start);
-		beta2 = TwissCC->Value(1, 1, 1, end);
-	}
-	else
-	{
-		deltamu = DeltaMuY;
-		beta1 = TwissCC->Value(3, 3, 2, start);
-		beta2 = TwissCC->Value(3, 3, 2, end);
-	}
-
-	return sqrt(beta1 / beta2) * cos(deltamu);
+	const RealMatrix M = GetPhaseAdvance().GetTransferMaps().MapBetween(min(start, end), max(start, end));
+	return horizontal ? M(1, 1) : M(3, 3);
 }
 
 pair<double, double> CCFailureProcess::CalcMu(int element)
 {
-	PhaseAdvance* PA = new PhaseAdvance(AccModelCC, TwissCC, EnergyCC);
-	pair<double, double> Mu = PA->CalcIntegerPart(element);
-	return Mu;
+	return GetPhaseAdvance().CalcIntegerPart(element);
+}
+
+PhaseAdvance& CCFailureProcess::GetPhaseAdvance()
+{
+	if(!PhaseAdvanceCC)
+	{
+		// EnergyCC is in eV
+		PhaseAdvanceCC.reset(new PhaseAdvance(AccModelCC, TwissCC, EnergyCC * eV));
+	}
+	return *PhaseAdvanceCC;
 }
 
 pair<double, double> CCFailureProcess::CalcDeltaMu(int element1, int element2)
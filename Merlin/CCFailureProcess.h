@@ -9,6 +9,9 @@
 #define CCFailureProcess_h 1
 
 #include "merlin_config.h"
+#include <map>
+#include <memory>
+#include <vector>
 
 #include "AcceleratorModel.h"
 #include "CrabMarker.h"
@@ -18,6 +21,8 @@
 
 #include "LatticeFunctions.h"
 
+class PhaseAdvance;
+
 namespace ParticleTracking
 {
 
@@ -29,6 +34,11 @@ namespace ParticleTracking
  * and vertical @ ATLAS), and have been placed in the TFS table as CRABMARKER
  * elements. Currently the phase advances calculated in MADX are used as MERLIN
  * doesn't store this information in the LatticeFunctionTable
+ *
+ * The optics of every cavity and its IP (phase advance, M12, M22 and
+ * the voltages V1 and V2) are found once, when the process is first
+ * initialised, and the voltage and phase of each turn of the failure
+ * are tabulated, so each pass of a cavity only kicks the bunch in place.
  */
 
 class CCFailureProcess: public ParticleBunchProcess
@@ -47,6 +57,8 @@ public:
 	CCFailureProcess(int priority, int mode, AcceleratorModel* model, LatticeFunctionTable* twiss, double freq, double
 		crossing, double phase, int non_fail_turn, int fail_turn);
 
+	~CCFailureProcess();
+
 	/**
 	 *	Initialise this process with the specified Bunch. If
 	 *	bunch is not a ParticleBunch object, the process becomes
@@ -80,6 +92,9 @@ public:
 	//for voltage the phase advance is between CC and IP, for x/y kicks it is between the start and end of the CC
 	virtual double CalcM_12(int start, int end, double deltamu, bool horizontal);
 	virtual double CalcM_22(int start, int end, double deltamu, bool horizontal);
+
+	//Return M12 or M22 of the transfer matrix between the two rows of the
+	//lattice function table, taken from the cached optics
 	virtual double CalcM_12(int start, int end, bool horizontal);
 	virtual double CalcM_22(int start, int end, bool horizontal);
 
@@ -107,14 +122,22 @@ public:
 	/**
 	 *  Performs the pre-CC particle kick
 	 *  @param[in] M12 Transfer matrix element between two points
+	 *
+	 *  No longer called by DoProcess(), which kicks the whole bunch
+	 *  with ApplyCrabKicks(); override that instead.
 	 */
-	virtual void ApplyPreCCKick(PSvector &p, double V, double M12, bool horizontal);
+	[[deprecated("DoProcess() no longer calls this; override ApplyCrabKicks().")]] virtual void ApplyPreCCKick(
+		PSvector &p, double V, double M12, bool horizontal);
 
 	/**
 	 *  Performs the post-CC particle kick
 	 *  @param[in] M12 Transfer matrix element between two points
+	 *
+	 *  No longer called by DoProcess(), which kicks the whole bunch
+	 *  with ApplyCrabKicks(); override that instead.
 	 */
-	virtual void ApplyPostCCKick(PSvector &p, double V, double M12, bool horizontal);
+	[[deprecated("DoProcess() no longer calls this; override ApplyCrabKicks().")]] virtual void ApplyPostCCKick(
+		PSvector &p, double V, double M12, bool horizontal);
 
 	/**
 	 * Switch on/off Failure
@@ -122,6 +145,7 @@ public:
 	virtual void SetFailureOnOff(bool onoff)
 	{
 		failure_on = onoff;
+		CalcFailureProfile();
 		cout << "CCFailure::Failure_on = " << failure_on << endl;
 	}
 
@@ -131,6 +155,7 @@ public:
 	virtual void SetFailureTurns(int ft)
 	{
 		fail_turns = ft;
+		CalcFailureProfile();
 		cout << "CCFailure::SetFailureTurns = " << fail_turns << endl;
 	}
 
@@ -140,31 +165,73 @@ public:
 	virtual void SetNonFailureTurns(int nft)
 	{
 		non_fail_turns = nft;
+		CalcFailureProfile();
 		cout << "CCFailure::SetNonFailureTurns = " << non_fail_turns << endl;
 	}
 
 	/**
-	 * Select which plane to fail (horizontal = ATLAS, vertical = CMS)
+	 * Select which crab cavities to fail: the ATLAS cavities, which crab in the vertical plane,
+	 * and/or the CMS cavities, which crab in the horizontal plane
 	 */
-	virtual void SetFailurePlanes(bool hor, bool ver)
+	virtual void SetFailurePlanes(bool atlas, bool cms)
 	{
-		ATLAS_on = hor;
-		CMS_on = ver;
+		ATLAS_on = atlas;
+		CMS_on = cms;
 		cout << "CCFailure::SetFailurePlanes: ATLAS = " << ATLAS_on << ", CMS = " << CMS_on << endl;
 	}
 
+	/**
+	 * Finds the optics of every crab cavity in the model. Called when
+	 * the process is first initialised; call again after changing the
+	 * model, the lattice functions or the cavity settings.
+	 */
+	void CalcCrabOptics();
+
+protected:
+	/**
+	 * Kicks every particle of the bunch in place by the crab cavity
+	 * voltage V at the given phase, in the horizontal or vertical
+	 * plane, and removes particles with NaN coordinates
+	 */
+	virtual void ApplyCrabKicks(double V, double phase, bool horizontal);
+
 private:
+	/**
+	 * A crab cavity and its optics to the IP
+	 */
+	struct CrabCavity
+	{
+		bool ATLAS;         // ATLAS (vertical) or CMS (horizontal)
+		bool upstream;
+		int slot;           // order of the cavity in its set of four
+		double deltamu;
+		double M12;
+		double M22;
+		double V;           // V1 upstream, V2 downstream
+	};
+
+	// Cached optics, found on first use
+	PhaseAdvance& GetPhaseAdvance();
+
+	// Voltage scale and phase of the cavities on each turn
+	void CalcFailureProfile();
+
 	// Data Members for Class Attributes
 	AcceleratorModel* AccModelCC;
 	LatticeFunctionTable* TwissCC;
+	std::unique_ptr<PhaseAdvance> PhaseAdvanceCC;
+
+	std::map<const AcceleratorComponent*, CrabCavity> crabs;
+	bool opticsValid;
+	const CrabCavity* currentCrab;
+
+	std::vector<double> failAmplitude;
+	std::vector<double> failPhase;
+	std::vector<char> lost;
 
 	bool ATLAS_on;
 	bool CMS_on;
 
-	bool Horizontal_CC; //Horizontal	=1  Vertical	=0
-	bool upstream;      //upstream		=1  downstream	=0
-	bool ATLAS;         //ATLAS			=1  CMS			=0
-
 	//Use these to find if we have made a complete turn (in terms of CCs)
 	bool IP1_up;
 	bool IP1_down;
@@ -175,19 +242,6 @@ private:
 	int IP5_up_count;
 	int IP5_down_count;
 
-	//Store upstream voltages
-	double Atlas_Upstream_V1[4];
-	double CMS_Upstream_V1[4];
-	//Store upstream element numbers
-	double Atlas_Upstream_elno[4];
-	double CMS_Upstream_elno[4];
-	//Store upstream deltamu
-	double Atlas_Upstream_deltamu[4];
-	double CMS_Upstream_deltamu[4];
-	// store M12
-	double Atlas_Upstream_M12[4];
-	double CMS_Upstream_M12[4];
-
 	double Gamma_p;
 	double Beta_p;
 	double omega;       //crab cavity frequency
@@ -202,7 +256,6 @@ private:
 
 	int Turn;
 	int n;          //number of crabs pre/post IP
-	int testn;
 };
 
 } // end namespace ParticleTracking
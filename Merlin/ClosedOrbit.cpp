@@ -9,6 +9,7 @@
 #include "SynchRadParticleProcess.h"
 #include "RingDeltaTProcess.h"
 #include "ClosedOrbit.h"
+#include "LinearMapTracker.h"
 #include "TLASimp.h"
 
 #ifdef DEBUG_CLOSED_ORBIT
@@ -21,7 +22,8 @@ using namespace ParticleTracking;
 
 ClosedOrbit::ClosedOrbit(AcceleratorModel* aModel, double refMomentum) :
 	theModel(aModel), p0(refMomentum), transverseOnly(false), radiation(false), useFullAcc(false), delta(1.0e-9), tol(
-		1.0e-26), max_iter(20), bendscale(0), theTracker(new ParticleTracker)
+		1.0e-26), max_iter(20), bendscale(0), mapConcatenation(false), userProcesses(false),
+	quasiNewton(false), theTracker(new ParticleTracker), lastOrbit(0), lastNcpt(-1)
 {
 }
 
@@ -33,6 +35,18 @@ ClosedOrbit::~ClosedOrbit()
 void ClosedOrbit::AddProcess(ParticleBunchProcess* aProcess)
 {
 	theTracker->AddProcess(aProcess);
+	userProcesses = true;
+}
+
+void ClosedOrbit::UseMapConcatenation(bool flag)
+{
+	mapConcatenation = flag;
+}
+
+void ClosedOrbit::UseQuasiNewton(bool flag)
+{
+	quasiNewton = flag;
+	lastNcpt = -1;
 }
 
 void ClosedOrbit::TransverseOnly(bool flag)
@@ -89,15 +103,27 @@ void ClosedOrbit::ScaleBendPathLength(double scale)
 
 void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 {
+	if(mapConcatenation && !radiation && !useFullAcc && !userProcesses)
+	{
+		FindClosedOrbitByMaps(particle, ncpt);
+		return;
+	}
+
 	const int cpt = transverseOnly ? 4 : 6;
 
-	ParticleBunch bunch(p0, 1.0);
-	int k = 0;
-	for(k = 0; k < cpt + 1; k++)
+	// a quasi-Newton search continues from the last one
+	const bool reuse = quasiNewton && lastNcpt == ncpt && static_cast<int>(jacobian.nrows()) == cpt;
+	if(reuse)
 	{
-		bunch.push_back(particle);
+		for(int row = 0; row < cpt; row++)
+		{
+			particle[row] = lastOrbit[row];
+		}
 	}
 
+	ParticleBunch bunch(p0, 1.0);
+	int k = 0;
+
 	//	ParticleTracker tracker(theModel->GetRing(ncpt), &bunch, true);
 	theTracker->SetRing(theModel->GetRing(ncpt));
 	theTracker->SetInitialBunch(&bunch, false);
@@ -140,6 +166,20 @@ void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 	RealMatrix dg(cpt);
 	w = 1.0;
 	iter = 1;
+	tracked = 0;
+
+	// the Jacobian is found by tracking cpt+1 particles on a Newton iteration, and is
+	// otherwise updated from the last step
+	bool newton = true;
+	bool haveStep = false;
+	RealVector gLast(cpt);
+	RealVector step(cpt);
+	PSvector lastParticle = particle;
+	if(reuse)
+	{
+		dg = jacobian;
+		newton = false;
+	}
 
 #ifdef DEBUG_CLOSED_ORBIT
 	cout << "Finding closed orbit:" << endl;
@@ -154,17 +194,19 @@ void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 		// Note that the *first* particle is the reference ray
 		ParticleBunch::iterator ip;
 
-		k = 0;
-		for(ip = bunch.begin(); ip != bunch.end(); ip++, k++)
+		bunch.clear();
+		const int nrays = newton ? cpt + 1 : 1;
+		for(k = 0; k < nrays; k++)
 		{
-			*ip = particle;
+			bunch.push_back(particle);
 			if(k > 0)
 			{
-				(*ip)[k - 1] += delta;
+				bunch.GetParticles().back()[k - 1] += delta;
 			}
 		}
 
 		theTracker->Run();
+		tracked += nrays;
 
 		ip = theTracker->GetTrackedBunch().begin();
 		const Particle& p_ref = *ip++; // reference particle
@@ -174,25 +216,60 @@ void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 		cout << p_ref << endl;
 #endif
 
-		for(k = 0; k < cpt; k++, ip++)
+		for(k = 0; k < cpt; k++)
 		{
+			g(k) = p_ref[k] - particle[k];
+		}
+
+		if(newton)
+		{
+			for(k = 0; k < cpt; k++, ip++)
+			{
+				for(int m = 0; m < cpt; m++)
+				{
+					dg(m, k) = ((*ip)[m] - p_ref[m]) / delta;
+				}
+				dg(k, k) -= 1.;
+			}
+		}
+		else if(haveStep)
+		{
+			if(g * g > gLast * gLast)
+			{
+				// diverging: take a Newton step from the last point instead
+				particle = lastParticle;
+				newton = true;
+				iter++;
+				continue;
+			}
+
+			// Broyden's update, so that dg maps the last step onto the change in g
+			RealVector y = g - gLast - dg * step;
+			const double ss = step * step;
 			for(int m = 0; m < cpt; m++)
 			{
-				dg(m, k) = ((*ip)[m] - p_ref[m]) / delta;
+				for(k = 0; k < cpt; k++)
+				{
+					dg(m, k) += y(m) * step(k) / ss;
+				}
 			}
-			dg(k, k) -= 1.;
-			g(k) = p_ref[k] - particle[k];
 		}
 
+		gLast = g;
+		lastParticle = particle;
+
 		SVDMatrix<double> invdg(dg);
 		g = invdg(g);
 		for(int row = 0; row < cpt; row++)
 		{
 			particle[row] -= g(row);
+			step(row) = -g(row);
 		}
 
 		w = g * g; // dot product!
 		iter++;
+		haveStep = true;
+		newton = !quasiNewton;
 
 #ifdef DEBUG_CLOSED_ORBIT
 		cout << p_ref << endl;
@@ -200,6 +277,14 @@ void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 
 	}
 
+	if(quasiNewton)
+	{
+		jacobian.redim(cpt, cpt);
+		jacobian = dg;
+		lastOrbit = particle;
+		lastNcpt = ncpt;
+	}
+
 	// clean-up
 	// To prevent multiple processes building up
 	// in theTracker, we remove the two processes
@@ -221,6 +306,64 @@ void ClosedOrbit::FindClosedOrbit(PSvector& particle, int ncpt)
 #endif
 }
 
+void ClosedOrbit::FindClosedOrbitByMaps(PSvector& particle, int ncpt)
+{
+	const int cpt = transverseOnly ? 4 : 6;
+	if(quasiNewton && lastNcpt == ncpt)
+	{
+		for(int row = 0; row < cpt; row++)
+		{
+			particle[row] = lastOrbit[row];
+		}
+	}
+
+	LinearMapTracker lmt(p0);
+	lmt.ScaleBendPathLength(bendscale);
+
+	RealVector g(cpt);
+	RealMatrix dg(cpt);
+	RealMatrix M(6, 6);
+	w = 1.0;
+	iter = 1;
+	tracked = 0;
+
+	while((w > tol) && (iter < max_iter))
+	{
+		// one orbit and its linear map once around the ring
+		PSvector p_ref = particle;
+		lmt.Track(theModel->GetRing(ncpt), p_ref, M);
+		tracked++;
+
+		for(int k = 0; k < cpt; k++)
+		{
+			for(int m = 0; m < cpt; m++)
+			{
+				dg(m, k) = M(m, k);
+			}
+			dg(k, k) -= 1.;
+			g(k) = p_ref[k] - particle[k];
+		}
+
+		SVDMatrix<double> invdg(dg);
+		g = invdg(g);
+		for(int row = 0; row < cpt; row++)
+		{
+			particle[row] -= g(row);
+		}
+
+		w = g * g; // dot product!
+		iter++;
+	}
+
+	if(quasiNewton)
+	{
+		jacobian.redim(cpt, cpt);
+		jacobian = dg;
+		lastOrbit = particle;
+		lastNcpt = ncpt;
+	}
+}
+
 void ClosedOrbit::FindRMSOrbit(PSvector& particle)
 {
 	ParticleTracker tracker(theModel->GetBeamline(), particle, p0);
@@ -37,6 +37,19 @@ public:
 
 	void AddProcess(ParticleBunchProcess* aProcess);
 
+	// When set, and there is no radiation, full acceleration or
+	// added process, the Jacobian for each iteration is found by
+	// LinearMapTracker instead of by tracking a finite difference
+	// bunch. Default: false
+	void UseMapConcatenation(bool flag);
+
+	// When set, each call starts from the last orbit found. If the
+	// orbit is found by tracking, the Jacobian is kept and updated
+	// by Broyden's method from a single reference particle turn on
+	// each later iteration, and in later calls. A full Newton step
+	// is taken again if the residual grows. Default: false
+	void UseQuasiNewton(bool flag);
+
 	// The following member functions are available for diagnostics
 
 	// The final achieved figure of merit for the iteration
@@ -45,6 +58,10 @@ public:
 	// The number of iterations
 	int iter;
 
+	// The number of particles (or, with map concatenation, orbits)
+	// tracked once around the ring
+	int tracked;
+
 private:
 	AcceleratorModel* theModel;
 	double p0;
@@ -58,7 +75,17 @@ private:
 	double radstepsize;
 	int radnumsteps;
 	double bendscale;
+	bool mapConcatenation;
+	bool userProcesses;
+	bool quasiNewton;
 	ParticleTracker* theTracker;
+
+	// Kept between calls in quasi-Newton mode
+	RealMatrix jacobian;
+	PSvector lastOrbit;
+	int lastNcpt;
+
+	void FindClosedOrbitByMaps(PSvector& particle, int ncpt);
 };
 
 #endif
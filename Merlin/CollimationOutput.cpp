@@ -21,4 +21,8 @@ CollimationOutput::CollimationOutput(OutputType ot)
 	otype = ot;
 }
 
+CollimationOutput::~CollimationOutput()
+{
+}
+
 } // End namespace ParticleTracking
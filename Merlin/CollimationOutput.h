@@ -167,7 +167,7 @@ public:
 	/**
 	 * Destructor
 	 */
-	~CollimationOutput();
+	virtual ~CollimationOutput();
 
 	/**
 	 * Finalise will call any sorting algorithms and perform formatting for final output
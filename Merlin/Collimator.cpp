@@ -12,13 +12,13 @@
 const int Collimator::ID = UniqueIndex();
 
 Collimator::Collimator(const string& id, double len) :
-	Drift(id, len), Xr(0), scatter_at_this_collimator(true)
+	Drift(id, len), material(nullptr), Xr(0), scatter_at_this_collimator(true)
 {
 
 }
 
 Collimator::Collimator(const string& id, double len, double radLength) :
-	Drift(id, len), Xr(radLength), scatter_at_this_collimator(true)
+	Drift(id, len), material(nullptr), Xr(radLength), scatter_at_this_collimator(true)
 {
 
 }
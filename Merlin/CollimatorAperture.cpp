@@ -138,6 +138,12 @@ inline bool UnalignedCollimatorAperture::CheckWithinApertureBoundaries(double x,
 	return fabs(x1) * 2 < GetFullEntranceWidth() && fabs(y1) * 2 < GetFullEntranceHeight();
 }
 
+CollimatorApertureWithErrors::CollimatorApertureWithErrors(double w, double h, double t, double length, double x_off,
+	double y_off, double error) :
+	CollimatorAperture(w, h, t, length, x_off, y_off), ApertureError(error)
+{
+}
+
 inline bool CollimatorApertureWithErrors::CheckWithinApertureBoundaries(double x, double y, double z) const
 {
 	double x_off = (z * (x_offset_entry - x_offset_exit) / CollimatorLength) - x_offset_entry;
@@ -148,13 +154,28 @@ inline bool CollimatorApertureWithErrors::CheckWithinApertureBoundaries(double x
 
 	double x1 = ((x + x_off) * cosalpha) - ((y + y_off) * sinalpha);
 	double y1 = ((x + x_off) * sinalpha) + ((y + y_off) * cosalpha);
-	return fabs(x1) * 2 < x_jaw && fabs(y1) * 2 < y_jaw;
 	x1 += ApertureError * ((pow(z, 2) / CollimatorLength) - z);
 	y1 += ApertureError * ((pow(z, 2) / CollimatorLength) - z);
 
 	return fabs(x1) * 2 < x_jaw && fabs(y1) * 2 < y_jaw;
 }
 
+UnalignedCollimatorApertureWithErrors::UnalignedCollimatorApertureWithErrors(double w, double h, double t, double
+	length, double x_off, double y_off, double error) :
+	UnalignedCollimatorAperture(w, h, t, length, x_off, y_off), ApertureError(error)
+{
+}
+
+inline bool UnalignedCollimatorApertureWithErrors::CheckWithinApertureBoundaries(double x, double y, double z) const
+{
+	double x1 = ((x - x_offset_entry) * cosalpha) - ((y - y_offset_entry) * sinalpha);
+	double y1 = ((x - x_offset_entry) * sinalpha) + ((y - y_offset_entry) * cosalpha);
+	x1 += ApertureError * ((pow(z, 2) / CollimatorLength) - z);
+	y1 += ApertureError * ((pow(z, 2) / CollimatorLength) - z);
+
+	return fabs(x1) * 2 < GetFullEntranceWidth() && fabs(y1) * 2 < GetFullEntranceHeight();
+}
+
 OneSidedUnalignedCollimatorAperture::OneSidedUnalignedCollimatorAperture(double w, double h, double t, double length,
 	double x_off, double y_off, bool side) :
 	CollimatorAperture(w, h, t, length, x_off, y_off), JawSide(side)
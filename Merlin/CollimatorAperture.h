@@ -172,6 +172,14 @@ class CollimatorApertureWithErrors: public CollimatorAperture
 {
 	double ApertureError;
 
+public:
+	/**
+	 * Constructor
+	 * @param[in] error the jaw flatness error
+	 */
+	CollimatorApertureWithErrors(double w, double h, double t, double length, double x_offset_entry = 0.0, double
+		y_offset_entry = 0.0, double error = 0.0);
+
 	/**
 	 *  CollimatorApertureWithErrors override of Aperture member function CheckWithinApertureBoundaries()
 	 *  @param[in] x x-coord of particle
@@ -186,6 +194,14 @@ class UnalignedCollimatorApertureWithErrors: public UnalignedCollimatorAperture
 {
 	double ApertureError;
 
+public:
+	/**
+	 * Constructor
+	 * @param[in] error the jaw flatness error
+	 */
+	UnalignedCollimatorApertureWithErrors(double w, double h, double t, double length, double x_offset_entry = 0.0, double
+		y_offset_entry = 0.0, double error = 0.0);
+
 	/**
 	 *  UnalignedCollimatorApertureWithErrors override of Aperture member function CheckWithinApertureBoundaries()
 	 *  @param[in] x x-coord of particle
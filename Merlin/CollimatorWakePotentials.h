@@ -10,6 +10,7 @@
 
 #include "merlin_config.h"
 
+#include <atomic>
 #include "WakePotentials.h"
 
 /**
@@ -24,7 +25,7 @@ public:
 
 	CollimatorWakePotentials(int m, double rad = 0, double conduct = 0)
 	//take the radius and the conductivity out of WakePotentials
-		: WakePotentials(rad, conduct), nmodes(m)
+		: WakePotentials(rad, conduct), nmodes(m), id(NewId())
 	{
 	}
 
@@ -35,12 +36,30 @@ public:
 	virtual double Wlong(double s, int m) const = 0;
 	virtual double Wtrans(double s, int m) const = 0;
 
+	/**
+	 * A number unique to this object. Unlike its address it is not
+	 * reused when the object is deleted, so it can key tables of the
+	 * potentials.
+	 */
+	unsigned long GetId() const
+	{
+		return id;
+	}
+
 protected:
 
 	int nmodes;
 
 private:
 
+	unsigned long id;
+
+	static unsigned long NewId()
+	{
+		static std::atomic<unsigned long> next(0);
+		return ++next;
+	}
+
 	using WakePotentials::Wlong;
 	using WakePotentials::Wtrans;
 
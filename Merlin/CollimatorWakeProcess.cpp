@@ -32,207 +32,188 @@ using namespace PhysicalUnits;
 using namespace PhysicalConstants;
 using namespace ParticleTracking;
 
-namespace
-{
-inline double powd(double x, int y)
-{
-	double product(1);
-	for(int i = 1; i <= y; i++)
-	{
-		product *= x;
-	}
-	return product;
-}
-}
-
 namespace ParticleTracking
 {
 
 // Constructor
 
 CollimatorWakeProcess::CollimatorWakeProcess(int modes, int prio, size_t nb, double ns) :
-	WakeFieldProcess(prio, nb, ns)
+	WakeFieldProcess(prio, nb, ns), nmodes(modes), collimator_wake(nullptr)
 {
-	nmodes = modes;
-	Cm = new double*[modes + 1];
-	Sm = new double*[modes + 1];
-	wake_ct = new double*[modes + 1];
-	wake_st = new double*[modes + 1];
-	wake_cl = new double*[modes + 1];
-	wake_sl = new double*[modes + 1];
-	for(int i = 0; i <= nmodes; i++)
-	{
-		Cm[i] = new double[1000];
-		Sm[i] = new double[1000];
-		wake_ct[i] = new double[1000];
-		wake_st[i] = new double[1000];
-		wake_cl[i] = new double[1000];
-		wake_sl[i] = new double[1000];
-	}
+	sliceWidthSteps = 64;
 }
 
 // Destructor
 
 CollimatorWakeProcess::~CollimatorWakeProcess()
 {
-	for(int i = 0; i < nmodes; i++)
-	{
-		delete[] Cm[i];
-		delete[] Sm[i];
-		delete[] wake_ct[i];
-		delete[] wake_st[i];
-		delete[] wake_cl[i];
-		delete[] wake_sl[i];
-	}
+}
 
-	delete[] Cm;
-	delete[] Sm;
-	delete[] wake_ct;
-	delete[] wake_st;
-	delete[] wake_cl;
-	delete[] wake_sl;
+void CollimatorWakeProcess::ClearWakeTables()
+{
+	wakeTables.clear();
 }
 
-// Calculates the moments Cm for each slice
-double CollimatorWakeProcess::CalculateCm(int mode, int slice)
+// Calculates the moments Cm and Sm of every mode for each slice, the real and imaginary parts of (x + iy)^m summed
+// over the particles
+void CollimatorWakeProcess::CalculateModes()
 {
-	double x = 0;
-	for(ParticleBunch::iterator p = bunchSlices[slice]; p != bunchSlices[slice + 1]; p++)
+	Cm.assign(nmodes * nbins, 0.0);
+	Sm.assign(nmodes * nbins, 0.0);
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic, 8)
+#endif
+	for(int n = 0; n < int(nbins); n++)
 	{
-		double r = sqrt(powd(p->x(), 2) + powd(p->y(), 2));
-		double theta = atan2(p->y(), p->x());
-		x += powd(r, mode) * cos(mode * theta);
+		for(ParticleBunch::iterator p = bunchSlices[n]; p != bunchSlices[n + 1]; p++)
+		{
+			const double x = p->x();
+			const double y = p->y();
+			double c = x, s = y;
+			for(int m = 1; m <= nmodes; m++)
+			{
+				Cm[Index(m, n)] += c;
+				Sm[Index(m, n)] += s;
+				const double c1 = c * x - s * y;
+				s = c * y + s * x;
+				c = c1;
+			}
+		}
 	}
-	return x;
 }
 
-// Calculates  the moments Sm for each slice
-double CollimatorWakeProcess::CalculateSm(int mode, int slice)
+const CollimatorWakeProcess::WakeTable& CollimatorWakeProcess::GetWakeTable(double dz)
 {
-	double x = 0;
-	for(ParticleBunch::iterator p = bunchSlices[slice]; p != bunchSlices[slice + 1]; p++)
+	// dz takes one of a fixed set of values, see CalculateQdist()
+	WakeTable& table = wakeTables[std::make_pair(collimator_wake->GetId(), dz)];
+	if(table.nbins != nbins || table.wt.empty())
 	{
-		double r = sqrt(powd(p->x(), 2) + powd(p->y(), 2));
-		double theta = atan2(p->y(), p->x());
-		x += powd(r, mode) * sin(mode * theta);
+		table.nbins = nbins;
+		table.dz = dz;
+		table.wt.resize(nmodes * nbins);
+		table.wl.resize(nmodes * nbins);
+		for(int m = 1; m <= nmodes; m++)
+		{
+			for(size_t n = 0; n < nbins; n++)
+			{
+				table.wt[Index(m, n)] = collimator_wake->Wtrans(n * dz, m);
+				table.wl[Index(m, n)] = collimator_wake->Wlong(n * dz, m);
+			}
+		}
 	}
-	return x;
+	return table;
 }
 
 // Calculate the transverse wake with modes
 void CollimatorWakeProcess::CalculateWakeT(double dz, int currmode)
 {
-	vector<double> w(nbins);
-	for(size_t slice = 0; slice < nbins; slice++)
-	{
-		w[slice] = collimator_wake->Wtrans(slice * dz, currmode);
-	}
-
-	for(size_t slice = 0; slice < nbins; slice++)
+	const double* w = &GetWakeTable(dz).wt[Index(currmode, 0)];
+	const double* cm = &Cm[Index(currmode, 0)];
+	const double* sm = &Sm[Index(currmode, 0)];
+	double* wct = &wake_ct[Index(currmode, 0)];
+	double* wst = &wake_st[Index(currmode, 0)];
+	const int n = nbins;
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic, 16)
+#endif
+	for(int i = 0; i < n; i++)
 	{
-		int i = slice;
-		wake_ct[currmode][i] = 0;
-		wake_st[currmode][i] = 0;
-
-		for(size_t j = slice; j < bunchSlices.size() - 1; j++)
+		double ct = 0, st = 0;
+		for(int j = i; j < n; j++)
 		{
-			wake_ct[currmode][i] += w[j - i] * Cm[currmode][j];
-			wake_st[currmode][i] += w[j - i] * Sm[currmode][j];
+			ct += w[j - i] * cm[j];
+			st += w[j - i] * sm[j];
 		}
+		wct[i] = ct;
+		wst[i] = st;
 	}
 }
 
 // This function calculates the longitudinal wake with modes
 void CollimatorWakeProcess::CalculateWakeL(double dz, int currmode)
 {
-	vector<double> w(nbins);
-	for(size_t slice = 0; slice < nbins; slice++)
-	{
-		w[slice] = collimator_wake->Wlong(slice * dz, currmode);
-	}
-
-	for(size_t i = 0; i < nbins; i++)
+	const double* w = &GetWakeTable(dz).wl[Index(currmode, 0)];
+	const double* cm = &Cm[Index(currmode, 0)];
+	const double* sm = &Sm[Index(currmode, 0)];
+	double* wcl = &wake_cl[Index(currmode, 0)];
+	double* wsl = &wake_sl[Index(currmode, 0)];
+	const int n = nbins;
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic, 16)
+#endif
+	for(int i = 0; i < n; i++)
 	{
-		wake_cl[currmode][i] = 0;
-		wake_sl[currmode][i] = 0;
-		for(size_t j = i; j < bunchSlices.size() - 1; j++)
+		double cl = 0, sl = 0;
+		for(int j = i; j < n; j++)
 		{
-			wake_cl[currmode][i] += w[j - i] * Cm[currmode][j];
-			wake_sl[currmode][i] += w[j - i] * Sm[currmode][j];
+			cl += w[j - i] * cm[j];
+			sl += w[j - i] * sm[j];
 		}
+		wcl[i] = cl;
+		wsl[i] = sl;
 	}
 }
 
 void CollimatorWakeProcess::ApplyWakefield(double ds) //  int nmodes)
 {
-	collimator_wake = (CollimatorWakePotentials *) currentWake;
+	collimator_wake = static_cast<CollimatorWakePotentials*>(currentWake);
+	if(recalc)
+	{
+		Init();
+	}
+
+	CalculateModes();
+	wake_ct.resize(nmodes * nbins);
+	wake_st.resize(nmodes * nbins);
+	wake_cl.resize(nmodes * nbins);
+	wake_sl.resize(nmodes * nbins);
 	for(int m = 1; m <= nmodes; m++)
 	{
-		for(size_t n = 0; n < nbins; n++)
-		{
-			Cm[m][n] = CalculateCm(m, n);
-			Sm[m][n] = CalculateSm(m, n);
-		}
+		CalculateWakeT(dz, m);
+		CalculateWakeL(dz, m);
 	}
 
-	double wake_x, wake_y, wake_z;
 	double macrocharge = currentBunch->GetTotalCharge() / currentBunch->size();
 	double a0 = macrocharge * ElectronCharge * Volt;
 	a0 /= 4 * pi * FreeSpacePermittivity;
-	double p0 = currentBunch->GetReferenceMomentum();
+	const double p0 = currentBunch->GetReferenceMomentum();
 
-	if(recalc)
+	// Each particle is kicked by every mode in turn. The wakes are taken as constant across a slice.
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic, 8)
+#endif
+	for(int n = 0; n < int(nbins); n++)
 	{
-		Init();
-	}
-	double bload = 0;
+		for(ParticleBunch::iterator p = bunchSlices[n]; p != bunchSlices[n + 1]; p++)
+		{
+			const double x = p->x();
+			const double y = p->y();
 
-#define WAKE_GRADIENT(wake) ((wake[currmode][nslice + 1] - wake[currmode][nslice]) / dz)
+			// r^(m-1) cos((m-1) theta), r^(m-1) sin((m-1) theta)
+			double c = 1, s = 0;
+			for(int m = 1; m <= nmodes; m++)
+			{
+				const size_t k = Index(m, n);
+				const double cm = c * x - s * y;
+				const double sm = c * y + s * x;
 
-	for(int currmode = 1; currmode <= nmodes; currmode++)
-	{
-		CalculateWakeT(dz, currmode);
-		CalculateWakeL(dz, currmode);
-		double z = zmin;
-		int iparticle = 0;
+				const double wake_x = a0 * m * (c * wake_ct[k] + s * wake_st[k]);
+				const double wake_y = a0 * m * (c * wake_st[k] - s * wake_ct[k]);
+				const double wake_z = a0 * (cm * wake_cl[k] - sm * wake_sl[k]);
 
-		for(size_t nslice = 0; nslice < nbins; nslice++)
-		{
-			double g_ct = WAKE_GRADIENT(wake_ct);
-			double g_st = WAKE_GRADIENT(wake_st);
-			double g_cl = WAKE_GRADIENT(wake_cl);
-			double g_sl = WAKE_GRADIENT(wake_sl);
-			g_ct = g_st = g_cl = g_sl = 0;
-			int number_particles = 0;
-			for(ParticleBunch::iterator p = bunchSlices[nslice]; p != bunchSlices[nslice + 1]; p++)
-			{
-				number_particles++;
-				double r = sqrt(powd(p->x(), 2) + powd(p->y(), 2));
-				double theta = atan2(p->y(), p->x());
-				double zz = p->ct() - z;
-				double wxc = cos((currmode - 1) * theta) * (wake_ct[currmode][nslice] + g_ct * zz);
-				double wxs = sin((currmode - 1) * theta) * (wake_st[currmode][nslice] + g_st * zz);
-				double wys = cos((currmode - 1) * theta) * (wake_st[currmode][nslice] + g_st * zz);
-				double wyc = sin((currmode - 1) * theta) * (wake_ct[currmode][nslice] + g_ct * zz);
-				wake_x = currmode * powd(r, currmode - 1) * (wxc + wxs);
-				wake_y = currmode * powd(r, currmode - 1) * (wys - wyc);
-				wake_x *= a0;
-				wake_y *= a0;
-				double wzc = cos(currmode * theta) * (wake_cl[currmode][nslice] + g_cl * zz);
-				double wzs = sin(currmode * theta) * (wake_sl[currmode][nslice] + g_sl * zz);
-				wake_z = powd(r, currmode) * (wzc - wzs);
-				wake_z *= a0;
-				double ddp = -wake_z / p0;
+				const double ddp = -wake_z / p0;
 				p->dp() += ddp;
-				bload += ddp;
-				double dxp = inc_tw ? wake_x / p0 : 0;
-				double dyp = inc_tw ? wake_y / p0 : 0;
+				const double dxp = inc_tw ? wake_x / p0 : 0;
+				const double dyp = inc_tw ? wake_y / p0 : 0;
 				p->xp() = (p->xp() + dxp) / (1 + ddp);
-				double oldpy = p->yp();
 				p->yp() = (p->yp() + dyp) / (1 + ddp);
-			}
 
-			z += dz;
+				c = cm;
+				s = sm;
+			}
 		}
 	}
 }
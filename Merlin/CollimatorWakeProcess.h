@@ -8,6 +8,8 @@
 #ifndef _h_CollimatorWakeProcess
 #define _h_CollimatorWakeProcess
 
+#include <map>
+#include <utility>
 #include <vector>
 
 #include "merlin_config.h"
@@ -24,6 +26,14 @@ namespace ParticleTracking
  * Class for calculating the longitudinal and
  * transverse single-bunch wakefields
  * for Collimators with modes
+ *
+ * The modal moments of every slice, the tabulated wake potentials and
+ * the modal wakes are held in contiguous arrays, mode by mode. The
+ * moments of all modes are found in one pass over the particles, using
+ * powers of x + iy for r^m cos(m theta) and r^m sin(m theta). The wake
+ * potentials are tabulated once for each collimator and binning, and
+ * reused while the binning stays the same. With OpenMP the slices are
+ * spread across threads.
  */
 class CollimatorWakeProcess: public WakeFieldProcess
 {
@@ -36,26 +46,47 @@ public:
 	virtual void CalculateWakeT(double, int);
 	virtual void CalculateWakeL(double, int);
 
+	/**
+	 * Forget the tabulated wake potentials. They are kept for each
+	 * CollimatorWakePotentials object, by its id, and slice width
+	 * until this is called. The slice width is rounded up to one of
+	 * 64 steps in each factor of two, so a bunch whose length
+	 * changes slowly reuses the same few tables.
+	 */
+	void ClearWakeTables();
+
 private:
 
-	double CalculateSm(int, int);
-	double CalculateCm(int, int);
+	/// The wake potentials of a collimator at nbins slice separations
+	struct WakeTable
+	{
+		size_t nbins = 0;
+		double dz = 0;
+		std::vector<double> wt;
+		std::vector<double> wl;
+	};
+
+	void CalculateModes();
+	const WakeTable& GetWakeTable(double dz);
+
+	/// Offset of slice n of mode m (from 1 to nmodes) in the modal arrays
+	size_t Index(int m, size_t n) const
+	{
+		return (m - 1) * nbins + n;
+	}
 
 	int nmodes;
 
-//    double Cm[5][1000];
-	double** Cm;
-//    double Sm[5][1000];
-	double** Sm;
-//	double wake_s;
-//	double wake_c;
+	std::vector<double> Cm;
+	std::vector<double> Sm;
 
-	double** wake_sl;
-	double** wake_cl;
-	double** wake_ct;
-	double** wake_st;
+	std::vector<double> wake_sl;
+	std::vector<double> wake_cl;
+	std::vector<double> wake_ct;
+	std::vector<double> wake_st;
 
 	CollimatorWakePotentials* collimator_wake;
+	std::map<std::pair<unsigned long, double>, WakeTable> wakeTables;
 
 	using WakeFieldProcess::CalculateWakeT;
 	using WakeFieldProcess::CalculateWakeL;
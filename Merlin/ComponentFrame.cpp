@@ -13,6 +13,7 @@ ComponentFrame::~ComponentFrame()
 
 void ComponentFrame::Invalidate() const
 {
+	SetModified();
 }
 
 const string& ComponentFrame::GetType() const
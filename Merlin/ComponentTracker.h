@@ -313,6 +313,14 @@ public:
 		defIS = iset;
 	}
 
+	/**
+	 * The integrator set used by the default constructor
+	 */
+	static const ISetBase* GetDefaultIntegratorSet()
+	{
+		return defIS;
+	}
+
 protected:
 
 	static ISetBase* defIS;
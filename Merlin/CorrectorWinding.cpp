@@ -21,6 +21,7 @@ void CorrectorWinding::SetBx(double value)
 
 	double l = magnet->GetLength();
 	(*magnet).GetField().SetComponent(0, 0, value / l);
+	magnet->SetModified();
 }
 
 void CorrectorWinding::SetBy(double value)
@@ -32,6 +33,7 @@ void CorrectorWinding::SetBy(double value)
 
 	double l = magnet->GetLength();
 	(*magnet).GetField().SetComponent(0, value / l, 0);
+	magnet->SetModified();
 }
 
 double CorrectorWinding::GetBx() const
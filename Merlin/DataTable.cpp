@@ -63,7 +63,7 @@ size_t DataTable::AddRow()
 	return length - 1;
 }
 
-double DataTable::Get_d(const std::string col_name, size_t i) const
+double DataTable::Get_d(const std::string& col_name, size_t i) const
 {
 	location l = lookup.at(col_name);
 	if(l.type != 'd')
@@ -73,7 +73,7 @@ double DataTable::Get_d(const std::string col_name, size_t i) const
 	return data_d.at(l.pos).at(i);
 }
 
-int DataTable::Get_i(const std::string col_name, size_t i) const
+int DataTable::Get_i(const std::string& col_name, size_t i) const
 {
 	location l = lookup.at(col_name);
 	if(l.type != 'i')
@@ -83,7 +83,7 @@ int DataTable::Get_i(const std::string col_name, size_t i) const
 	return data_i.at(l.pos).at(i);
 }
 
-std::string DataTable::Get_s(const std::string col_name, size_t i) const
+std::string DataTable::Get_s(const std::string& col_name, size_t i) const
 {
 	location l = lookup.at(col_name);
 	if(l.type != 's')
@@ -93,7 +93,7 @@ std::string DataTable::Get_s(const std::string col_name, size_t i) const
 	return data_s.at(l.pos).at(i);
 }
 
-void DataTable::Set(const std::string col_name, size_t i, double x)
+void DataTable::Set(const std::string& col_name, size_t i, double x)
 {
 	location l = lookup.at(col_name);
 	if(l.type != 'd')
@@ -103,7 +103,7 @@ void DataTable::Set(const std::string col_name, size_t i, double x)
 	data_d.at(l.pos).at(i) = x;
 }
 
-void DataTable::Set(const std::string col_name, size_t i, int x)
+void DataTable::Set(const std::string& col_name, size_t i, int x)
 {
 	location l = lookup.at(col_name);
 	if(l.type != 'i')
@@ -113,7 +113,7 @@ void DataTable::Set(const std::string col_name, size_t i, int x)
 	data_i.at(l.pos).at(i) = x;
 }
 
-void DataTable::Set(const std::string col_name, size_t i, std::string x)
+void DataTable::Set(const std::string& col_name, size_t i, std::string x)
 {
 	location l = lookup.at(col_name);
 	if(l.type != 's')
@@ -123,7 +123,7 @@ void DataTable::Set(const std::string col_name, size_t i, std::string x)
 	data_s.at(l.pos).at(i) = x;
 }
 
-void DataTable::SetWithStr(const std::string col_name, size_t i, std::string x)
+void DataTable::SetWithStr(const std::string& col_name, size_t i, std::string x)
 {
 	location l = lookup.at(col_name);
 	switch(l.type)
@@ -142,7 +142,7 @@ void DataTable::SetWithStr(const std::string col_name, size_t i, std::string x)
 	}
 }
 
-std::string DataTable::GetAsStr(const std::string col_name, size_t i) const
+std::string DataTable::GetAsStr(const std::string& col_name, size_t i) const
 {
 	location l = lookup.at(col_name);
 	switch(l.type)
@@ -158,6 +158,75 @@ std::string DataTable::GetAsStr(const std::string col_name, size_t i) const
 	}
 }
 
+DataTable::ColumnHandle DataTable::GetColumnHandle(const std::string& col_name) const
+{
+	auto it = lookup.find(col_name);
+	if(it == lookup.end())
+	{
+		throw std::out_of_range("No column '" + col_name + "'");
+	}
+	return it->second;
+}
+
+void DataTable::HandleError(const ColumnHandle& c, char type, size_t i) const
+{
+	if(!c.valid())
+	{
+		throw std::out_of_range("Invalid column handle");
+	}
+	if(c.type != type)
+	{
+		throw WrongTypeException(std::string("Column handle is of type '") + c.type + "', not '" + type + "'");
+	}
+	throw std::out_of_range("Row " + std::to_string(i) + " out of range");
+}
+
+size_t DataTable::ColumnPos(const std::string& col_name, char type) const
+{
+	location l = lookup.at(col_name);
+	if(l.type != type)
+	{
+		throw WrongTypeException("Column '" + col_name + "' is not of type '" + type + "'");
+	}
+	return l.pos;
+}
+
+DataTableColumnView<double> DataTable::GetColumn_d(const std::string& col_name)
+{
+	std::vector<double>& v = data_d[ColumnPos(col_name, 'd')];
+	return DataTableColumnView<double>(v.data(), v.size());
+}
+
+DataTableColumnView<const double> DataTable::GetColumn_d(const std::string& col_name) const
+{
+	const std::vector<double>& v = data_d[ColumnPos(col_name, 'd')];
+	return DataTableColumnView<const double>(v.data(), v.size());
+}
+
+DataTableColumnView<int> DataTable::GetColumn_i(const std::string& col_name)
+{
+	std::vector<int>& v = data_i[ColumnPos(col_name, 'i')];
+	return DataTableColumnView<int>(v.data(), v.size());
+}
+
+DataTableColumnView<const int> DataTable::GetColumn_i(const std::string& col_name) const
+{
+	const std::vector<int>& v = data_i[ColumnPos(col_name, 'i')];
+	return DataTableColumnView<const int>(v.data(), v.size());
+}
+
+DataTableColumnView<std::string> DataTable::GetColumn_s(const std::string& col_name)
+{
+	std::vector<std::string>& v = data_s[ColumnPos(col_name, 's')];
+	return DataTableColumnView<std::string>(v.data(), v.size());
+}
+
+DataTableColumnView<const std::string> DataTable::GetColumn_s(const std::string& col_name) const
+{
+	const std::vector<std::string>& v = data_s[ColumnPos(col_name, 's')];
+	return DataTableColumnView<const std::string>(v.data(), v.size());
+}
+
 void DataTable::HeaderAddColumn(std::string col_name, char type)
 {
 	if(hlookup.count(col_name))
@@ -195,7 +264,7 @@ void DataTable::HeaderAddColumn(std::string col_name, char type)
 	hlookup[col_name].pos = position;
 }
 
-double DataTable::HeaderGet_d(const std::string col_name) const
+double DataTable::HeaderGet_d(const std::string& col_name) const
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 'd')
@@ -205,7 +274,7 @@ double DataTable::HeaderGet_d(const std::string col_name) const
 	return hdata_d.at(l.pos);
 }
 
-int DataTable::HeaderGet_i(const std::string col_name) const
+int DataTable::HeaderGet_i(const std::string& col_name) const
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 'i')
@@ -215,7 +284,7 @@ int DataTable::HeaderGet_i(const std::string col_name) const
 	return hdata_i.at(l.pos);
 }
 
-std::string DataTable::HeaderGet_s(const std::string col_name) const
+std::string DataTable::HeaderGet_s(const std::string& col_name) const
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 's')
@@ -225,7 +294,7 @@ std::string DataTable::HeaderGet_s(const std::string col_name) const
 	return hdata_s.at(l.pos);
 }
 
-void DataTable::HeaderSet(const std::string col_name, double x)
+void DataTable::HeaderSet(const std::string& col_name, double x)
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 'd')
@@ -235,7 +304,7 @@ void DataTable::HeaderSet(const std::string col_name, double x)
 	hdata_d.at(l.pos) = x;
 }
 
-void DataTable::HeaderSet(const std::string col_name, int x)
+void DataTable::HeaderSet(const std::string& col_name, int x)
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 'i')
@@ -245,7 +314,7 @@ void DataTable::HeaderSet(const std::string col_name, int x)
 	hdata_i.at(l.pos) = x;
 }
 
-void DataTable::HeaderSet(const std::string col_name, std::string x)
+void DataTable::HeaderSet(const std::string& col_name, std::string x)
 {
 	location l = hlookup.at(col_name);
 	if(l.type != 's')
@@ -255,7 +324,7 @@ void DataTable::HeaderSet(const std::string col_name, std::string x)
 	hdata_s.at(l.pos) = x;
 }
 
-void DataTable::HeaderSetWithStr(const std::string col_name, std::string x)
+void DataTable::HeaderSetWithStr(const std::string& col_name, std::string x)
 {
 	location l = hlookup.at(col_name);
 	switch(l.type)
@@ -274,7 +343,7 @@ void DataTable::HeaderSetWithStr(const std::string col_name, std::string x)
 	}
 }
 
-std::string DataTable::HeaderGetAsStr(const std::string col_name) const
+std::string DataTable::HeaderGetAsStr(const std::string& col_name) const
 {
 	location l = hlookup.at(col_name);
 	switch(l.type)
@@ -10,12 +10,62 @@
 
 #include <vector>
 #include <unordered_map>
+#include <utility>
 #include <string>
 #include <iostream>
 
 class DataTableRowIterator;
 class DataTableHeader;
 
+/** @brief Contiguous view of one typed DataTable column.
+ *
+ * Holds a pointer and a length, and can be used as a range:
+ *
+ *     for(double s : dt.GetColumn_d("S"))
+ */
+template<typename T>
+class DataTableColumnView
+{
+public:
+	DataTableColumnView() :
+		ptr(nullptr), n(0)
+	{
+	}
+	DataTableColumnView(T* p, size_t len) :
+		ptr(p), n(len)
+	{
+	}
+
+	size_t size() const
+	{
+		return n;
+	}
+	bool empty() const
+	{
+		return n == 0;
+	}
+	T* data() const
+	{
+		return ptr;
+	}
+	T* begin() const
+	{
+		return ptr;
+	}
+	T* end() const
+	{
+		return ptr + n;
+	}
+	T& operator[](size_t i) const
+	{
+		return ptr[i];
+	}
+
+private:
+	T* ptr;
+	size_t n;
+};
+
 class BadFormatException: public std::runtime_error
 {
 public:
@@ -48,18 +98,46 @@ public:
  * type, Set(), or typed versions can be used Set_d(), Set_i() and Set_s().
  *
  * DataTable can also hold a set of values, also with types, in its header.
+ *
+ * For loops over many rows, look the column up once with GetColumnHandle()
+ * and pass the handle to Get_d() etc., or use GetColumn_d() etc. to get a
+ * view of the whole column.
  */
 class DataTable
 {
-protected:
+	/// Fills the column storage directly when parsing
+	friend class DataTableReaderTFS;
+
+public:
 
-	/// Used to index the location of columns in DataTable.
+	/**
+	 * Used to index the location of columns in DataTable. Also returned by
+	 * GetColumnHandle() so that a column can be looked up once by name and
+	 * then accessed by row without hashing the name again.
+	 */
 	struct location
 	{
+		location() :
+			type(0), pos(0)
+		{
+		}
+		location(char t, size_t p) :
+			type(t), pos(p)
+		{
+		}
+
+		/// True if the handle refers to a column
+		bool valid() const
+		{
+			return type != 0;
+		}
+
 		char type;
 		size_t pos;
-
 	};
+	typedef location ColumnHandle;
+
+protected:
 
 	//data storage
 	std::vector<std::vector<double> > data_d;
@@ -93,40 +171,89 @@ public:
 
 	// get type in name
 	///Get double value by name and row.
-	double Get_d(const std::string col_name, size_t i) const;
+	double Get_d(const std::string& col_name, size_t i) const;
 	///Get integer value by name and row.
-	int Get_i(const std::string col_name, size_t i) const;
+	int Get_i(const std::string& col_name, size_t i) const;
 	///Get string value by name and row.
-	std::string Get_s(const std::string col_name, size_t i) const;
+	std::string Get_s(const std::string& col_name, size_t i) const;
 	///Get value by name and row converted to string.
-	std::string GetAsStr(const std::string col_name, size_t i) const;
+	std::string GetAsStr(const std::string& col_name, size_t i) const;
 
 	// overloaded
 	/// Set double value by name and row.
-	void Set(const std::string col_name, size_t i, double x);
+	void Set(const std::string& col_name, size_t i, double x);
 	/// Set integer value by name and row.
-	void Set(const std::string col_name, size_t i, int x);
+	void Set(const std::string& col_name, size_t i, int x);
 	/// Set string value by name and row.
-	void Set(const std::string col_name, size_t i, std::string x);
+	void Set(const std::string& col_name, size_t i, std::string x);
 
 	// set with type in name
 	/// Set double value by name and row.
-	void Set_d(const std::string col_name, size_t i, double x)
+	void Set_d(const std::string& col_name, size_t i, double x)
 	{
 		Set(col_name, i, x);
 	}
 	/// Set integer value by name and row.
-	void Set_i(const std::string col_name, size_t i, int x)
+	void Set_i(const std::string& col_name, size_t i, int x)
 	{
 		Set(col_name, i, x);
 	}
 	/// Set string value by name and row.
-	void Set_s(const std::string col_name, size_t i, std::string x)
+	void Set_s(const std::string& col_name, size_t i, std::string x)
 	{
 		Set(col_name, i, x);
 	}
 	/// Set value by name and row, converted from a string.
-	void SetWithStr(const std::string col_name, size_t i, std::string x);
+	void SetWithStr(const std::string& col_name, size_t i, std::string x);
+
+	/**
+	 * Look up a column once by name. Handles stay valid when rows are added
+	 * or other columns are added.
+	 */
+	ColumnHandle GetColumnHandle(const std::string& col_name) const;
+
+	/// Get double value by column handle and row.
+	double Get_d(const ColumnHandle& c, size_t i) const
+	{
+		return data_d[CheckHandle(c, 'd', i)][i];
+	}
+	/// Get integer value by column handle and row.
+	int Get_i(const ColumnHandle& c, size_t i) const
+	{
+		return data_i[CheckHandle(c, 'i', i)][i];
+	}
+	/// Get string value by column handle and row.
+	const std::string& Get_s(const ColumnHandle& c, size_t i) const
+	{
+		return data_s[CheckHandle(c, 's', i)][i];
+	}
+
+	/// Set double value by column handle and row.
+	void Set_d(const ColumnHandle& c, size_t i, double x)
+	{
+		data_d[CheckHandle(c, 'd', i)][i] = x;
+	}
+	/// Set integer value by column handle and row.
+	void Set_i(const ColumnHandle& c, size_t i, int x)
+	{
+		data_i[CheckHandle(c, 'i', i)][i] = x;
+	}
+	/// Set string value by column handle and row.
+	void Set_s(const ColumnHandle& c, size_t i, std::string x)
+	{
+		data_s[CheckHandle(c, 's', i)][i] = std::move(x);
+	}
+
+	/**
+	 * Contiguous views of whole columns, for loops over every row. Views
+	 * are invalidated by AddRow() and AddColumn().
+	 */
+	DataTableColumnView<double> GetColumn_d(const std::string& col_name);
+	DataTableColumnView<const double> GetColumn_d(const std::string& col_name) const;
+	DataTableColumnView<int> GetColumn_i(const std::string& col_name);
+	DataTableColumnView<const int> GetColumn_i(const std::string& col_name) const;
+	DataTableColumnView<std::string> GetColumn_s(const std::string& col_name);
+	DataTableColumnView<const std::string> GetColumn_s(const std::string& col_name) const;
 
 	/** @brief Variadic method for setting a whole row.
 	 *
@@ -166,40 +293,40 @@ public:
 
 	// header access
 	/// Get double value from header by name.
-	double HeaderGet_d(const std::string col_name) const;
+	double HeaderGet_d(const std::string& col_name) const;
 	/// Get integer value from header by name.
-	int HeaderGet_i(const std::string col_name) const;
+	int HeaderGet_i(const std::string& col_name) const;
 	/// Get string value from header by name.
-	std::string HeaderGet_s(const std::string col_name) const;
+	std::string HeaderGet_s(const std::string& col_name) const;
 	/// Get value from header by name as string.
-	std::string HeaderGetAsStr(const std::string col_name) const;
+	std::string HeaderGetAsStr(const std::string& col_name) const;
 
 	// overloaded
 	/// Set double header value.
-	void HeaderSet(const std::string col_name, double x);
+	void HeaderSet(const std::string& col_name, double x);
 	/// Set integer header value.
-	void HeaderSet(const std::string col_name, int x);
+	void HeaderSet(const std::string& col_name, int x);
 	/// Set string header value.
-	void HeaderSet(const std::string col_name, std::string x);
+	void HeaderSet(const std::string& col_name, std::string x);
 
 	// get type in name
 	/// Set double header value.
-	void HeaderSet_d(const std::string col_name, double x)
+	void HeaderSet_d(const std::string& col_name, double x)
 	{
 		HeaderSet(col_name, x);
 	}
 	/// Set integer header value.
-	void HeaderSet_i(const std::string col_name, int x)
+	void HeaderSet_i(const std::string& col_name, int x)
 	{
 		HeaderSet(col_name, x);
 	}
 	/// Set string header value.
-	void HeaderSet_s(const std::string col_name, std::string x)
+	void HeaderSet_s(const std::string& col_name, std::string x)
 	{
 		HeaderSet(col_name, x);
 	}
 	/// Set value from header by name as string.
-	void HeaderSetWithStr(const std::string col_name, std::string x);
+	void HeaderSetWithStr(const std::string& col_name, std::string x);
 
 	/// Return the length of table, i.e. number of rows.
 	size_t Length() const
@@ -218,6 +345,20 @@ public:
 	bool HeaderHasKey(std::string col_name, char type) const;
 
 private:
+	/// Check the handle type and row, returning the position of the column
+	size_t CheckHandle(const ColumnHandle& c, char type, size_t i) const
+	{
+		if(c.type != type || i >= length)
+		{
+			HandleError(c, type, i);
+		}
+		return c.pos;
+	}
+	[[noreturn]] void HandleError(const ColumnHandle& c, char type, size_t i) const;
+
+	/// Position of a named column, checking its type
+	size_t ColumnPos(const std::string& col_name, char type) const;
+
 	/// See AddRow()
 	template<typename T, typename ... Args>
 	void AddRowN(size_t col_n, size_t row_n, T x, Args ... arg);
@@ -265,23 +406,42 @@ public:
 	{
 	}
 
-	double Get_d(const std::string col_name) const
+	double Get_d(const std::string& col_name) const
 	{
 		return dt->Get_d(col_name, pos);
 	}
-	int Get_i(const std::string col_name) const
+	int Get_i(const std::string& col_name) const
 	{
 		return dt->Get_i(col_name, pos);
 	}
-	std::string Get_s(const std::string col_name) const
+	std::string Get_s(const std::string& col_name) const
 	{
 		return dt->Get_s(col_name, pos);
 	}
-	std::string GetAsStr(const std::string col_name) const
+	std::string GetAsStr(const std::string& col_name) const
 	{
 		return dt->GetAsStr(col_name, pos);
 	}
 
+	double Get_d(const DataTable::ColumnHandle& c) const
+	{
+		return dt->Get_d(c, pos);
+	}
+	int Get_i(const DataTable::ColumnHandle& c) const
+	{
+		return dt->Get_i(c, pos);
+	}
+	const std::string& Get_s(const DataTable::ColumnHandle& c) const
+	{
+		return dt->Get_s(c, pos);
+	}
+
+	/// Row number
+	size_t Index() const
+	{
+		return pos;
+	}
+
 private:
 	const DataTable * dt;
 	size_t pos;
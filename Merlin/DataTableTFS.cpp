@@ -5,22 +5,423 @@
  * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
  */
 
-#include <iostream>
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
 #include <fstream>
-#include <string>
 #include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <string>
+
+#ifndef _MSC_VER
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 #include "DataTableTFS.h"
 
-DataTableReaderTFS::DataTableReaderTFS(std::string filename)
+namespace
+{
+
+/**
+ * Contents of a file or stream in memory. Files are memory mapped where
+ * possible.
+ */
+class TextBuffer
+{
+public:
+	explicit TextBuffer(const std::string& filename) :
+		mapped(nullptr), length(0)
+	{
+#ifndef _MSC_VER
+		int fd = open(filename.c_str(), O_RDONLY);
+		if(fd >= 0)
+		{
+			struct stat st;
+			if(fstat(fd, &st) == 0 && st.st_size > 0)
+			{
+				void* m = mmap(nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+				if(m != MAP_FAILED)
+				{
+					mapped = static_cast<const char*>(m);
+					length = st.st_size;
+					madvise(m, length, MADV_SEQUENTIAL);
+				}
+			}
+			close(fd);
+		}
+		if(mapped)
+		{
+			return;
+		}
+#endif
+		std::ifstream f(filename, std::ios::binary);
+		ReadStream(f);
+	}
+
+	explicit TextBuffer(std::istream& is) :
+		mapped(nullptr), length(0)
+	{
+		ReadStream(is);
+	}
+
+	~TextBuffer()
+	{
+#ifndef _MSC_VER
+		if(mapped)
+		{
+			munmap(const_cast<char*>(mapped), length);
+		}
+#endif
+	}
+
+	const char* begin() const
+	{
+		return mapped ? mapped : contents.data();
+	}
+	const char* end() const
+	{
+		return begin() + (mapped ? length : contents.size());
+	}
+
+private:
+	void ReadStream(std::istream& is)
+	{
+		contents.assign(std::istreambuf_iterator<char>(is), std::istreambuf_iterator<char>());
+	}
+
+	const char* mapped;
+	size_t length;
+	std::string contents;
+
+	TextBuffer(const TextBuffer&) = delete;
+	TextBuffer& operator=(const TextBuffer&) = delete;
+};
+
+inline bool is_space(char c)
+{
+	return c == ' ' || c == '\t' || c == '\r' || c == '\f' || c == '\v' || c == '\n';
+}
+
+/**
+ * Find the next token in [q, eol), splitting on whitespace unless quoted,
+ * and advance q past it. Returns false if there are no more tokens. If the
+ * token contained quotes the unquoted text is copied into scratch.
+ */
+inline bool next_token(const char*& q, const char* eol, const char*& tb, const char*& te, std::string& scratch)
+{
+	while(q < eol && is_space(*q))
+	{
+		q++;
+	}
+	if(q == eol)
+	{
+		return false;
+	}
+
+	const char* start = q;
+	bool double_quote_on = false;
+	bool has_quote = false;
+	while(q < eol && (double_quote_on || !is_space(*q)))
+	{
+		if(*q == '"')
+		{
+			double_quote_on = !double_quote_on;
+			has_quote = true;
+		}
+		q++;
+	}
+
+	if(!has_quote)
+	{
+		tb = start;
+		te = q;
+		return true;
+	}
+
+	scratch.clear();
+	for(const char* c = start; c < q; c++)
+	{
+		if(*c != '"')
+		{
+			scratch += *c;
+		}
+	}
+	tb = scratch.data();
+	te = tb + scratch.size();
+	return true;
+}
+
+/**
+ * Parse a decimal floating point number that fits the exact fast path:
+ * at most 19 significant digits, mantissa below 2^53 and a power of ten
+ * that is exactly representable. Returns false for anything else, which
+ * is then handed to strtod. Results are correctly rounded, as strtod.
+ */
+inline bool parse_double_fast(const char* p, const char* e, double& out)
+{
+	static const double pow10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14,
+								   1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+	bool negative = false;
+	if(p < e && (*p == '-' || *p == '+'))
+	{
+		negative = (*p == '-');
+		p++;
+	}
+
+	uint64_t mantissa = 0;
+	int digits = 0;
+	int exp10 = 0;
+	bool any_digits = false;
+
+	for(; p < e && *p >= '0' && *p <= '9'; p++)
+	{
+		any_digits = true;
+		if(mantissa == 0 && *p == '0')
+		{
+			continue;
+		}
+		if(++digits > 19)
+		{
+			return false;
+		}
+		mantissa = mantissa * 10 + (*p - '0');
+	}
+	if(p < e && *p == '.')
+	{
+		for(p++; p < e && *p >= '0' && *p <= '9'; p++)
+		{
+			any_digits = true;
+			exp10--;
+			if(mantissa == 0 && *p == '0')
+			{
+				continue;
+			}
+			if(++digits > 19)
+			{
+				return false;
+			}
+			mantissa = mantissa * 10 + (*p - '0');
+		}
+	}
+	if(!any_digits)
+	{
+		return false;
+	}
+	if(p < e && (*p == 'e' || *p == 'E'))
+	{
+		p++;
+		bool exp_negative = false;
+		if(p < e && (*p == '-' || *p == '+'))
+		{
+			exp_negative = (*p == '-');
+			p++;
+		}
+		if(p == e)
+		{
+			return false;
+		}
+		int x = 0;
+		for(; p < e && *p >= '0' && *p <= '9'; p++)
+		{
+			if(x > 10000)
+			{
+				return false;
+			}
+			x = x * 10 + (*p - '0');
+		}
+		exp10 += exp_negative ? -x : x;
+	}
+	if(p != e)
+	{
+		return false;
+	}
+
+	if(mantissa == 0)
+	{
+		out = negative ? -0.0 : 0.0;
+		return true;
+	}
+	if(mantissa > (uint64_t(1) << 53) || exp10 < -22 || exp10 > 22)
+	{
+		return false;
+	}
+
+	double v = static_cast<double>(mantissa);
+	v = exp10 < 0 ? v / pow10[-exp10] : v * pow10[exp10];
+	out = negative ? -v : v;
+	return true;
+}
+
+/**
+ * Parse a double. buffer_end is the end of the whole buffer, used to check
+ * that strtod can safely run on the text in place.
+ */
+inline double parse_double(const char* tb, const char* te, const char* buffer_end)
 {
-	inf = std::make_shared<std::ifstream>(filename);
-	if(!inf->good())
+	double v;
+	if(parse_double_fast(tb, te, v))
+	{
+		return v;
+	}
+	if(te < buffer_end && is_space(*te))
+	{
+		char* stop;
+		errno = 0;
+		v = strtod(tb, &stop);
+		if(stop == te && errno == 0)
+		{
+			return v;
+		}
+	}
+	// same result and errors as the stream based reader
+	return std::stod(std::string(tb, te));
+}
+
+inline int parse_int(const char* tb, const char* te)
+{
+	const char* p = tb;
+	bool negative = false;
+	if(p < te && (*p == '-' || *p == '+'))
+	{
+		negative = (*p == '-');
+		p++;
+	}
+	long v = 0;
+	const char* digits = p;
+	for(; p < te && *p >= '0' && *p <= '9' && p - digits < 9; p++)
+	{
+		v = v * 10 + (*p - '0');
+	}
+	if(p != te || p == digits)
+	{
+		return std::stoi(std::string(tb, te));
+	}
+	return negative ? -v : v;
+}
+
+/// Typed column values for part of a table
+struct ColumnChunk
+{
+	std::vector<std::vector<double> > data_d;
+	std::vector<std::vector<int> > data_i;
+	std::vector<std::vector<std::string> > data_s;
+	size_t rows = 0;
+};
+
+/**
+ * Parse whole lines from [p, e) into chunk. Each column has a type and a
+ * position in the typed vectors of chunk.
+ */
+void parse_body(const char* p, const char* e, const char* buffer_end, const std::vector<char>& types,
+	const std::vector<size_t>& positions, size_t row_estimate, ColumnChunk& chunk)
+{
+	for(auto& c : chunk.data_d)
+	{
+		c.reserve(row_estimate);
+	}
+	for(auto& c : chunk.data_i)
+	{
+		c.reserve(row_estimate);
+	}
+	for(auto& c : chunk.data_s)
+	{
+		c.reserve(row_estimate);
+	}
+
+	const size_t ncols = types.size();
+	std::string scratch;
+	while(p < e)
+	{
+		const char* eol = static_cast<const char*>(memchr(p, '\n', e - p));
+		if(!eol)
+		{
+			eol = e;
+		}
+
+		const char* q = p;
+		const char *tb, *te;
+		size_t col = 0;
+		while(next_token(q, eol, tb, te, scratch))
+		{
+			if(col == ncols)
+			{
+				throw BadFormatException("Row contains more values than columns");
+			}
+			switch(types[col])
+			{
+			case 'd':
+				chunk.data_d[positions[col]].push_back(parse_double(tb, te, buffer_end));
+				break;
+			case 'i':
+				chunk.data_i[positions[col]].push_back(parse_int(tb, te));
+				break;
+			default:
+				chunk.data_s[positions[col]].emplace_back(tb, te);
+			}
+			col++;
+		}
+
+		if(col != 0)
+		{
+			if(col != ncols)
+			{
+				throw BadFormatException("Row does not contain correct number of values");
+			}
+			chunk.rows++;
+		}
+		p = eol + 1;
+	}
+}
+
+template<class T>
+void append_columns(std::vector<std::vector<T> >& dest, std::vector<std::vector<T> >& src)
+{
+	for(size_t c = 0; c < dest.size(); c++)
+	{
+		if(dest[c].empty())
+		{
+			dest[c].swap(src[c]);
+		}
+		else
+		{
+			dest[c].insert(dest[c].end(), std::make_move_iterator(src[c].begin()),
+				std::make_move_iterator(src[c].end()));
+		}
+	}
+}
+
+/// Get the next line in [p, e), advancing p past it
+std::string next_line(const char*& p, const char* e)
+{
+	const char* eol = static_cast<const char*>(memchr(p, '\n', e - p));
+	if(!eol)
+	{
+		eol = e;
+	}
+	std::string line(p, eol);
+	p = (eol < e) ? eol + 1 : e;
+	return line;
+}
+
+} // end of anonymous namespace
+
+DataTableReaderTFS::DataTableReaderTFS(std::string filename) :
+	in(nullptr), filename(filename), chunk_size(default_chunk_size)
+{
+	std::ifstream test(filename);
+	if(!test.good())
 	{
 		std::cerr << "Could not open file " << filename << std::endl;
 		exit(1);
 	}
-	in = inf.get();
 }
 
 static char type_conv(std::string s)
@@ -84,17 +485,20 @@ static std::vector<std::string> split_line(std::string line)
 
 std::unique_ptr<DataTable> DataTableReaderTFS::Read()
 {
+	std::unique_ptr<TextBuffer> buffer(in ? new TextBuffer(*in) : new TextBuffer(filename));
+	const char* p = buffer->begin();
+	const char* const e = buffer->end();
+
 	std::unique_ptr<DataTable> dt(new DataTable);
 	std::vector<std::string> col_names;
 	std::vector<char> col_types;
-	std::string line;
 	std::vector<std::string> words;
 
 	// Read header
 	// Lines start with "@". Ends when line starts with "*"
-	while(getline(*in, line))
+	while(p < e)
 	{
-		words = split_line(line);
+		words = split_line(next_line(p, e));
 		if(words.size() == 0)
 		{
 			continue;
@@ -113,7 +517,7 @@ std::unique_ptr<DataTable> DataTableReaderTFS::Read()
 	}
 
 	//Read column names
-	if(words[0] != "*")
+	if(words.empty() || words[0] != "*")
 	{
 		throw BadFormatException("Expected line starting with '*' or '@'");
 	}
@@ -123,9 +527,8 @@ std::unique_ptr<DataTable> DataTableReaderTFS::Read()
 	}
 
 	//Read column types
-	getline(*in, line);
-	words = split_line(line);
-	if(words[0] != "$")
+	words = split_line(next_line(p, e));
+	if(words.empty() || words[0] != "$")
 	{
 		throw BadFormatException("Expected line starting with '$'");
 	}
@@ -139,41 +542,82 @@ std::unique_ptr<DataTable> DataTableReaderTFS::Read()
 		throw BadFormatException("Mismatched length of column names and types");
 	}
 
+	std::vector<size_t> positions;
+	for(size_t c = 0; c < col_names.size(); c++)
 	{
-		auto name = col_names.begin();
-		auto type = col_types.begin();
-		while(name != col_names.end())
-		{
-			dt->AddColumn(*name, *type);
-			++name;
-			++type;
-		}
+		dt->AddColumn(col_names[c], col_types[c]);
+		positions.push_back(dt->lookup[col_names[c]].pos);
 	}
 
 	// Read body
-	while(getline(*in, line))
+	// Split into chunks of whole lines. Each chunk is parsed into its own
+	// column vectors, which are then appended in order.
+	const size_t body_size = e - p;
+	size_t nchunks = 1;
+	if(chunk_size > 0 && body_size > chunk_size)
 	{
-		words = split_line(line);
-		if(words.size() == 0)
+		nchunks = (body_size + chunk_size - 1) / chunk_size;
+	}
+
+	std::vector<const char*> bounds(nchunks + 1, e);
+	bounds[0] = p;
+	for(size_t n = 1; n < nchunks; n++)
+	{
+		const char* b = p + n * chunk_size;
+		if(b < bounds[n - 1])
 		{
-			continue;
+			b = bounds[n - 1];
 		}
+		const char* eol = static_cast<const char*>(memchr(b, '\n', e - b));
+		bounds[n] = eol ? eol + 1 : e;
+	}
+
+	// estimate rows from the mean length of the first lines, to reserve column storage; the estimate is
+	// capped at one row per min_line_length bytes in case the sampled lines are unusually short
+	const size_t sample_lines = 16;
+	const size_t min_line_length = 16;
+	size_t nsampled = 0;
+	const char* sample_end = p;
+	while(nsampled < sample_lines && sample_end < e)
+	{
+		const char* eol = static_cast<const char*>(memchr(sample_end, '\n', e - sample_end));
+		sample_end = eol ? eol + 1 : e;
+		nsampled++;
+	}
+	const size_t line_length = std::max(nsampled ? size_t(sample_end - p) / nsampled : 0, min_line_length);
 
-		if(col_names.size() != col_types.size())
+	std::vector<ColumnChunk> chunks(nchunks);
+	std::vector<std::exception_ptr> errors(nchunks);
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic) if(nchunks > 1)
+#endif
+	for(size_t n = 0; n < nchunks; n++)
+	{
+		ColumnChunk& chunk = chunks[n];
+		chunk.data_d.resize(dt->data_d.size());
+		chunk.data_i.resize(dt->data_i.size());
+		chunk.data_s.resize(dt->data_s.size());
+		try
 		{
-			throw BadFormatException("Row does not contain correct number of values");
+			size_t row_estimate = (bounds[n + 1] - bounds[n]) / line_length + 1;
+			parse_body(bounds[n], bounds[n + 1], e, col_types, positions, row_estimate, chunk);
 		}
-		size_t rown = dt->AddRow();
+		catch(...)
 		{
-			auto name = col_names.begin();
-			auto word = words.begin();
-			while(name != col_names.end())
-			{
-				dt->SetWithStr(*name, rown, *word);
-				++name;
-				++word;
-			}
+			errors[n] = std::current_exception();
+		}
+	}
+
+	for(size_t n = 0; n < nchunks; n++)
+	{
+		if(errors[n])
+		{
+			std::rethrow_exception(errors[n]);
 		}
+		append_columns(dt->data_d, chunks[n].data_d);
+		append_columns(dt->data_i, chunks[n].data_i);
+		append_columns(dt->data_s, chunks[n].data_s);
+		dt->length += chunks[n].rows;
 	}
 
 	return dt;
@@ -18,13 +18,21 @@
 /** @brief Read a DataTable from a TFS file
  *
  * For example to read file generated with MadX
+ *
+ * Files opened by name are memory mapped and parsed in place, with values
+ * appended straight into the typed column storage of the new DataTable.
+ * Streams are read into memory first and then parsed the same way.
+ *
+ * Tables bigger than the chunk size (4 MiB by default) are split into
+ * chunks of whole lines, which are parsed in parallel when Merlin++ is
+ * built with OpenMP. The result is identical to a serial read.
  */
 class DataTableReaderTFS: public DataTableReader
 {
 public:
 	/// Read from an istream, e.g. an already opened file
 	DataTableReaderTFS(std::istream *in) :
-		in(in)
+		in(in), chunk_size(default_chunk_size)
 	{
 	}
 	/// Open a file to read
@@ -33,9 +41,21 @@ public:
 	/// Read the file, returning a new DataTable
 	virtual std::unique_ptr<DataTable> Read() override;
 
+	/**
+	 * Set the size in bytes of the chunks the table body is split into for
+	 * parallel parsing. Zero parses the body in a single pass.
+	 */
+	void SetChunkSize(size_t bytes)
+	{
+		chunk_size = bytes;
+	}
+
+	static const size_t default_chunk_size = 4 << 20;
+
 private:
-	std::istream *in; // either a passed pointer, or pointer to the opened file
-	std::shared_ptr<std::istream> inf; // if we opened the file, this ensures that it is closed
+	std::istream *in; // stream to read, nullptr when reading filename
+	std::string filename;
+	size_t chunk_size;
 };
 
 /** @brief Write a DataTable to a TFS file
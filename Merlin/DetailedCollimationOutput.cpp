@@ -14,6 +14,10 @@ DetailedCollimationOutput::DetailedCollimationOutput()
 {
 }
 
+DetailedCollimationOutput::~DetailedCollimationOutput()
+{
+}
+
 void DetailedCollimationOutput::Dispose(AcceleratorComponent& currcomponent, double pos, Particle& particle, int turn)
 {
 	if(currentComponent != &currcomponent)
@@ -0,0 +1,207 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "ClosedOrbit.h"
+#include "DynamicAperture.h"
+#include "ParticleBunch.h"
+#include "ParticleTracker.h"
+
+using namespace std;
+using namespace ParticleTracking;
+
+DynamicAperture::DynamicAperture(AcceleratorModel* aModel, double refMomentum) :
+	theModel(aModel), p0(refMomentum), nturns(1000), obspnt(0), lossRadius(0.1), amin(0), amax(0.01), tol(1.0e-5)
+{
+}
+
+void DynamicAperture::SetTurns(int turns)
+{
+	nturns = turns;
+}
+
+void DynamicAperture::SetObservationPoint(int n)
+{
+	obspnt = n;
+}
+
+void DynamicAperture::SetLossRadius(double r)
+{
+	lossRadius = r;
+}
+
+void DynamicAperture::SetAmplitudeRange(double a1, double a2)
+{
+	amin = a1;
+	amax = a2;
+}
+
+void DynamicAperture::SetTolerance(double t)
+{
+	tol = t;
+}
+
+void DynamicAperture::Scan(const vector<double>& angles, const vector<double>& dps)
+{
+	boundary.clear();
+	trials.clear();
+	lineOrbits.clear();
+
+	// each line starts from the closed orbit for its momentum offset
+	for(double dp : dps)
+	{
+		PSvector co(0);
+		co.dp() = dp;
+		ClosedOrbit finder(theModel, p0);
+		finder.TransverseOnly(true);
+		finder.FindClosedOrbit(co, obspnt);
+		for(double angle : angles)
+		{
+			lineOrbits.push_back(co);
+			boundary.push_back({angle, dp, 0});
+		}
+	}
+	const size_t nlines = lineOrbits.size();
+
+	// the ends of each line
+	vector<size_t> lines(nlines);
+	for(size_t n = 0; n < nlines; n++)
+	{
+		lines[n] = n;
+	}
+	vector<double> lo(nlines, amin);
+	vector<double> hi(nlines, amax);
+	vector<bool> open(nlines);
+
+	vector<int> turns = Track(lines, lo);
+	lines.clear();
+	for(size_t n = 0; n < nlines; n++)
+	{
+		open[n] = turns[n] == nturns;
+		if(open[n])
+		{
+			lines.push_back(n);
+		}
+		else
+		{
+			lo[n] = 0;
+		}
+	}
+
+	turns = Track(lines, vector<double>(lines.size(), amax));
+	for(size_t k = 0; k < lines.size(); k++)
+	{
+		if(turns[k] == nturns)
+		{
+			lo[lines[k]] = amax;
+			open[lines[k]] = false;
+		}
+	}
+
+	// bisection of the lines still open, one particle per line at each step
+	while(true)
+	{
+		lines.clear();
+		vector<double> mid;
+		for(size_t n = 0; n < nlines; n++)
+		{
+			if(open[n] && hi[n] - lo[n] > tol)
+			{
+				lines.push_back(n);
+				mid.push_back((lo[n] + hi[n]) / 2);
+			}
+		}
+		if(lines.empty())
+		{
+			break;
+		}
+
+		turns = Track(lines, mid);
+		for(size_t k = 0; k < lines.size(); k++)
+		{
+			if(turns[k] == nturns)
+			{
+				lo[lines[k]] = mid[k];
+			}
+			else
+			{
+				hi[lines[k]] = mid[k];
+			}
+		}
+	}
+
+	for(size_t n = 0; n < nlines; n++)
+	{
+		boundary[n].amplitude = lo[n];
+	}
+}
+
+vector<int> DynamicAperture::Track(const vector<size_t>& lines, const vector<double>& amplitudes)
+{
+	vector<int> turns(lines.size(), nturns);
+	if(lines.empty())
+	{
+		return turns;
+	}
+
+	ParticleBunch bunch(p0, 1.0);
+	for(size_t k = 0; k < lines.size(); k++)
+	{
+		const Boundary& line = boundary[lines[k]];
+		Particle p = lineOrbits[lines[k]];
+		p.x() += amplitudes[k] * cos(line.angle);
+		p.y() += amplitudes[k] * sin(line.angle);
+		p.id() = k;
+		bunch.push_back(p);
+	}
+
+	ParticleTracker tracker(theModel->GetRing(obspnt), &bunch, false);
+	const double r = lossRadius;
+	for(int turn = 1; turn <= nturns && bunch.size() != 0; turn++)
+	{
+		tracker.Track(&bunch);
+
+		// retire the particles lost on this turn
+		PSvectorArray& p = bunch.GetParticles();
+		PSvectorArray::iterator last = remove_if(p.begin(), p.end(), [&](const Particle& q) {
+			const bool lost = !(fabs(q.x()) <= r && fabs(q.y()) <= r);
+			if(lost)
+			{
+				turns[static_cast<size_t>(q.id())] = turn - 1;
+			}
+			return lost;
+		});
+		p.erase(last, p.end());
+	}
+
+	for(size_t k = 0; k < lines.size(); k++)
+	{
+		const Boundary& line = boundary[lines[k]];
+		trials.push_back({line.angle, line.dp, amplitudes[k], turns[k]});
+	}
+	return turns;
+}
+
+void DynamicAperture::OutputBoundary(std::ostream& os) const
+{
+	for(const Boundary& b : boundary)
+	{
+		os << std::setw(16) << b.angle << std::setw(16) << b.dp << std::setw(16) << b.amplitude << std::endl;
+	}
+}
+
+void DynamicAperture::OutputTrials(std::ostream& os) const
+{
+	for(const Trial& t : trials)
+	{
+		os << std::setw(16) << t.angle << std::setw(16) << t.dp << std::setw(16) << t.amplitude;
+		os << std::setw(10) << t.turns << std::endl;
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef DynamicAperture_h
+#define DynamicAperture_h 1
+
+#include "merlin_config.h"
+#include <ostream>
+#include <vector>
+#include "AcceleratorModel.h"
+#include "PSTypes.h"
+
+using namespace ParticleTracking;
+
+/**
+ *	Dynamic aperture scan over amplitude, angle and momentum offset.
+ *
+ *	For each angle theta and momentum offset dp, particles start at
+ *	x = A cos(theta), y = A sin(theta) from the closed orbit for dp
+ *	at the observation point. The boundary amplitude is found by
+ *	bisection between the minimum and maximum amplitudes, to the
+ *	set tolerance.
+ *
+ *	At each bisection step one particle for every (theta, dp) line
+ *	is tracked together in one bunch, so the lines share the bunch
+ *	tracking, which is parallel when built with ENABLE_OPENMP. A
+ *	particle is removed from the bunch on the turn its horizontal
+ *	or vertical offset exceeds the loss radius, and tracking stops
+ *	when all are lost.
+ */
+class DynamicAperture
+{
+public:
+	/// Boundary of stable motion along one (theta, dp) line
+	struct Boundary
+	{
+		double angle;
+		double dp;
+		double amplitude;   ///< largest stable amplitude found
+	};
+
+	/// A tracked particle and the number of turns it survived
+	struct Trial
+	{
+		double angle;
+		double dp;
+		double amplitude;
+		int turns;
+	};
+
+	DynamicAperture(AcceleratorModel* aModel, double refMomentum);
+
+	void SetTurns(int turns);                           // default: 1000
+	void SetObservationPoint(int n);                    // default: 0
+	void SetLossRadius(double r);                       // default: 0.1 m
+	void SetAmplitudeRange(double amin, double amax);   // default: 0 to 0.01 m
+	void SetTolerance(double tol);                      // default: 1.0e-5 m
+
+	/**
+	 *	Finds the boundary for every combination of angle and
+	 *	momentum offset. A line whose minimum amplitude is lost has
+	 *	a boundary of zero, and one whose maximum amplitude survives
+	 *	has a boundary of the maximum amplitude.
+	 */
+	void Scan(const std::vector<double>& angles, const std::vector<double>& dps);
+
+	const std::vector<Boundary>& GetBoundary() const
+	{
+		return boundary;
+	}
+
+	const std::vector<Trial>& GetTrials() const
+	{
+		return trials;
+	}
+
+	/// Writes one row per line: angle, dp, boundary amplitude
+	void OutputBoundary(std::ostream& os) const;
+
+	/// Writes one row per tracked particle: angle, dp, amplitude, turns survived
+	void OutputTrials(std::ostream& os) const;
+
+private:
+	AcceleratorModel* theModel;
+	double p0;
+	int nturns;
+	int obspnt;
+	double lossRadius;
+	double amin;
+	double amax;
+	double tol;
+
+	std::vector<Boundary> boundary;
+	std::vector<Trial> trials;
+	std::vector<PSvector> lineOrbits;
+
+	// Tracks one particle on each of the lines at the given amplitudes, and returns the turns each survived
+	std::vector<int> Track(const std::vector<size_t>& lines, const std::vector<double>& amplitudes);
+};
+
+#endif
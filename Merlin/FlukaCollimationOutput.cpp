@@ -19,6 +19,10 @@ FlukaCollimationOutput::FlukaCollimationOutput(OutputType ot)
 	otype = ot;
 }
 
+FlukaCollimationOutput::~FlukaCollimationOutput()
+{
+}
+
 void FlukaCollimationOutput::Dispose(AcceleratorComponent& currcomponent, double pos, Particle& particle, int turn)
 {
 	// If current component is a collimator we store the loss, otherwise we do not
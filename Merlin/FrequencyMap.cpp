@@ -0,0 +1,262 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+
+#include "ClosedOrbit.h"
+#include "FrequencyMap.h"
+#include "NumericalConstants.h"
+#include "ParticleBunch.h"
+#include "ParticleTracker.h"
+#include "SymplecticIntegrators.h"
+#include "TransferMapTable.h"
+#include "TransferMatrix.h"
+
+using namespace std;
+using namespace ParticleTracking;
+
+namespace
+{
+
+typedef std::complex<double> Complex;
+
+// In place radix 2 FFT, with the kernel exp(-2 pi i k n / N)
+void FFT(vector<Complex>& a)
+{
+	const size_t n = a.size();
+	for(size_t i = 1, j = 0; i < n; i++)
+	{
+		size_t bit = n >> 1;
+		for(; j & bit; bit >>= 1)
+		{
+			j ^= bit;
+		}
+		j ^= bit;
+		if(i < j)
+		{
+			swap(a[i], a[j]);
+		}
+	}
+
+	for(size_t len = 2; len <= n; len <<= 1)
+	{
+		const Complex wlen = polar(1.0, -twoPi / len);
+		for(size_t i = 0; i < n; i += len)
+		{
+			Complex w(1.0);
+			for(size_t k = 0; k < len / 2; k++)
+			{
+				const Complex u = a[i + k];
+				const Complex v = a[i + k + len / 2] * w;
+				a[i + k] = u + v;
+				a[i + k + len / 2] = u - v;
+				w *= wlen;
+			}
+		}
+	}
+}
+
+// Amplitude of the Fourier integral of the windowed signal at frequency nu
+double Amplitude(const vector<Complex>& zw, double nu)
+{
+	const Complex step = polar(1.0, -twoPi * nu);
+	Complex phase(1.0);
+	Complex sum(0.0);
+	for(const Complex& z : zw)
+	{
+		sum += z * phase;
+		phase *= step;
+	}
+	return abs(sum);
+}
+
+bool Lost(const Particle& p)
+{
+	return !std::isfinite(p.x()) || !std::isfinite(p.y()) || fabs(p.x()) > 1.0 || fabs(p.y()) > 1.0;
+}
+
+} // end of anonymous namespace
+
+FrequencyMap::FrequencyMap(AcceleratorModel* aModel, double refMomentum) :
+	theModel(aModel), p0(refMomentum), myHELProcess(nullptr), orbit(0)
+{
+}
+
+void FrequencyMap::FindOptics()
+{
+	orbit = PSvector(0);
+	ClosedOrbit co(theModel, p0);
+	co.TransverseOnly(true);
+	co.FindClosedOrbit(orbit);
+
+	RealMatrix M(6, 6);
+	PSvector p = orbit;
+	TransferMatrix tm(theModel, p0);
+	tm.FindTM(M, p);
+
+	TransferMapTable::OneTurnTwiss(M, 0, beta[0], alpha[0]);
+	TransferMapTable::OneTurnTwiss(M, 2, beta[1], alpha[1]);
+}
+
+void FrequencyMap::Track(const PSvectorArray& particles, int ntrack, bool diffusion)
+{
+	FindOptics();
+
+	const size_t np = particles.size();
+	const int nturns = diffusion ? 2 * ntrack : ntrack;
+
+	// normalised coordinates x - i (alpha x + beta x') / sqrt(beta) of particle n, plane k at turn t
+	// are at buffer[(2 * n + k) * nturns + t]
+	vector<Complex> buffer(2 * np * nturns);
+
+	points.assign(np, Point());
+	ParticleBunch bunch(p0, 1.0);
+	for(size_t n = 0; n < np; n++)
+	{
+		points[n].initial = particles[n];
+		points[n].turns = 0;
+		Particle p = particles[n];
+		p.id() = n;
+		bunch.push_back(p);
+	}
+
+	ParticleTracker tracker(theModel->GetBeamline(), &bunch, false);
+	ParticleTracker::integrator_set_base* ti = new ParticleTracking::TRANSPORT::StdISet();
+	tracker.SetIntegratorSet(ti);
+	if(myHELProcess != nullptr)
+	{
+		tracker.AddProcess(myHELProcess);
+	}
+
+	for(int turn = 0; turn < nturns && bunch.size() != 0; turn++)
+	{
+		tracker.Track(&bunch);
+
+		// particles can also be removed by the tracking, and are then missing from the bunch
+		PSvectorArray& p = bunch.GetParticles();
+		for(const Particle& q : p)
+		{
+			const size_t n = q.id();
+			if(Lost(q))
+			{
+				continue;
+			}
+			for(int k = 0; k < 2; k++)
+			{
+				const double x = q[2 * k] - orbit[2 * k];
+				const double xp = q[2 * k + 1] - orbit[2 * k + 1];
+				buffer[(2 * n + k) * nturns + turn] = Complex(x, -(alpha[k] * x + beta[k] * xp)) / sqrt(beta[k]);
+			}
+			points[n].turns = turn + 1;
+		}
+		p.erase(remove_if(p.begin(), p.end(), Lost), p.end());
+	}
+	delete ti;
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic)
+#endif
+	for(long n = 0; n < static_cast<long>(np); n++)
+	{
+		Point& pt = points[n];
+		pt.stable = pt.turns == nturns;
+		pt.Qx = pt.Qy = pt.dQx = pt.dQy = pt.diffusion = 0;
+		if(!pt.stable)
+		{
+			continue;
+		}
+
+		const Complex* z = &buffer[2 * n * nturns];
+		pt.Qx = FindTune(z, ntrack);
+		pt.Qy = FindTune(z + nturns, ntrack);
+		if(diffusion)
+		{
+			pt.dQx = remainder(FindTune(z + ntrack, ntrack) - pt.Qx, 1.0);
+			pt.dQy = remainder(FindTune(z + nturns + ntrack, ntrack) - pt.Qy, 1.0);
+			// clamped, so that a tune which does not change gives -16 rather than -inf
+			pt.diffusion = log10(max(sqrt(pt.dQx * pt.dQx + pt.dQy * pt.dQy), 1e-16));
+		}
+	}
+}
+
+double FrequencyMap::FindTune(const Complex* z, int n)
+{
+	// Hann window
+	vector<Complex> zw(z, z + n);
+	for(int t = 0; t < n; t++)
+	{
+		zw[t] *= 1 - cos(twoPi * t / n);
+	}
+
+	// coarse peak of the zero padded FFT, skipping the constant term
+	size_t nfft = 1;
+	while(nfft < 2 * static_cast<size_t>(n))
+	{
+		nfft <<= 1;
+	}
+	vector<Complex> spectrum(zw);
+	spectrum.resize(nfft);
+	FFT(spectrum);
+
+	size_t peak = 1;
+	for(size_t k = 2; k < nfft - 1; k++)
+	{
+		if(abs(spectrum[k]) > abs(spectrum[peak]))
+		{
+			peak = k;
+		}
+	}
+
+	// golden section search for the maximum within a bin either side
+	const double g = (sqrt(5.0) - 1) / 2;
+	double a = double(peak - 1) / nfft;
+	double b = double(peak + 1) / nfft;
+	double c = b - g * (b - a);
+	double d = a + g * (b - a);
+	double fc = Amplitude(zw, c);
+	double fd = Amplitude(zw, d);
+	while(b - a > 1.0e-12)
+	{
+		if(fc > fd)
+		{
+			b = d;
+			d = c;
+			fd = fc;
+			c = b - g * (b - a);
+			fc = Amplitude(zw, c);
+		}
+		else
+		{
+			a = c;
+			c = d;
+			fc = fd;
+			d = a + g * (b - a);
+			fd = Amplitude(zw, d);
+		}
+	}
+	const double nu = (a + b) / 2;
+	return nu - floor(nu);
+}
+
+void FrequencyMap::Output(std::ostream& os) const
+{
+	for(const Point& pt : points)
+	{
+		os << std::setw(16) << pt.initial.x();
+		os << std::setw(16) << pt.initial.y();
+		os << std::setw(4) << pt.stable;
+		os << std::setw(8) << pt.turns;
+		os << std::setw(20) << std::setprecision(12) << pt.Qx;
+		os << std::setw(20) << pt.Qy;
+		os << std::setw(16) << std::setprecision(6) << pt.dQx;
+		os << std::setw(16) << pt.dQy;
+		os << std::setw(16) << pt.diffusion;
+		os << std::endl;
+	}
+}
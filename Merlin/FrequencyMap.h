@@ -0,0 +1,96 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef FrequencyMap_h
+#define FrequencyMap_h 1
+
+#include "merlin_config.h"
+#include <complex>
+#include <ostream>
+#include <vector>
+#include "AcceleratorModel.h"
+#include "HollowELensProcess.h"
+#include "PSTypes.h"
+
+using namespace ParticleTracking;
+
+/**
+ *	Tune footprint and frequency map analysis of many particles.
+ *
+ *	All the initial conditions are tracked together as one bunch.
+ *	The turn by turn coordinates of each particle, normalised with
+ *	the Twiss parameters of the one turn map about the closed
+ *	orbit, are kept in a contiguous buffer. The tunes are then
+ *	found for each particle in parallel (when built with
+ *	ENABLE_OPENMP) by a windowed FFT, refined by maximising the
+ *	amplitude of the Fourier integral as in NAFF.
+ *
+ *	With diffusion, twice the number of turns are tracked, and the
+ *	change of tune between the two halves gives the diffusion
+ *	index log10(sqrt(dQx^2 + dQy^2)), which is at least -16.
+ *
+ *	A particle is lost, and has no tunes, if it is removed by the
+ *	tracking or its horizontal or vertical offset exceeds 1 m.
+ */
+class FrequencyMap
+{
+public:
+	/// Tunes of one particle
+	struct Point
+	{
+		PSvector initial;
+		bool stable;
+		int turns;        ///< number of turns survived
+		double Qx, Qy;
+		double dQx, dQy;
+		double diffusion;
+	};
+
+	FrequencyMap(AcceleratorModel* aModel, double refMomentum);
+
+	void SetHELProcess(HollowELensProcess* HELP)
+	{
+		myHELProcess = HELP;
+	}
+
+	/**
+	 *	Tracks the particles for ntrack turns (2 ntrack with
+	 *	diffusion) and finds their tunes. Throws MerlinException
+	 *	if the linear motion about the closed orbit is unstable.
+	 */
+	void Track(const PSvectorArray& particles, int ntrack = 256, bool diffusion = true);
+
+	const std::vector<Point>& GetPoints() const
+	{
+		return points;
+	}
+
+	/// Writes one row per particle: initial x, y, stable, turns, Qx, Qy, dQx, dQy, diffusion
+	void Output(std::ostream& os) const;
+
+	/**
+	 *	Frequency of the main line of the n turn complex signal z,
+	 *	in units of the revolution frequency, in [0, 1).
+	 */
+	static double FindTune(const std::complex<double>* z, int n);
+
+private:
+	AcceleratorModel* theModel;
+	double p0;
+	HollowELensProcess* myHELProcess;
+
+	// closed orbit and Twiss parameters used to normalise the coordinates
+	PSvector orbit;
+	double beta[2];
+	double alpha[2];
+
+	std::vector<Point> points;
+
+	void FindOptics();
+};
+
+#endif
@@ -10,53 +10,107 @@
 #include "NumericalConstants.h"
 
 PSvector HorizonalHalo1ParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector HorizonalHalo1ParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	double u = RandomNG::uniform(-pi, pi);
+	double u = RandomNG::uniform(gen, -pi, pi);
 	p.x()    = cos(u) * halo_size;
 	p.xp()   = sin(u) * halo_size;
 	p.y()    = 0.0;
 	p.yp()   = 0.0;
-	p.dp()   = RandomNG::uniform(-1, 1);
-	p.ct()   = RandomNG::uniform(-1, 1);
+	p.dp()   = RandomNG::uniform(gen, -1, 1);
+	p.ct()   = RandomNG::uniform(gen, -1, 1);
 	return p;
 }
 
 PSvector VerticalHalo1ParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector VerticalHalo1ParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	double u = RandomNG::uniform(-pi, pi);
+	double u = RandomNG::uniform(gen, -pi, pi);
 	p.x()    = 0.0;
 	p.xp()   = 0.0;
 	p.y()    = cos(u) * halo_size;
 	p.yp()   = sin(u) * halo_size;
-	p.dp()   = RandomNG::uniform(-1, 1);
-	p.ct()   = RandomNG::uniform(-1, 1);
+	p.dp()   = RandomNG::uniform(gen, -1, 1);
+	p.ct()   = RandomNG::uniform(gen, -1, 1);
 	return p;
 }
 
 PSvector HorizonalHalo2ParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector HorizonalHalo2ParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	double u = RandomNG::uniform(-pi, pi);
+	double u = RandomNG::uniform(gen, -pi, pi);
 	p.x()    = cos(u) * halo_size;
 	p.xp()   = sin(u) * halo_size;
-	p.y()    = RandomGauss(1, cutoffs.y());
-	p.yp()   = RandomGauss(1, cutoffs.yp());
-	p.dp()   = RandomNG::uniform(-1, 1);
-	p.ct()   = RandomNG::uniform(-1, 1);
+	p.y()    = RandomGauss(gen, 1, cutoffs.y());
+	p.yp()   = RandomGauss(gen, 1, cutoffs.yp());
+	p.dp()   = RandomNG::uniform(gen, -1, 1);
+	p.ct()   = RandomNG::uniform(gen, -1, 1);
 	return p;
 }
 
 PSvector VerticalHalo2ParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector VerticalHalo2ParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	double u = RandomNG::uniform(-pi, pi);
-	p.x()    = RandomGauss(1, cutoffs.x());
-	p.xp()   = RandomGauss(1, cutoffs.xp());
+	double u = RandomNG::uniform(gen, -pi, pi);
+	p.x()    = RandomGauss(gen, 1, cutoffs.x());
+	p.xp()   = RandomGauss(gen, 1, cutoffs.xp());
 	p.y()    = cos(u) * halo_size;
 	p.yp()   = sin(u) * halo_size;
-	p.dp()   = RandomNG::uniform(-1, 1);
-	p.ct()   = RandomNG::uniform(-1, 1);
+	p.dp()   = RandomNG::uniform(gen, -1, 1);
+	p.ct()   = RandomNG::uniform(gen, -1, 1);
+	return p;
+}
+
+PSvector HorizontalHaloTailParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector HorizontalHaloTailParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
+{
+	PSvector p(0);
+	p.x()    = RandomNG::normalTail(gen, halo_cut);
+	p.xp()   = RandomGauss(gen, 1, cutoffs.xp());
+	p.y()    = RandomGauss(gen, 1, cutoffs.y());
+	p.yp()   = RandomGauss(gen, 1, cutoffs.yp());
+	p.dp()   = RandomGauss(gen, 1, cutoffs.dp());
+	p.ct()   = RandomGauss(gen, 1, cutoffs.ct());
+	return p;
+}
+
+PSvector VerticalHaloTailParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector VerticalHaloTailParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
+{
+	PSvector p(0);
+	p.x()    = RandomGauss(gen, 1, cutoffs.x());
+	p.xp()   = RandomGauss(gen, 1, cutoffs.xp());
+	p.y()    = RandomNG::normalTail(gen, halo_cut);
+	p.yp()   = RandomGauss(gen, 1, cutoffs.yp());
+	p.dp()   = RandomGauss(gen, 1, cutoffs.dp());
+	p.ct()   = RandomGauss(gen, 1, cutoffs.ct());
 	return p;
 }
@@ -33,6 +33,11 @@ class HorizonalHalo1ParticleDistributionGenerator: public Halo1ParticleDistribut
 public:
 	using Halo1ParticleDistributionGenerator::Halo1ParticleDistributionGenerator;
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 /**
@@ -45,6 +50,11 @@ class VerticalHalo1ParticleDistributionGenerator: public Halo1ParticleDistributi
 public:
 	using Halo1ParticleDistributionGenerator::Halo1ParticleDistributionGenerator;
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 class Halo2ParticleDistributionGenerator: public ParticleDistributionGenerator
@@ -73,6 +83,11 @@ class HorizonalHalo2ParticleDistributionGenerator: public Halo2ParticleDistribut
 public:
 	using Halo2ParticleDistributionGenerator::Halo2ParticleDistributionGenerator;
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 /**
@@ -85,6 +100,66 @@ class VerticalHalo2ParticleDistributionGenerator: public Halo2ParticleDistributi
 public:
 	using Halo2ParticleDistributionGenerator::Halo2ParticleDistributionGenerator;
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
+};
+
+class HaloTailParticleDistributionGenerator: public ParticleDistributionGenerator
+{
+public:
+	/**
+	 * @param halo_cut_ Inner edge of the halo in units of sigma
+	 * @param cutoffs_ Cut off points for the remaining (normally distributed) coordinates
+	 */
+	HaloTailParticleDistributionGenerator(double halo_cut_, PSvector cutoffs_ = PSvector(0)) :
+		halo_cut(halo_cut_), cutoffs(cutoffs_)
+	{
+	}
+protected:
+	double halo_cut;
+	PSvector cutoffs;
+};
+
+/**
+ * Generator for the horizontal tail of a normal distribution.
+ *
+ * x is drawn directly from the normal tail |x| >= halo_cut sigma, all other
+ * coordinates are normally distributed. This gives the same distribution as
+ * NormalParticleDistributionGenerator combined with a
+ * HorizontalHaloParticleBunchFilter at halo_cut sigma (for zero orbit and
+ * dispersion), without generating and discarding the core.
+ */
+class HorizontalHaloTailParticleDistributionGenerator: public HaloTailParticleDistributionGenerator
+{
+public:
+	using HaloTailParticleDistributionGenerator::HaloTailParticleDistributionGenerator;
+	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
+};
+
+/**
+ * Generator for the vertical tail of a normal distribution.
+ *
+ * y is drawn directly from the normal tail |y| >= halo_cut sigma, all other
+ * coordinates are normally distributed.
+ */
+class VerticalHaloTailParticleDistributionGenerator: public HaloTailParticleDistributionGenerator
+{
+public:
+	using HaloTailParticleDistributionGenerator::HaloTailParticleDistributionGenerator;
+	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 #endif
@@ -18,11 +18,53 @@ using namespace PhysicalUnits;
 using namespace PhysicalConstants;
 using namespace std;
 
+namespace
+{
+
+// Edges of the measured radial profile, and the electron density at each edge, which is linear in between.
+// Adapted from V. Previtali's SixTrack elense implementation
+void MeasuredProfile(bool LHC_Radial, double Rmin, double x[5], double y[5])
+{
+	// Boundaries between parameterisations of the measured radial profile, scaled so that r[0] is at Rmin
+	static const double tevatron[5] = {222.5, 252.5, 287, 364.5, 426.5};       // Tevatron HEL 1.2A, 2m, 5KeV, 4-6.8sig
+	static const double lhc[5] = {222.5, 265, 315, 435, 505};                  // LHC HEL 5A, 3m, 10KeV, 4-8sig
+	static const double density[5] = {0, 917, 397, 228, 0};
+
+	const double* r = LHC_Radial ? lhc : tevatron;
+	for(int i = 0; i < 5; i++)
+	{
+		x[i] = r[i] / r[0] * Rmin;
+		y[i] = density[i];
+	}
+}
+
+// Integral of R times the density of segment i of the measured profile, up to a constant
+double SegmentIntegral(const double x[5], const double y[5], int i, double R)
+{
+	const double m = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+	return m * pow(R, 3) / 3 + (y[i] - x[i] * m) * pow(R, 2) / 2;
+}
+
+// Kick at R from a kick table, see HollowELensProcess::KickTable
+inline double TableKick(double R, double scale, const double* edges, size_t nedges, const double* a, const double* b,
+	const double* c)
+{
+	size_t seg = 0;
+	for(size_t k = 0; k < nedges; k++)
+	{
+		seg += R > edges[k];
+	}
+	return seg ? -scale / R * ((a[seg] * R + b[seg]) * R * R + c[seg]) : 0;
+}
+
+} // end of anonymous namespace
+
 namespace ParticleTracking
 {
 
 HollowELensProcess::HollowELensProcess(int priority) :
-	ParticleBunchProcess("HOLLOW ELECTRON LENS", priority), currentComponentHEL(nullptr)
+	ParticleBunchProcess("HOLLOW ELECTRON LENS", priority), currentComponentHEL(nullptr), ProtonBeta(0), tableValid(
+		false)
 {
 }
 
@@ -59,59 +101,31 @@ void HollowELensProcess::DoProcess(double /*ds*/)
 	// NB
 	// CalcThetaMax returns +ve theta
 	// CalcKick Radial and Simple return -ve theta
-	// DoProcess should have p.xp() += theta * sin(ParticleAngle)
-
-	double theta = 0;
-	double Gamma_p = 0;
-	double ParticleAngle;
-
-	bool SimpleProfile = currentComponentHEL->SimpleProfile;
-	bool ACSet = currentComponentHEL->ACSet;
-
-	ParticleBunch* newbunch = new ParticleBunch(currentBunch->GetReferenceMomentum(), currentBunch->GetTotalCharge()
-		/ currentBunch->size());
-	newbunch->clear();
-	newbunch->swap(*currentBunch);
+	// The kicks are applied along the direction of the particle from the axis
 
 	if(ProtonBeta == 0)
 	{
-		Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
+		double Gamma_p = LorentzGamma(currentBunch->GetReferenceMomentum(), ProtonMass);
 		ProtonBeta = LorentzBeta(Gamma_p);
 	}
 
 	// Have to increment Turn as the process doesn't have access to the turn value from user code
 	currentComponentHEL->Turn++;
 
+	UpdateKickTable();
+
 	switch(currentComponentHEL->OMode)
 	{
 	case DC:
 	{
 		//HEL always on
-		for(PSvectorArray::iterator p = newbunch->begin(); p != newbunch->end(); p++)
-		{
-			if(SimpleProfile)
-			{
-				theta = CalcKickSimple(*p);
-			}
-			else
-			{
-				theta = CalcKickRadial(*p);
-			}
-
-			if(theta != 0)
-			{
-				ParticleAngle = atan2((*p).y(), (*p).x());
-				//~ // Particle phase space angle and amplitude (radius)
-				(*p).xp() += theta * cos(ParticleAngle);
-				(*p).yp() += theta * sin(ParticleAngle);
-			}
-		}
+		ApplyKicks(1);
 	}
 	break;
 	case AC:
 	{
 		// Resonant HEL kick - Adapted from V. Previtali's SixTrack elense
-		if(ACSet)
+		if(currentComponentHEL->ACSet)
 		{
 			double TuneVarPerStep = currentComponentHEL->TuneVarPerStep;
 			double DeltaTune = currentComponentHEL->DeltaTune;
@@ -121,38 +135,19 @@ void HollowELensProcess::DoProcess(double /*ds*/)
 			double Nstep = currentComponentHEL->Nstep;
 			double Tune = currentComponentHEL->Tune;
 			double Multiplier = currentComponentHEL->Multiplier;
-			for(PSvectorArray::iterator p = newbunch->begin(); p != newbunch->end(); p++)
+
+			double OpTune;
+			if((TuneVarPerStep != 0) && (DeltaTune != 0))
+			{
+				OpTune = MinTune + fmod((floor(Turn / TurnsPerStep)), (Nstep)) * TuneVarPerStep;
+			}
+			else
 			{
-				if(SimpleProfile)
-				{
-					theta = CalcKickSimple(*p);
-				}
-				else
-				{
-					theta = CalcKickRadial(*p);
-				}
-
-				if(theta != 0)
-				{
-					double OpTune;
-					if((TuneVarPerStep != 0) && (DeltaTune != 0))
-					{
-						OpTune = MinTune + fmod((floor(Turn / TurnsPerStep)), (Nstep)) * TuneVarPerStep;
-					}
-					else
-					{
-						OpTune = Tune;
-					}
-
-					double Phi = Multiplier * (Turn * OpTune * 2 * pi);
-					theta *= 0.5 * (1 + cos(Phi));
-
-					ParticleAngle = atan2((*p).y(), (*p).x());
-					// Particle phase space angle and amplitude (radius)
-					(*p).xp() += theta * cos(ParticleAngle);
-					(*p).yp() += theta * sin(ParticleAngle);
-				}
+				OpTune = Tune;
 			}
+
+			double Phi = Multiplier * (Turn * OpTune * 2 * pi);
+			ApplyKicks(0.5 * (1 + cos(Phi)));
 		}
 		else
 		{
@@ -167,25 +162,7 @@ void HollowELensProcess::DoProcess(double /*ds*/)
 
 		if(rando >= 0)
 		{
-			for(PSvectorArray::iterator p = newbunch->begin(); p != newbunch->end(); p++)
-			{
-				if(SimpleProfile)
-				{
-					theta = CalcKickSimple(*p);
-				}
-				else
-				{
-					theta = CalcKickRadial(*p);
-				}
-
-				ParticleAngle = atan2((*p).y(), (*p).x());
-				if(theta != 0)
-				{
-					// Particle phase space angle and amplitude (radius)
-					(*p).xp() += theta * cos(ParticleAngle);
-					(*p).yp() += theta * sin(ParticleAngle);
-				}
-			}
+			ApplyKicks(1);
 		}
 	}
 	break;
@@ -201,69 +178,149 @@ void HollowELensProcess::DoProcess(double /*ds*/)
 		}
 		if((Turn % SkipTurn) == 0)
 		{
-			for(PSvectorArray::iterator p = newbunch->begin(); p != newbunch->end(); p++)
-			{
-				if(SimpleProfile)
-				{
-					theta = CalcKickSimple(*p);
-				}
-				else
-				{
-					theta = CalcKickRadial(*p);
-				}
-
-				ParticleAngle = atan2((*p).y(), (*p).x());
-				if(theta != 0)
-				{
-					// Particle phase space angle and amplitude (radius)
-					(*p).xp() += theta * cos(ParticleAngle);
-					(*p).yp() += theta * sin(ParticleAngle);
-				}
-			}
+			ApplyKicks(1);
 		}
 	}
 	break;
 	} //end switch
-
-	//Apply changes to particle bunch
-	currentBunch->clear();
-	currentBunch->swap(*newbunch);
-	delete newbunch;
 }
 
-double HollowELensProcess::GetMaxAllowedStepSize() const
+void HollowELensProcess::ApplyKicks(double factor)
 {
-	return currentComponent->GetLength();
+	const double scale = table.scale * factor;
+	const double* edges = table.edges.data();
+	const size_t nedges = table.edges.size();
+	const double* a = table.a.data();
+	const double* b = table.b.data();
+	const double* c = table.c.data();
+	const double XOffset = currentComponentHEL->XOffset;
+	const double YOffset = currentComponentHEL->YOffset;
+
+	Particle* p = currentBunch->GetParticles().data();
+	const long n = currentBunch->size();
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for simd
+#endif
+	for(long i = 0; i < n; i++)
+	{
+		const double dx = p[i].x() - XOffset;
+		const double dy = p[i].y() - YOffset;
+		const double theta = TableKick(sqrt(dx * dx + dy * dy), scale, edges, nedges, a, b, c);
+
+		// cos and sin of atan2(y, x), which is zero on the axis
+		const double r = sqrt(p[i].x() * p[i].x() + p[i].y() * p[i].y());
+		const double rinv = r > 0 ? 1 / r : 0;
+		p[i].xp() += theta * (r > 0 ? p[i].x() * rinv : 1);
+		p[i].yp() += theta * p[i].y() * rinv;
+	}
 }
 
-double HollowELensProcess::CalcThetaMax(double r)
+void HollowELensProcess::UpdateKickTable()
 {
-	if(r == 0)
+	const HollowElectronLens* hel = currentComponentHEL;
+	if(tableValid && table.Rmin == hel->GetRmin() && table.Rmax == hel->GetRmax() && table.Current == hel->Current
+		&& table.ElectronBeta == hel->ElectronBeta && table.Rigidity == hel->Rigidity && table.EffectiveLength
+		== hel->EffectiveLength && table.ProtonBeta == ProtonBeta && table.SimpleProfile == hel->SimpleProfile
+		&& table.LHC_Radial == hel->LHC_Radial && table.ElectronDirection == hel->ElectronDirection)
 	{
-		return 0;
+		return;
+	}
+
+	table.Rmin = hel->GetRmin();
+	table.Rmax = hel->GetRmax();
+	table.Current = hel->Current;
+	table.ElectronBeta = hel->ElectronBeta;
+	table.Rigidity = hel->Rigidity;
+	table.EffectiveLength = hel->EffectiveLength;
+	table.ProtonBeta = ProtonBeta;
+	table.SimpleProfile = hel->SimpleProfile;
+	table.LHC_Radial = hel->LHC_Radial;
+	table.ElectronDirection = hel->ElectronDirection;
+	table.scale = ThetaMaxScale();
+
+	if(table.SimpleProfile)
+	{
+		// fraction (R^2 - Rmin^2) / (Rmax^2 - Rmin^2) of the kick between Rmin and Rmax
+		const double d = pow(table.Rmax, 2) - pow(table.Rmin, 2);
+		table.edges = {table.Rmin, table.Rmax};
+		table.a = {0, 0, 0};
+		table.b = {0, 1 / d, 0};
+		table.c = {0, -pow(table.Rmin, 2) / d, 1};
+	}
+	else
+	{
+		// fraction of the integral of the measured profile inside R
+		double x[5], y[5];
+		MeasuredProfile(table.LHC_Radial, table.Rmin, x, y);
+		double ntot = 0;
+		for(int i = 0; i < 4; i++)
+		{
+			ntot += SegmentIntegral(x, y, i, x[i + 1]) - SegmentIntegral(x, y, i, x[i]);
+		}
+
+		table.edges.assign(x, x + 5);
+		table.a.assign(1, 0);
+		table.b.assign(1, 0);
+		table.c.assign(1, 0);
+		double below = 0;
+		for(int i = 0; i < 4; i++)
+		{
+			const double m = (y[i + 1] - y[i]) / (x[i + 1] - x[i]);
+			table.a.push_back(m / 3 / ntot);
+			table.b.push_back((y[i] - x[i] * m) / 2 / ntot);
+			table.c.push_back((below - SegmentIntegral(x, y, i, x[i])) / ntot);
+			below += SegmentIntegral(x, y, i, x[i + 1]) - SegmentIntegral(x, y, i, x[i]);
+		}
+		table.a.push_back(0);
+		table.b.push_back(0);
+		table.c.push_back(1);
 	}
+	tableValid = true;
+}
+
+double HollowELensProcess::CalcKick(double R)
+{
+	UpdateKickTable();
+	return TableKick(R, table.scale, table.edges.data(), table.edges.size(), table.a.data(), table.b.data(),
+		table.c.data());
+}
+
+double HollowELensProcess::GetMaxAllowedStepSize() const
+{
+	return currentComponent->GetLength();
+}
 
+double HollowELensProcess::ThetaMaxScale() const
+{
 	bool ElectronDirection = currentComponentHEL->ElectronDirection;
 	double EffectiveLength = currentComponentHEL->EffectiveLength;
 	double Current = currentComponentHEL->Current;
 	double ElectronBeta = currentComponentHEL->ElectronBeta;
 	double Rigidity = currentComponentHEL->Rigidity;
 
-	double ThetaMax;
 	if(ElectronDirection)
 	{
 		// HEL electrons travelling opposite to LHC protons (summed kick)
-		ThetaMax = (2 * EffectiveLength * Current * (1 + (ElectronBeta * ProtonBeta))) / (r * 1E7 * Rigidity
-			* ElectronBeta * ProtonBeta);
+		return (2 * EffectiveLength * Current * (1 + (ElectronBeta * ProtonBeta))) / (1E7 * Rigidity * ElectronBeta
+			   * ProtonBeta);
 	}
 	else
 	{
 		// HEL electrons travelling in the same direction to LHC protons (smaller kick and opposite)
-		ThetaMax = -(2 * EffectiveLength * Current * (1 - (ElectronBeta * ProtonBeta))) / (r * 1E7 * Rigidity
-			* ElectronBeta * ProtonBeta);
+		return -(2 * EffectiveLength * Current * (1 - (ElectronBeta * ProtonBeta))) / (1E7 * Rigidity * ElectronBeta
+			   * ProtonBeta);
+	}
+}
+
+double HollowELensProcess::CalcThetaMax(double r)
+{
+	if(r == 0)
+	{
+		return 0;
 	}
 
-	return ThetaMax;
+	return ThetaMaxScale() / r;
 }
 
 double HollowELensProcess::CalcKickSimple(Particle &p)
@@ -318,93 +375,38 @@ double HollowELensProcess::CalcKickRadial(Particle &p)
 
 double HollowELensProcess::CalcKickRadial(double R)
 {
-	double f = 0;
-	double thet = 0;
 	double Rmin = currentComponentHEL->GetRmin();
-	bool LHC_Radial = currentComponentHEL->LHC_Radial;
 
-	// Adapted from V. Previtali's SixTrack elense implementation
 	if(R <= Rmin)
 	{
 		return 0;
 	}
 
-	// Define boundaries between parameterisation of measured radial profile
-	double r0, r1, r2, r3, r4;
+	double x[5], y[5];
+	MeasuredProfile(currentComponentHEL->LHC_Radial, Rmin, x, y);
 
-	if(!LHC_Radial)
-	{
-		// Tevatron HEL 1.2A, 2m, 5KeV, 4-6.8sig
-		r0 = 222.5;
-		r1 = 252.5;
-		r2 = 287;
-		r3 = 364.5;
-		r4 = 426.5;
-	}
-	else
+	double n[4];
+	double ntot = 0;
+	for(int i = 0; i < 4; i++)
 	{
-		// LHC HEL 5A, 3m, 10KeV, 4-8sig
-		r1 = 265;       // 0 - initial rise				(x1.191)
-		r2 = 315;       // rise - straight section		(x1.248)
-		r3 = 435;       // straight - left of peak		(x1.193)
-		r4 = 505;       // left - right of peak			(x1.184)
+		n[i] = SegmentIntegral(x, y, i, x[i + 1]) - SegmentIntegral(x, y, i, x[i]);
+		ntot += n[i];
 	}
 
-	double elense_r_min = Rmin; //Need to calculate 4 sigma at this point
-
-	double x0 = elense_r_min;
-	double y0 = 0;
-	double x1 = r1 / r0 * elense_r_min;
-	double y1 = 917;
-	double x2 = r2 / r0 * elense_r_min;
-	double y2 = 397;
-	double x3 = r3 / r0 * elense_r_min;
-	double y3 = 228;
-	double x4 = r4 / r0 * elense_r_min;
-	double y4 = 0;
-
-	double n0 = ((y1 - y0) / (x1 - x0) / 3) * pow(x1, 3) + (y0 - x0 * (y1 - y0) / (x1 - x0)) * pow(x1, 2) / 2 - (((y1
-		- y0) / (x1 - x0) / 3) * pow(x0, 3) + (y0 - x0 * (y1 - y0) / (x1 - x0)) * pow(x0, 2) / 2);
-	double n1 = (y2 - y1) / (x2 - x1) * pow(x2, 3) / 3 + (y1 - x1 * (y2 - y1) / (x2 - x1)) * pow(x2, 2) / 2 - ((y2
-		- y1) / (x2 - x1) * pow(x1, 3) / 3 + (y1 - x1 * (y2 - y1) / (x2 - x1)) * pow(x1, 2) / 2);
-	double n2 = (y3 - y2) / (x3 - x2) * pow(x3, 3) / 3 + (y2 - x2 * (y3 - y2) / (x3 - x2)) * pow(x3, 2) / 2 - ((y3
-		- y2) / (x3 - x2) * pow(x2, 3) / 3 + (y2 - x2 * (y3 - y2) / (x3 - x2)) * pow(x2, 2) / 2);
-	double n3 = (y4 - y3) / (x4 - x3) * pow(x4, 3) / 3 + (y3 - x3 * (y4 - y3) / (x4 - x3)) * pow(x4, 2) / 2 - ((y4
-		- y3) / (x4 - x3) * pow(x3, 3) / 3 + (y3 - x3 * (y4 - y3) / (x4 - x3)) * pow(x3, 2) / 2);
-	double ntot = n0 + n1 + n2 + n3;
-
-	if(R < x0)
-	{
-		f = 0;
-		cout << "HEL warning: Radial profile: R < x0" << endl;
-	}
-	else if(R < x1)
-	{
-		f = (((y1 - y0) / (x1 - x0) / 3) * pow(R, 3) + (y0 - x0 * (y1 - y0) / (x1 - x0)) * pow(R, 2) / 2 - (((y1 - y0)
-			/ (x1 - x0) / 3) * pow(x0, 3) + (y0 - x0 * (y1 - y0) / (x1 - x0)) * pow(x0, 2) / 2)) / ntot;
-	}
-	else if(R < x2)
-	{
-		f = (n0 + (y2 - y1) / (x2 - x1) * pow(R, 3) / 3 + (y1 - x1 * (y2 - y1) / (x2 - x1)) * pow(R, 2) / 2 - ((y2
-			- y1) / (x2 - x1) * pow(x1, 3) / 3 + (y1 - x1 * (y2 - y1) / (x2 - x1)) * pow(x1, 2) / 2)) / ntot;
-	}
-	else if(R < x3)
-	{
-		f = (n0 + n1 + (y3 - y2) / (x3 - x2) * pow(R, 3) / 3 + (y2 - x2 * (y3 - y2) / (x3 - x2)) * pow(R, 2) / 2
-			- ((y3 - y2) / (x3 - x2) * pow(x2, 3) / 3 + (y2 - x2 * (y3 - y2) / (x3 - x2)) * pow(x2, 2) / 2)) / ntot;
-	}
-	else if(R < x4)
-	{
-		f = (n0 + n1 + n2 + (y4 - y3) / (x4 - x3) * pow(R, 3) / 3 + (y3 - x3 * (y4 - y3) / (x4 - x3)) * pow(R, 2) / 2
-			- ((y4 - y3) / (x4 - x3) * pow(x3, 3) / 3 + (y3 - x3 * (y4 - y3) / (x4 - x3)) * pow(x3, 2) / 2)) / ntot;
-	}
-	else
+	// fraction of the profile inside R
+	double f = 1;
+	double below = 0;
+	for(int i = 0; i < 4; i++)
 	{
-		f = 1;
+		if(R < x[i + 1])
+		{
+			f = (below + SegmentIntegral(x, y, i, R) - SegmentIntegral(x, y, i, x[i])) / ntot;
+			break;
+		}
+		below += n[i];
 	}
 
-	thet = -CalcThetaMax(R) * f;
-	return thet;
+	return -CalcThetaMax(R) * f;
 }
 
 // TODO: Should reimplement a HollowElectionLensConfiguration system (like ApertureConfiguration)
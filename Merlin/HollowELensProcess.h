@@ -9,6 +9,7 @@
 #define HollowELensProcess_h 1
 
 #include "merlin_config.h"
+#include <vector>
 #include "AcceleratorModel.h"
 #include "HollowElectronLens.h"
 #include "ParticleBunchProcess.h"
@@ -71,6 +72,13 @@ public:
 	 */
 	virtual double CalcKickRadial(double R);
 
+	/**
+	 * Kick at radius R from the kick table of the current lens
+	 * settings, as used for tracking. The table is rebuilt when
+	 * the settings change.
+	 */
+	double CalcKick(double R);
+
 	/**
 	 * Output the HEL radial profile in x y phase space (assumes circular HEL)
 	 */
@@ -80,6 +88,36 @@ private:
 	// Data Members for Class Attributes
 	HollowElectronLens* currentComponentHEL;
 	double ProtonBeta;
+
+	/**
+	 * Kick profile for one set of lens settings. Both profiles are
+	 * piecewise polynomials in R, so the kick is tabulated exactly
+	 * as theta(R) = -(scale / R) (a R^3 + b R^2 + c), with one set
+	 * of coefficients for each segment between the edges. The first
+	 * segment (up to Rmin) has no kick, and the last one the full
+	 * kick.
+	 */
+	struct KickTable
+	{
+		// lens settings the table was built for
+		double Rmin, Rmax, Current, ElectronBeta, Rigidity, EffectiveLength, ProtonBeta;
+		bool SimpleProfile, LHC_Radial, ElectronDirection;
+
+		double scale;
+		std::vector<double> edges;
+		std::vector<double> a, b, c;
+	};
+	KickTable table;
+	bool tableValid;
+
+	/// Returns CalcThetaMax(r) * r
+	double ThetaMaxScale() const;
+
+	/// Rebuilds the kick table if the settings of the current lens have changed
+	void UpdateKickTable();
+
+	/// Kicks every particle in place, with the kick scaled by factor
+	void ApplyKicks(double factor);
 };
 
 } // end namespace ParticleTracking
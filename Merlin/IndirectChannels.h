@@ -142,6 +142,7 @@ template<class E>
 void TIC_ctor<E>::WriteTo(E* elmnt, double value)
 {
 	(elmnt->*w_f)(value);
+	elmnt->SetModified();
 }
 
 template<class E>
@@ -284,6 +284,14 @@ public:
 	 */
 	LatticeFrame* SetSuperFrame(LatticeFrame* aFrame);
 
+	/**
+	 *	Returns the super frame, or nullptr for the global frame.
+	 */
+	const LatticeFrame* GetSuperFrame() const
+	{
+		return superFrame;
+	}
+
 	/**
 	 *	Replace subFrame with newSubFrame. Returns true if
 	 *	successful (i.e. subFrame is a sub-frame of this Lattice
@@ -5,17 +5,22 @@
  * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
  */
 
+#include <cmath>
+#include <exception>
 #include <fstream>
 #include <vector>
 #include "ParticleBunch.h"
-#include "ParticleTracker.h"
-#include "RingDeltaTProcess.h"
 #include "AcceleratorModel.h"
 #include "ClosedOrbit.h"
-#include "TransferMatrix.h"
+#include "ComponentFrame.h"
+#include "LinearMapTracker.h"
 #include "MatrixPrinter.h"
+#include "Monitor.h"
 #include "NumericalConstants.h"
+#include "ParticleComponentTracker.h"
+#include "StdIntegrators.h"
 #include "TLAS.h"
+#include "TLASimp.h"
 #include "LatticeFunctions.h"
 
 using namespace ParticleTracking;
@@ -96,7 +101,8 @@ void LatticeFunction::Derivative(LatticeFunction* lfnM, LatticeFunction* lfnP, d
 }
 
 LatticeFunctionTable::LatticeFunctionTable(AcceleratorModel* aModel, double refMomentum) :
-	theModel(aModel), p0(refMomentum), delta(1.0e-8), bendscale(1.0e-16), symplectify(false), orbitonly(true)
+	theModel(aModel), p0(refMomentum), delta(1.0e-8), bendscale(1.0e-16), symplectify(false), orbitonly(true),
+	writeMatrices(false), haveMaps(false), mapOrbitOnly(true), fixedOrbit(false), mapScale(0), mapSerial(0), updateTol(1.0e-7), nUpdated(0)
 {
 	UseDefaultFunctions();
 }
@@ -135,6 +141,11 @@ void LatticeFunctionTable::MakeTMSymplectic(bool flag)
 	symplectify = flag;
 }
 
+void LatticeFunctionTable::WriteMatrices(bool flag)
+{
+	writeMatrices = flag;
+}
+
 void LatticeFunctionTable::AddFunction(int i, int j, int k)
 {
 	LatticeFunction* lfn = new LatticeFunction(i, j, k);
@@ -280,35 +291,124 @@ public:
 
 };
 
+#ifdef ENABLE_OPENMP
+namespace
+{
+
+// true if two tables can be calculated on the model at the same time. The TRANSPORT integrators leave the
+// elements unchanged, unlike the symplectic and thin lens ones, which set the field of a bend or multipole for each
+// step, and a recording monitor would fill its buffers from both threads.
+bool ConcurrentTrackingSafe(AcceleratorModel* model)
+{
+	if(!dynamic_cast<const TRANSPORT::StdISet*>(ParticleComponentTracker::GetDefaultIntegratorSet()))
+	{
+		return false;
+	}
+
+	vector<Monitor*> monitors;
+	model->ExtractTypedElements(monitors);
+	for(Monitor* monitor : monitors)
+	{
+		if(monitor->IsRecording())
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+} // end of anonymous namespace
+#endif
+
 void LatticeFunctionTable::CalculateEnergyDerivative()
 {
-	double dpP = orbitonly ? DoCalculateOrbitOnly(bendscale) : DoCalculate(bendscale);
-	vectorlfn lfnP;
-	for_each(lfnlist.begin(), lfnlist.end(), CopyLatticeFunction(lfnP));
+	// The negative offset is found by a second table on the same model, with the same functions and settings but
+	// its own orbit and maps, so that the two calculations are independent
+	LatticeFunctionTable tableM(theModel, p0);
+	tableM.delta = delta;
+	tableM.symplectify = symplectify;
+	tableM.orbitonly = orbitonly;
+	tableM.orbits = orbits;
+	for_each(tableM.lfnlist.begin(), tableM.lfnlist.end(), DeleteLatticeFunction());
+	tableM.lfnlist.clear();
+	for(LatticeFunction* lfn : lfnlist)
+	{
+		int i, j, k;
+		lfn->GetIndices(i, j, k);
+		tableM.lfnlist.push_back(new LatticeFunction(i, j, k));
+	}
 
-	double dpM = orbitonly ? DoCalculateOrbitOnly(-bendscale) : DoCalculate(-bendscale);
-	vectorlfn lfnM;
-	for_each(lfnlist.begin(), lfnlist.end(), CopyLatticeFunction(lfnM));
+	double dpP = 0;
+	double dpM = 0;
+	std::exception_ptr errorP;
+	std::exception_ptr errorM;
 
+#ifdef ENABLE_OPENMP
+	const bool concurrent = ConcurrentTrackingSafe(theModel);
+	#pragma omp parallel sections if(concurrent)
+#endif
+	{
+#ifdef ENABLE_OPENMP
+		#pragma omp section
+#endif
+		{
+			try
+			{
+				dpP = orbitonly ? DoCalculateOrbitOnly(bendscale) : DoCalculate(bendscale);
+			}
+			catch(...)
+			{
+				errorP = std::current_exception();
+			}
+		}
+#ifdef ENABLE_OPENMP
+		#pragma omp section
+#endif
+		{
+			try
+			{
+				dpM = orbitonly ? tableM.DoCalculateOrbitOnly(-bendscale) : tableM.DoCalculate(-bendscale);
+			}
+			catch(...)
+			{
+				errorM = std::current_exception();
+			}
+		}
+	}
+
+	// the stored maps are for the offset calculation, not the table
+	haveMaps = false;
+
+	if(errorP)
+	{
+		std::rethrow_exception(errorP);
+	}
+	if(errorM)
+	{
+		std::rethrow_exception(errorM);
+	}
+
+	vectorlfn lfnP;
+	for_each(lfnlist.begin(), lfnlist.end(), CopyLatticeFunction(lfnP));
 	for_each(lfnlist.begin(), lfnlist.end(), ClearLatticeFunction());
 
 	double dp = dpP - dpM;
 	vectorlfn::iterator lfnitP = lfnP.begin();
-	vectorlfn::iterator lfnitM = lfnM.begin();
+	vectorlfn::iterator lfnitM = tableM.lfnlist.begin();
 
 	for(vectorlfn::iterator lfnit = lfnlist.begin(); lfnit != lfnlist.end(); lfnit++, lfnitP++, lfnitM++)
 	{
 		(*lfnit)->Derivative(*lfnitM, *lfnitP, dp);
 	}
 
+	for_each(lfnP.begin(), lfnP.end(), DeleteLatticeFunction());
 }
 
 double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMatrix* MInit)
 {
-        int Ndim,Nsize;
-	for_each(lfnlist.begin(), lfnlist.end(), ClearLatticeFunction());
+	const unsigned long serial = ModelElement::GetLastModificationSerial();
 
-	PSvector p(0);
+	PSvector p = StartingOrbit(4);
 	if(pInit)
 	{
 		p = *pInit;
@@ -322,6 +422,11 @@ double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMat
 		co.FindClosedOrbit(p);
 	}
 
+	Linearise(cscale, p);
+	mapSerial = serial;
+	mapOrbitOnly = false;
+	fixedOrbit = pInit != nullptr;
+
 	RealMatrix M(6);
 	if(MInit)
 	{
@@ -329,11 +434,162 @@ double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMat
 	}
 	else
 	{
-		TransferMatrix tm(theModel, p0);
-		tm.SetDelta(delta);
-		tm.ScaleBendPathLength(cscale);
-		tm.FindTM(M, p);
+		M = OneTurnMap();
+	}
+	FillTable(M);
+	return p.dp();
+}
+
+double LatticeFunctionTable::DoCalculateOrbitOnly(double cscale, PSvector* pInit)
+{
+	const unsigned long serial = ModelElement::GetLastModificationSerial();
+
+	PSvector p = StartingOrbit(6);
+	if(pInit)
+	{
+		p = *pInit;
+	}
+	else
+	{
+		ClosedOrbit co(theModel, p0);
+		co.SetDelta(delta);
+		co.ScaleBendPathLength(cscale);
+		co.FindClosedOrbit(p);
+	}
+
+	Linearise(cscale, p);
+	mapSerial = serial;
+	mapOrbitOnly = true;
+	fixedOrbit = pInit != nullptr;
+
+	FillOrbitTable();
+	return p.dp();
+}
+
+namespace
+{
+
+// true if the element in the frame, or the frame or any frame containing it, has changed since serial
+bool ChangedSince(const ComponentFrame* frame, unsigned long serial)
+{
+	if(frame->IsComponent() && frame->GetComponent().GetModificationSerial() > serial)
+	{
+		return true;
+	}
+	for(const LatticeFrame* f = frame; f; f = f->GetSuperFrame())
+	{
+		if(f->GetModificationSerial() > serial)
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+// orbit at the exit of an element, from its map about the orbit x0 -> x1
+PSvector LinearStep(const RealMatrix& J, const PSvector& x0, const PSvector& x1, const PSvector& x)
+{
+	PSvector y = x1;
+	for(int i = 0; i < 6; i++)
+	{
+		for(int j = 0; j < 6; j++)
+		{
+			y[i] += J(i, j) * (x[j] - x0[j]);
+		}
+	}
+	return y;
+}
+
+double MaxDifference(const PSvector& x, const PSvector& y)
+{
+	double d = 0;
+	for(int i = 0; i < 6; i++)
+	{
+		d = std::max(d, fabs(x[i] - y[i]));
+	}
+	return d;
+}
+
+} // end of anonymous namespace
+
+PSvector LatticeFunctionTable::StartingOrbit(int cpt) const
+{
+	// repeated searches, for example with a different bend path length scale, start from the last orbit found
+	PSvector p(0);
+	if(!orbits.empty())
+	{
+		for(int i = 0; i < cpt; i++)
+		{
+			p[i] = orbits[0][i];
+		}
+	}
+	for(int i = 0; i < cpt; i++)
+	{
+		if(!std::isfinite(p[i]))
+		{
+			return PSvector(0);
+		}
+	}
+	return p;
+}
+
+void LatticeFunctionTable::Linearise(double cscale, const PSvector& p)
+{
+	frames.clear();
+	maps.clear();
+	linIn.clear();
+	linOut.clear();
+	orbits.assign(1, p);
+	momenta.assign(1, p0);
+
+	LinearMapTracker lmt(p0);
+	lmt.SetDelta(delta);
+	lmt.ScaleBendPathLength(cscale);
+	lmt.SetObserver([&](ComponentFrame* frame, const PSvector& x, const RealMatrix& J) {
+		frames.push_back(frame);
+		maps.push_back(J);
+		linIn.push_back(orbits.back());
+		linOut.push_back(x);
+		orbits.push_back(x);
+		momenta.push_back(lmt.GetFinalMomentum());
+	});
+
+	PSvector x = p;
+	RealMatrix M(6, 6);
+	lmt.Track(theModel->GetBeamline(), x, M);
+
+	mapScale = cscale;
+	haveMaps = true;
+	nUpdated = frames.size();
+}
+
+void LatticeFunctionTable::Relinearise(size_t n)
+{
+	LinearMapTracker lmt(momenta[n]);
+	lmt.SetDelta(delta);
+	lmt.ScaleBendPathLength(mapScale);
+
+	PSvector x = orbits[n];
+	lmt.Track(theModel->GetBeamline(n, n), x, maps[n]);
+	linIn[n] = orbits[n];
+	linOut[n] = x;
+	nUpdated++;
+}
+
+RealMatrix LatticeFunctionTable::OneTurnMap() const
+{
+	RealMatrix M = IdentityMatrix(6);
+	for(const RealMatrix& J : maps)
+	{
+		M = J * M;
 	}
+	return M;
+}
+
+void LatticeFunctionTable::FillTable(RealMatrix& M)
+{
+	int Ndim, Nsize;
+	for_each(lfnlist.begin(), lfnlist.end(), ClearLatticeFunction());
 
 	ComplexVector eigenvalues(3);
 	ComplexMatrix eigenvectors(3, 6);
@@ -341,9 +597,9 @@ double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMat
 	{
 		Symplectify(M);
 	}
-	bool eigenOK=EigenSystem(M, eigenvalues, eigenvectors);
-        Ndim = eigenOK ? 3 : 2 ; // drop longitudinal dimension if not convergent
-        Nsize=2*Ndim ; 
+	bool eigenOK = EigenSystem(M, eigenvalues, eigenvectors);
+	Ndim = eigenOK ? 3 : 2; // drop longitudinal dimension if not convergent
+	Nsize = 2 * Ndim;
 
 	int row, col;
 
@@ -359,9 +615,13 @@ double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMat
 			R(row, 2 * col + 1) = 0.0;
 		}
 	}
-        
-	ofstream nfile("DataFiles/NormMatrix.dat");
-	MatrixForm(N, nfile, OPFormat().precision(6).fixed());
+
+	ofstream nfile;
+	if(writeMatrices)
+	{
+		nfile.open("DataFiles/NormMatrix.dat");
+		MatrixForm(N, nfile, OPFormat().precision(6).fixed());
+	}
 
 	for(row = 0; row < Ndim; row++)
 	{
@@ -374,157 +634,202 @@ double LatticeFunctionTable::DoCalculate(double cscale, PSvector* pInit, RealMat
 		R(j, i) = -sin(theta);
 	}
 
-       
 	N = N * R;
-	nfile << endl;
-	MatrixForm(R, nfile, OPFormat().precision(6).fixed());
-	nfile << endl;
-	MatrixForm(N, nfile, OPFormat().precision(6).fixed());
-      
+	if(writeMatrices)
+	{
+		nfile << endl;
+		MatrixForm(R, nfile, OPFormat().precision(6).fixed());
+		nfile << endl;
+		MatrixForm(N, nfile, OPFormat().precision(6).fixed());
+	}
 
-	ParticleBunch* particle = new ParticleBunch(p0, 1.0);
-	particle->push_back(p);
-	particle->push_back(p);
+	// the maps are in the coordinates of each element; rescale them for a change in reference momentum
+	RealMatrix M21(Nsize);
+	RealMatrix M2 = IdentityMatrix(Nsize);
+	double s = 0;
 
-	for(row = 0; row < Nsize; row++)
+	for_each(lfnlist.begin(), lfnlist.end(), CalculateLatticeFunction(s, orbits[0], N, eigenOK));
+	for(size_t n = 0; n < maps.size(); n++)
 	{
-		Particle q = p;
-		q[row] += delta;
-		particle->push_back(q);
-	}
+		const double scale = sqrt(momenta[n + 1] / momenta[n]);
+		for(row = 0; row < Nsize; row++)
+		{
+			for(col = 0; col < Nsize; col++)
+			{
+				M21(row, col) = scale * maps[n](row, col);
+			}
+		}
 
-	ParticleTracker tracker(theModel->GetBeamline(), particle);
+		if(symplectify)
+		{
+			Symplectify(M21);
+		}
 
-	if(cscale)
+		N  = M21 * N;
+		if(writeMatrices)
+		{
+			M2 = M21 * M2;
+		}
+
+		if(frames[n]->IsComponent())
+		{
+			s += frames[n]->GetComponent().GetLength();
+		}
+		for_each(lfnlist.begin(), lfnlist.end(), CalculateLatticeFunction(s, orbits[n + 1], N, eigenOK));
+	}
+
+	if(writeMatrices)
 	{
-		RingDeltaTProcess* ringdt = new RingDeltaTProcess(2);
-		ringdt->SetBendScale(cscale);
-		tracker.AddProcess(ringdt);
+		ofstream mfile("TransferMatrix.dat");
+		MatrixForm(M2, mfile, OPFormat().precision(6).fixed());
 	}
+}
 
-	bool loop = true;
-	bool isMore = true;
-	tracker.InitStepper();
+void LatticeFunctionTable::FillOrbitTable()
+{
+	for_each(lfnlist.begin(), lfnlist.end(), ClearLatticeFunction());
 
-	RealMatrix M1 = IdentityMatrix(Nsize);
-	RealMatrix M2(Nsize);
-	RealMatrix M21(Nsize);
+	double s = 0;
+	RealMatrix N1(6);
+	for(size_t n = 0; n < frames.size(); n++)
+	{
+		for_each(lfnlist.begin(), lfnlist.end(), CalculateLatticeFunction(s, orbits[n], N1));
+		if(frames[n]->IsComponent())
+		{
+			s += frames[n]->GetComponent().GetLength();
+		}
+	}
+}
 
-	double e0 = particle->GetReferenceMomentum();
-	double e1 = e0;
-	double s  = 0;
+void LatticeFunctionTable::SetUpdateTolerance(double tol)
+{
+	updateTol = tol;
+}
 
-	do
-	{
+int LatticeFunctionTable::NumberOfUpdatedElements() const
+{
+	return nUpdated;
+}
 
-		ParticleBunch::iterator ip = tracker.GetTrackedBunch().begin();
-		Particle pref1 = *ip++;
-		Particle pref2 = *ip++;
+bool LatticeFunctionTable::SameBeamline()
+{
+	AcceleratorModel::Beamline bl = theModel->GetBeamline();
+	if(static_cast<size_t>(std::distance(bl.begin(), bl.end())) != frames.size())
+	{
+		return false;
+	}
+	return std::equal(frames.begin(), frames.end(), bl.begin());
+}
 
-		e1 = tracker.GetTrackedBunch().GetReferenceMomentum();
+bool LatticeFunctionTable::UpdateOrbit()
+{
+	// the energy is fixed when the transverse closed orbit alone is found
+	const int cpt = mapOrbitOnly ? 6 : 4;
+	const int maxIter = 10;
 
-		if(e1 != e0)
-			for(int row = 0; row < Nsize; row++)
+	for(int iter = 0; iter < maxIter; iter++)
+	{
+		if(!fixedOrbit)
+		{
+			// the one turn map is affine in the stored linear maps: x -> M x + A
+			PSvector A(0);
+			RealMatrix M = IdentityMatrix(6);
+			for(size_t n = 0; n < maps.size(); n++)
 			{
-				pref2[row] *= sqrt(e1 / e0);
+				A = LinearStep(maps[n], linIn[n], linOut[n], A);
+				M = maps[n] * M;
 			}
 
-		for(int col = 0; col < Nsize; col++, ip++)
-		{
-
-			if(e1 != e0)
-				for(int row = 0; row < Nsize; row++)
+			PSvector& x = orbits[0];
+			RealMatrix dg(cpt);
+			RealVector g(cpt);
+			for(int i = 0; i < cpt; i++)
+			{
+				g(i) = A[i] - x[i];
+				for(int j = 0; j < 6; j++)
 				{
-					(*ip)[row] *= sqrt(e1 / e0);
+					g(i) += M(i, j) * x[j];
 				}
-
-			for(int row = 0; row < Nsize; row++)
+				for(int j = 0; j < cpt; j++)
+				{
+					dg(i, j) = M(i, j) - (i == j ? 1 : 0);
+				}
+			}
+			SVDMatrix<double> svd(dg);
+			g = svd(g);
+			for(int i = 0; i < cpt; i++)
 			{
-				M2(row, col) = ((*ip)[row] - pref2[row]) / delta;
+				x[i] -= g(i);
 			}
 		}
 
-		e0 = e1;
-
-		M21 = M2 * M1;
-		M1  = M2;
-		Invert(M1);
-
-		if(symplectify)
+		// track elements again where the orbit has moved from the one they were linearised about
+		bool moved = false;
+		for(size_t n = 0; n < maps.size(); n++)
 		{
-			Symplectify(M21);
+			if(MaxDifference(orbits[n], linIn[n]) > updateTol)
+			{
+				Relinearise(n);
+				moved = true;
+			}
+			orbits[n + 1] = LinearStep(maps[n], linIn[n], linOut[n], orbits[n]);
 		}
 
-		N  = M21 * N;
-
-		for_each(lfnlist.begin(), lfnlist.end(), CalculateLatticeFunction(s, pref1, N,eigenOK));
-		if(isMore)
+		if(!moved)
 		{
-			s += tracker.GetCurrentComponent().GetLength();
-			isMore = tracker.StepComponent();
+			return true;
 		}
-		else
-		{
-			loop = false;
-		}
-
-	} while(loop);
-
-	ofstream mfile("TransferMatrix.dat");
-	MatrixForm(M2, mfile, OPFormat().precision(6).fixed());
-
-	delete particle;
-	return p.dp();
+	}
+	return false;
 }
 
-double LatticeFunctionTable::DoCalculateOrbitOnly(double cscale, PSvector* pInit)
+void LatticeFunctionTable::Update()
 {
-	for_each(lfnlist.begin(), lfnlist.end(), ClearLatticeFunction());
+	const unsigned long serial = ModelElement::GetLastModificationSerial();
 
-	PSvector p(0);
-	if(pInit)
+	bool full = !haveMaps || mapScale != bendscale || mapOrbitOnly != orbitonly || !SameBeamline();
+	for(size_t n = 0; !full && n < momenta.size(); n++)
 	{
-		p = *pInit;
+		full = momenta[n] != p0;
 	}
-	else
+	if(full)
 	{
-		ClosedOrbit co(theModel, p0);
-		co.SetDelta(delta);
-		co.ScaleBendPathLength(cscale);
-		co.FindClosedOrbit(p);
+		PSvector p = haveMaps ? orbits[0] : PSvector(0);
+		Calculate(haveMaps && fixedOrbit ? &p : nullptr);
+		return;
 	}
 
-	ParticleBunch* particle = new ParticleBunch(p0, 1.0);
-	particle->push_back(p);
-
-	ParticleTracker tracker(theModel->GetBeamline(), particle);
-
-	if(cscale)
+	nUpdated = 0;
+	if(serial == mapSerial)
 	{
-		RingDeltaTProcess* ringdt = new RingDeltaTProcess(2);
-		ringdt->SetBendScale(cscale);
-		tracker.AddProcess(ringdt);
+		return;
 	}
 
-	bool loop = true;
-	tracker.InitStepper();
-
-	double s = 0;
-	RealMatrix N1(6);
-
-	do
+	for(size_t n = 0; n < frames.size(); n++)
 	{
+		if(ChangedSince(frames[n], mapSerial))
+		{
+			Relinearise(n);
+		}
+	}
+	mapSerial = serial;
 
-		ParticleBunch::const_iterator ip = tracker.GetTrackedBunch().begin();
-		const Particle& pref = *ip++;
-
-		for_each(lfnlist.begin(), lfnlist.end(), CalculateLatticeFunction(s, pref, N1));
-		s += tracker.GetCurrentComponent().GetLength();
-		loop = tracker.StepComponent();
-
-	} while(loop);
+	if(!UpdateOrbit())
+	{
+		PSvector p = orbits[0];
+		Calculate(fixedOrbit ? &p : nullptr);
+		return;
+	}
 
-	return p.dp();
+	if(orbitonly)
+	{
+		FillOrbitTable();
+	}
+	else
+	{
+		RealMatrix M = OneTurnMap();
+		FillTable(M);
+	}
 }
 
 struct PrintLatticeFunction
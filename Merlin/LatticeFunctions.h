@@ -8,7 +8,9 @@
 #ifndef LatticeFunctions_h
 #define LatticeFunctions_h 1
 
+#include <vector>
 #include "PSvector.h"
+#include "AcceleratorModel.h"
 
 class LatticeFunction
 {
@@ -42,7 +44,41 @@ public:
 	void RemoveFunction(int i, int j, int k);
 	void RemoveAllFunctions();
 	void Calculate(PSvector* p = nullptr, RealMatrix* M = nullptr);
+
+	/**
+	 * Brings the table up to date after changes to the model.
+	 * The linear map of each element about the orbit is kept from
+	 * the last calculation, and only the elements changed since
+	 * (see ModelElement::SetModified()), or whose orbit has moved
+	 * by more than the update tolerance, are tracked again. The
+	 * closed orbit and the rows are then found from the stored
+	 * maps. Falls back to Calculate() if the beamline has changed,
+	 * the reference momentum varies along the lattice or the table
+	 * holds energy derivatives.
+	 */
+	void Update();
+	void SetUpdateTolerance(double tol);
+
+	/// Number of elements tracked again by the last Update()
+	int NumberOfUpdatedElements() const;
+
+	/**
+	 * Replaces the table with the derivatives of the functions
+	 * with respect to dp, from the tables at a positive and a
+	 * negative bend path length scale. The two calculations are
+	 * independent, and run in parallel when built with
+	 * ENABLE_OPENMP, provided the default integrator set is
+	 * TRANSPORT and no monitor is recording; otherwise they
+	 * share the model and run one after the other.
+	 */
 	void CalculateEnergyDerivative();
+
+	/**
+	 * When set, each calculation writes the normalising matrices
+	 * to DataFiles/NormMatrix.dat and the transfer matrix to
+	 * TransferMatrix.dat. Default: false.
+	 */
+	void WriteMatrices(bool flag);
 	double Value(int i, int j, int k, int ncpt);
 	void PrintTable(ostream& os, int n1 = 0, int n2 = -1);
 	void Size(int& rows, int& cols);
@@ -61,11 +97,35 @@ private:
 	double bendscale;
 	bool symplectify;
 	bool orbitonly;
+	bool writeMatrices;
 
 	vectorlfn lfnlist;
 
+	// Linear map of each element about the orbit, kept for Update()
+	bool haveMaps;
+	bool mapOrbitOnly;
+	bool fixedOrbit;
+	double mapScale;
+	unsigned long mapSerial;
+	double updateTol;
+	int nUpdated;
+	std::vector<ComponentFrame*> frames;
+	std::vector<RealMatrix> maps;
+	std::vector<PSvector> linIn;
+	std::vector<PSvector> linOut;
+	std::vector<PSvector> orbits;
+	std::vector<double> momenta;
+
 	double DoCalculate(double cscale = 0, PSvector* pInit = nullptr, RealMatrix* MInit = nullptr);
 	double DoCalculateOrbitOnly(double cscale = 0, PSvector* pInit = nullptr);
+	PSvector StartingOrbit(int cpt) const;
+	void Linearise(double cscale, const PSvector& p);
+	void Relinearise(size_t n);
+	bool UpdateOrbit();
+	bool SameBeamline();
+	RealMatrix OneTurnMap() const;
+	void FillTable(RealMatrix& M);
+	void FillOrbitTable();
 	vectorlfn::iterator GetColumn(int i, int j, int k);
 };
 
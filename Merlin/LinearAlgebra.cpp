@@ -93,7 +93,6 @@ template<class T> double Inverse(Matrix<T>& a)
 		}
 		if(minpiv == 0.0)
 		{
-			cout << "Singular" << endl;
 			throw TLAS::SingularMatrix();
 		}
 
@@ -176,7 +175,20 @@ bool EigenSystem(RealMatrix& t, ComplexVector& eigenvalues, ComplexMatrix& eigen
 			}
 
 			ComplexMatrix minv(mp);
-			prox = Inverse(minv);
+			try
+			{
+				prox = Inverse(minv);
+			}
+			catch(TLAS::SingularMatrix&)
+			{
+				// lambda is an exact eigenvalue, as for the longitudinal plane of an exact
+				// map without RF. Step off the real axis, as rounding errors in a tracked
+				// map would, so that the iteration still finds an eigenvector. The step
+				// counts as an iteration, so a matrix that stays singular cannot loop forever.
+				lambda += Complex(0, 1.0e-8);
+				iter++;
+				continue;
+			}
 
 			ComplexVector y(6);
 			for(row = 0; row < 6; row++)
@@ -0,0 +1,167 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "LinearMapTracker.h"
+#include "ComponentFrame.h"
+#include "ParticleComponentTracker.h"
+#include "SectorBend.h"
+
+namespace ParticleTracking
+{
+
+LinearMapBunch::LinearMapBunch(double P0, const PSvector& orbit, double Q) :
+	ParticleBunch(P0, Q), M(IdentityMatrix(6)), linearised(false)
+{
+	push_back(orbit);
+}
+
+void LinearMapBunch::Concatenate(const RealMatrix& J)
+{
+	M = J * M;
+}
+
+LinearMapTracker::LinearMapTracker(double refMomentum) :
+	p0(refMomentum), bendscale(0), delta(1.0e-7), finalMomentum(refMomentum), nNumerical(0)
+{
+}
+
+void LinearMapTracker::ScaleBendPathLength(double scale)
+{
+	bendscale = scale;
+}
+
+void LinearMapTracker::SetDelta(double new_delta)
+{
+	delta = new_delta;
+}
+
+void LinearMapTracker::SetObserver(const FrameObserver& obs)
+{
+	observer = obs;
+}
+
+void LinearMapTracker::Track(const AcceleratorModel::Beamline& beamline, PSvector& orbit, RealMatrix& M)
+{
+	if(beamline.begin() == beamline.end())
+	{
+		M = IdentityMatrix(6);
+		finalMomentum = p0;
+		nNumerical = 0;
+		return;
+	}
+	DoTrack(beamline.begin(), beamline.end(), orbit, M);
+}
+
+void LinearMapTracker::Track(AcceleratorModel::RingIterator ring, PSvector& orbit, RealMatrix& M)
+{
+	DoTrack(ring, ring, orbit, M);
+}
+
+template<class II>
+void LinearMapTracker::DoTrack(II first, II last, PSvector& orbit, RealMatrix& M)
+{
+	LinearMapBunch bunch(p0, orbit);
+	ParticleComponentTracker tracker;
+	tracker.SetBunch(bunch);
+
+	M = IdentityMatrix(6);
+	RealMatrix J(6, 6);
+	nNumerical = 0;
+
+	// the same sequence of operations as the tracking in TrackingSimulation
+	do
+	{
+		ComponentFrame* frame = *first;
+		const bool aligned = !frame->GetEntranceGeometryPatch() && !frame->GetExitGeometryPatch()
+			&& frame->GetEntrancePlaneTransform().isIdentity() && frame->GetExitPlaneTransform().isIdentity();
+
+		const PSvector in = bunch.FirstParticle();
+		const double P0 = bunch.GetReferenceMomentum();
+		bool linearised = aligned;
+		if(aligned && frame->IsComponent())
+		{
+			bunch.M = IdentityMatrix(6);
+			bunch.linearised = false;
+			tracker(&frame->GetComponent());
+			linearised = bunch.linearised;
+			J = bunch.M;
+		}
+		else if(aligned)
+		{
+			J = IdentityMatrix(6);
+		}
+
+		if(!linearised)
+		{
+			double P1;
+			NumericalMap(frame, in, P0, J, bunch.FirstParticle(), P1);
+			bunch.SetReferenceMomentum(P1);
+			nNumerical++;
+		}
+
+		if(bendscale != 0 && frame->IsComponent() && dynamic_cast<SectorBend*>(&frame->GetComponent()))
+		{
+			bunch.FirstParticle().ct() += bendscale * frame->GetComponent().GetLength();
+		}
+
+		M = J * M;
+		finalMomentum = bunch.GetReferenceMomentum();
+		if(observer)
+		{
+			observer(frame, bunch.FirstParticle(), J);
+		}
+	} while(++first != last);
+
+	orbit = bunch.FirstParticle();
+	finalMomentum = bunch.GetReferenceMomentum();
+}
+
+void LinearMapTracker::NumericalMap(ComponentFrame* frame, const PSvector& orbit, double P0, RealMatrix& J,
+	PSvector& out, double& P1)
+{
+	ParticleBunch rays(P0, 1.0);
+	rays.push_back(orbit);
+	for(int k = 0; k < 6; k++)
+	{
+		for(double sign : {1.0, -1.0})
+		{
+			PSvector p = orbit;
+			p[k] += sign * delta;
+			rays.push_back(p);
+		}
+	}
+
+	rays.ApplyTransformation(frame->GetEntrancePlaneTransform());
+	if(const Transform3D* t = frame->GetEntranceGeometryPatch())
+	{
+		rays.ApplyTransformation(*t);
+	}
+	if(frame->IsComponent())
+	{
+		ParticleComponentTracker tracker;
+		tracker.SetBunch(rays);
+		tracker(&frame->GetComponent());
+	}
+	if(const Transform3D* t = frame->GetExitGeometryPatch())
+	{
+		rays.ApplyTransformation(*t);
+	}
+	rays.ApplyTransformation(frame->GetExitPlaneTransform());
+
+	const PSvectorArray& p = rays.GetParticles();
+	for(int k = 0; k < 6; k++)
+	{
+		for(int m = 0; m < 6; m++)
+		{
+			J(m, k) = (p[2 * k + 1][m] - p[2 * k + 2][m]) / (2 * delta);
+		}
+	}
+	out = p[0];
+	P1 = rays.GetReferenceMomentum();
+}
+
+} // end namespace ParticleTracking
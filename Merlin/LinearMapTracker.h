@@ -0,0 +1,137 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef LinearMapTracker_h
+#define LinearMapTracker_h 1
+
+#include "merlin_config.h"
+#include <functional>
+#include "AcceleratorModel.h"
+#include "LinearAlgebra.h"
+#include "ParticleBunch.h"
+
+namespace ParticleTracking
+{
+
+/**
+ *	A single particle bunch which also carries the Jacobian of
+ *	the map tracked so far, taken about that particle.
+ *
+ *	Integrators which know the exact first order form of their
+ *	map call Concatenate() with the Jacobian of each step, taken
+ *	about the particle before the step is applied, and set
+ *	linearised. Integrators which do not touch the bunch leave
+ *	linearised unset, and LinearMapTracker then finds the map of
+ *	that component numerically.
+ */
+class LinearMapBunch: public ParticleBunch
+{
+public:
+	LinearMapBunch(double P0, const PSvector& orbit, double Q = 1);
+
+	/// M = J * M
+	void Concatenate(const RealMatrix& J);
+
+	/// Returns the bunch as a LinearMapBunch, or nullptr for any other bunch
+	static LinearMapBunch* Cast(ParticleBunch& bunch)
+	{
+		return dynamic_cast<LinearMapBunch*>(&bunch);
+	}
+
+	/// Flags that the current component's integrator propagates the map
+	static void MarkLinearised(ParticleBunch& bunch)
+	{
+		if(LinearMapBunch* lm = Cast(bunch))
+		{
+			lm->linearised = true;
+		}
+	}
+
+	/// Jacobian of the map tracked so far
+	RealMatrix M;
+
+	/// True if the integrator of the current component has updated M
+	bool linearised;
+};
+
+/**
+ *	Tracks a single orbit through a beamline or ring, and returns
+ *	the linear (first order) map about that orbit as the product
+ *	of the maps of each element.
+ *
+ *	Elements whose integrator gives its own linear map (the
+ *	default TRANSPORT drift, multipole, bend, marker and monitor
+ *	integrators) contribute an exact Jacobian. Any other element,
+ *	and any misaligned frame, is linearised by central differences
+ *	through that element alone. The result replaces the
+ *	finite difference tracking of rays around the whole ring.
+ *
+ *	Processes are not supported: synchrotron radiation needs
+ *	the full tracking in TransferMatrix and ClosedOrbit. The
+ *	ScaleBendPathLength() option applies the same ct offset in
+ *	sector bends as RingDeltaTProcess.
+ */
+class LinearMapTracker
+{
+public:
+	/**
+	 *	Called after each frame with the frame, the orbit at its
+	 *	exit and the map of that frame alone.
+	 */
+	typedef std::function<void (ComponentFrame*, const PSvector&, const RealMatrix&)> FrameObserver;
+
+	explicit LinearMapTracker(double refMomentum);
+
+	void ScaleBendPathLength(double scale);
+
+	/// Step used for elements linearised numerically, default 1.0e-7
+	void SetDelta(double new_delta);
+
+	void SetObserver(const FrameObserver& obs);
+
+	/**
+	 *	Tracks orbit through the beamline. On return orbit holds
+	 *	the final orbit and M the map about the initial orbit.
+	 */
+	void Track(const AcceleratorModel::Beamline& beamline, PSvector& orbit, RealMatrix& M);
+
+	/**
+	 *	As above, once around the ring.
+	 */
+	void Track(AcceleratorModel::RingIterator ring, PSvector& orbit, RealMatrix& M);
+
+	/// Reference momentum after the last Track(), or after the current frame when called from the observer
+	double GetFinalMomentum() const
+	{
+		return finalMomentum;
+	}
+
+	/// Number of elements linearised numerically in the last Track()
+	size_t GetNumericalCount() const
+	{
+		return nNumerical;
+	}
+
+private:
+	template<class II>
+	void DoTrack(II first, II last, PSvector& orbit, RealMatrix& M);
+
+	/// Central difference map of one frame, with its misalignment transforms
+	void NumericalMap(ComponentFrame* frame, const PSvector& orbit, double P0, RealMatrix& J, PSvector& out,
+		double& P1);
+
+	double p0;
+	double bendscale;
+	double delta;
+	double finalMomentum;
+	size_t nNumerical;
+	FrameObserver observer;
+};
+
+} // end namespace ParticleTracking
+
+#endif
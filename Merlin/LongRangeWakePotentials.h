@@ -0,0 +1,88 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef LongRangeWakePotentials_h
+#define LongRangeWakePotentials_h 1
+
+#include <cmath>
+#include <vector>
+
+#include "merlin_config.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "WakePotentials.h"
+
+/**
+ * The transverse wake of the long-range dipole modes of a cavity, as
+ * a sum of resonators
+ * \f[
+ *    W_\perp(z) = \sum_n k_n \sin(\omega_n z/c) e^{-\omega_n z / 2 Q_n c}
+ * \f]
+ * per unit length of the cavity, for z > 0 behind the source.
+ *
+ * Attached to a cavity, the wake is left behind by each bunch of a train
+ * for the bunches that follow, by LongRangeWakeProcess. The same sum is
+ * returned by Wtrans(), so a WakeFieldProcess will apply it within a
+ * bunch unless the expected process is set to another process type.
+ */
+class LongRangeWakePotentials: public WakePotentials
+{
+public:
+
+	struct Mode
+	{
+		/// Frequency in Hz
+		double frequency;
+		/// Quality factor
+		double Q;
+		/// Kick factor in V/C/m^2
+		double kick;
+	};
+
+	/**
+	 * Add a dipole mode.
+	 * @param[in] f Frequency in Hz
+	 * @param[in] Q Quality factor
+	 * @param[in] k Kick factor in V/C/m^2
+	 */
+	void AddMode(double f, double Q, double k)
+	{
+		Mode m = {f, Q, k};
+		modes.push_back(m);
+	}
+
+	const std::vector<Mode>& GetModes() const
+	{
+		return modes;
+	}
+
+	double Wlong(double z) const
+	{
+		return 0;
+	}
+
+	double Wtrans(double z) const
+	{
+		if(z <= 0)
+		{
+			return 0;
+		}
+		double w = 0;
+		for(const Mode& m : modes)
+		{
+			const double kz = twoPi * m.frequency * z / PhysicalConstants::SpeedOfLight;
+			w += m.kick * sin(kz) * exp(-kz / (2 * m.Q));
+		}
+		return w;
+	}
+
+private:
+
+	std::vector<Mode> modes;
+};
+
+#endif
@@ -0,0 +1,133 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cmath>
+
+#include "AcceleratorComponent.h"
+#include "LongRangeWakePotentials.h"
+#include "LongRangeWakeProcess.h"
+#include "MerlinException.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "utils.h"
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+namespace ParticleTracking
+{
+
+void LongRangeWakeMemory::Clear()
+{
+	cavities.clear();
+}
+
+bool LongRangeWakeMemory::AddCavity(const AcceleratorComponent& cavity)
+{
+	return cavities.insert(make_pair(&cavity, CavityWake())).second;
+}
+
+void LongRangeWakeMemory::Passage(const AcceleratorComponent& cavity, const LongRangeWakePotentials& wake, double t,
+	double q, double x, double y, double& wx, double& wy)
+{
+	auto it = cavities.find(&cavity);
+	if(it == cavities.end())
+	{
+		it = cavities.insert(make_pair(&cavity, CavityWake())).first;
+	}
+	CavityWake& w = it->second;
+	if(!w.empty && t < w.t)
+	{
+		throw MerlinException("LongRangeWakeMemory: bunches must pass " + cavity.GetQualifiedName() + " in train order");
+	}
+
+	const vector<LongRangeWakePotentials::Mode>& modes = wake.GetModes();
+	w.ax.resize(modes.size());
+	w.ay.resize(modes.size());
+	const double dt = w.empty ? 0 : t - w.t;
+
+	wx = 0;
+	wy = 0;
+	for(size_t n = 0; n < modes.size(); n++)
+	{
+		const double omega = twoPi * modes[n].frequency;
+		const complex<double> turn = exp(complex<double>(-omega / (2 * modes[n].Q), omega) * dt);
+		w.ax[n] *= turn;
+		w.ay[n] *= turn;
+		wx += modes[n].kick * w.ax[n].imag();
+		wy += modes[n].kick * w.ay[n].imag();
+		w.ax[n] += q * x;
+		w.ay[n] += q * y;
+	}
+	w.t = t;
+	w.empty = false;
+}
+
+LongRangeWakeProcess::LongRangeWakeProcess(int prio, LongRangeWakeMemory& mem, double t) :
+	ParticleBunchProcess("LONG RANGE WAKE", prio), memory(mem), arrivalTime(t), currentWake(nullptr), clen(0),
+	current_s(0)
+{
+}
+
+void LongRangeWakeProcess::SetCurrentComponent(AcceleratorComponent& component)
+{
+	currentWake = dynamic_cast<const LongRangeWakePotentials*>(component.GetWakePotentials());
+	if(currentBunch != nullptr && currentWake != nullptr && !currentWake->GetModes().empty())
+	{
+		currentComponent = &component;
+		clen = component.GetLength();
+		current_s = 0;
+		active = true;
+	}
+	else
+	{
+		currentComponent = nullptr;
+		active = false;
+	}
+}
+
+void LongRangeWakeProcess::DoProcess(double ds)
+{
+	current_s += ds;
+	if(!fequal(current_s, clen))
+	{
+		return;
+	}
+
+	// the bunch is kicked, and leaves its wake, at the cavity exit
+	double q = 0, x = 0, y = 0;
+	if(currentBunch->size() > 0)
+	{
+		PSvector c;
+		currentBunch->GetCentroid(c);
+		q = fabs(currentBunch->GetTotalCharge()) * ElectronCharge;
+		x = c.x();
+		y = c.y();
+	}
+
+	double wx, wy;
+	memory.Passage(*currentComponent, *currentWake, arrivalTime, q, x, y, wx, wy);
+
+	const double p0 = currentBunch->GetReferenceMomentum();
+	const double dxp = clen * wx * Volt / p0;
+	const double dyp = clen * wy * Volt / p0;
+	for(ParticleBunch::iterator p = currentBunch->begin(); p != currentBunch->end(); p++)
+	{
+		p->xp() += dxp;
+		p->yp() += dyp;
+	}
+	active = false;
+}
+
+double LongRangeWakeProcess::GetMaxAllowedStepSize() const
+{
+	return clen - current_s;
+}
+
+} // end namespace ParticleTracking
@@ -0,0 +1,133 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef LongRangeWakeProcess_h
+#define LongRangeWakeProcess_h 1
+
+#include <complex>
+#include <map>
+#include <vector>
+
+#include "merlin_config.h"
+#include "ParticleBunchProcess.h"
+
+class AcceleratorComponent;
+class LongRangeWakePotentials;
+
+namespace ParticleTracking
+{
+
+/**
+ * The long-range wakes left in each cavity by the bunches of a train
+ * that have passed through it.
+ *
+ * For each cavity the wake of every mode is held as one complex
+ * amplitude, the sum over the earlier bunches of q x exp((i - 1/2Q) w t)
+ * for a bunch of charge q and offset x that passed a time t ago. A
+ * bunch arriving at the cavity turns and damps the amplitudes by the
+ * time since the bunch ahead of it, is kicked by their imaginary parts,
+ * and adds its own dipole moment. The cost of each passage is
+ * proportional to the number of modes, not to the number of bunches
+ * ahead.
+ *
+ * The memory is shared by the LongRangeWakeProcess of every bunch, and
+ * the bunches must reach each cavity in train order. Different cavities
+ * may be passed at the same time from different threads, but only if
+ * they have all been added with AddCavity() first.
+ */
+class LongRangeWakeMemory
+{
+public:
+
+	/**
+	 * Forget all the wakes.
+	 */
+	void Clear();
+
+	/**
+	 * Add an empty wake for the cavity, if it has none yet.
+	 * @retval true If the cavity was added
+	 * @retval false If the cavity already had a wake
+	 */
+	bool AddCavity(const AcceleratorComponent& cavity);
+
+	/**
+	 * Pass a bunch through the cavity.
+	 * @param[in] cavity The cavity
+	 * @param[in] wake The long-range modes of the cavity
+	 * @param[in] t The arrival time of the bunch in s
+	 * @param[in] q The bunch charge in C
+	 * @param[in] x The horizontal centroid of the bunch
+	 * @param[in] y The vertical centroid of the bunch
+	 * @param[out] wx The horizontal deflecting voltage seen by the bunch, per unit length of cavity, in V/m
+	 * @param[out] wy The vertical deflecting voltage seen by the bunch, per unit length of cavity, in V/m
+	 */
+	void Passage(const AcceleratorComponent& cavity, const LongRangeWakePotentials& wake, double t, double q,
+		double x, double y, double& wx, double& wy);
+
+private:
+
+	struct CavityWake
+	{
+		CavityWake() :
+			t(0), empty(true)
+		{
+		}
+		/// Arrival time of the last bunch
+		double t;
+		bool empty;
+		std::vector<std::complex<double> > ax;
+		std::vector<std::complex<double> > ay;
+	};
+
+	std::map<const AcceleratorComponent*, CavityWake> cavities;
+};
+
+/**
+ * Applies the long-range dipole wakes of cavities with
+ * LongRangeWakePotentials, left by the bunches ahead in a train.
+ *
+ * Each bunch of the train has its own process, constructed with the
+ * time at which the bunch arrives behind the head of the train and the
+ * LongRangeWakeMemory shared by the train. At the exit of each cavity
+ * the whole bunch is kicked by the wake at its arrival time, and then
+ * leaves its own wake behind. The kick is the same for every particle
+ * of the bunch; the wake within a bunch is left to WakeFieldProcess.
+ *
+ * @see BunchTrainTracker
+ */
+class LongRangeWakeProcess: public ParticleBunchProcess
+{
+public:
+
+	/**
+	 * @param[in] prio Process priority
+	 * @param[in] memory The wakes shared by the bunches of the train
+	 * @param[in] t The arrival time of the bunch in s, behind the head of the train
+	 */
+	LongRangeWakeProcess(int prio, LongRangeWakeMemory& memory, double t);
+
+	virtual void SetCurrentComponent(AcceleratorComponent& component);
+	virtual void DoProcess(double ds);
+	virtual double GetMaxAllowedStepSize() const;
+
+private:
+
+	LongRangeWakeMemory& memory;
+	double arrivalTime;
+	const LongRangeWakePotentials* currentWake;
+	double clen;
+	double current_s;
+
+	//Copy protection
+	LongRangeWakeProcess(const LongRangeWakeProcess& rhs);
+	LongRangeWakeProcess& operator=(const LongRangeWakeProcess& rhs);
+};
+
+} // end namespace ParticleTracking
+
+#endif
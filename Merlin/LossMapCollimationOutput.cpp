@@ -76,6 +76,10 @@ LossMapCollimationOutput::LossMapCollimationOutput(OutputType ot)
 	otype = ot;
 }
 
+LossMapCollimationOutput::~LossMapCollimationOutput()
+{
+}
+
 void LossMapCollimationOutput::Finalise()
 {
 	//First sort DeadParticles according to s
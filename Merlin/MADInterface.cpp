@@ -87,9 +87,29 @@ inline double SRdE(double h, double len, double E)
 	return Cg * pow(E, 4) * h * h * len;
 }
 
+namespace
+{
+DataTable::ColumnHandle OptionalColumn(const DataTable& table, const string& col_name)
+{
+	return table.HasCol(col_name) ? table.GetColumnHandle(col_name) : DataTable::ColumnHandle();
+}
+}
+
+MADTableColumns::MADTableColumns(const DataTable& table) :
+	name(OptionalColumn(table, "NAME")), keyword(OptionalColumn(table, "KEYWORD")), l(OptionalColumn(table, "L")),
+	angle(OptionalColumn(table, "ANGLE")), k0l(OptionalColumn(table, "K0L")), k1l(OptionalColumn(table, "K1L")),
+	k2l(OptionalColumn(table, "K2L")), k3l(OptionalColumn(table, "K3L")), k4l(OptionalColumn(table, "K4L")),
+	tilt(OptionalColumn(table, "TILT")), e1(OptionalColumn(table, "E1")), e2(OptionalColumn(table, "E2")),
+	hkick(OptionalColumn(table, "HKICK")), vkick(OptionalColumn(table, "VKICK")), ks(OptionalColumn(table, "KS")),
+	freq(OptionalColumn(table, "FREQ")), lag(OptionalColumn(table, "LAG")), volt(OptionalColumn(table, "VOLT")),
+	mux(OptionalColumn(table, "MUX")), muy(OptionalColumn(table, "MUY"))
+{
+}
+
 AcceleratorModel* MADInterface::ConstructModel()
 {
 	unique_ptr<DataTable> MADinput(DataTableReaderTFS(filename).Read());
+	const MADTableColumns col(*MADinput);
 
 	if(modelconstr != nullptr && appendFlag == false)
 	{
@@ -107,18 +127,18 @@ AcceleratorModel* MADInterface::ConstructModel()
 	//Loop over all components
 	for(size_t i = 0; i < MADinput->Length(); ++i)
 	{
-		string type = MADinput->Get_s("KEYWORD", i);
-		double length = MADinput->Get_d("L", i);
+		string type = MADinput->Get_s(col.keyword, i);
+		double length = MADinput->Get_d(col.l, i);
 
 		if(length == 0 && zeroLengths.find(type) != zeroLengths.end())
 		{
-			MerlinIO::warning() << "Ignoring zero length " << type << ": " << MADinput->Get_s("NAME", i) << endl;
+			MerlinIO::warning() << "Ignoring zero length " << type << ": " << MADinput->Get_s(col.name, i) << endl;
 			continue;
 		}
-		TypeOverrides(MADinput, i);
+		TypeOverrides(MADinput, col, i);
 
 		//Determine multipole type by parameters
-		AcceleratorComponent* component = factory->GetInstance(MADinput, energy, brho, i);
+		AcceleratorComponent* component = factory->GetInstance(MADinput, col, energy, brho, i);
 
 		if(component != nullptr)
 		{
@@ -149,28 +169,38 @@ AcceleratorModel* MADInterface::ConstructModel()
 
 void MADInterface::TypeOverrides(unique_ptr<DataTable>& MADinput, size_t index)
 {
-	string keyword = MADinput->Get_s("KEYWORD", index);
+	TypeOverrides(MADinput, MADTableColumns(*MADinput), index);
+}
+
+void MADInterface::TypeOverrides(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, size_t index)
+{
+	string keyword = MADinput->Get_s(col.keyword, index);
 	if(driftTypes.find(keyword) != driftTypes.end())
-		MADinput->Set_s("KEYWORD", index, "DRIFT");
+		MADinput->Set_s(col.keyword, index, "DRIFT");
 	if(keyword == "LCAV")
-		MADinput->Set_s("KEYWORD", index, "RFCAVITY");
+		MADinput->Set_s(col.keyword, index, "RFCAVITY");
 	if(keyword == "RCOLLIMATOR" || keyword == "ECOLLIMATOR")
-		MADinput->Set_s("KEYWORD", index, "COLLIMATOR");
-	if(keyword == "RBEND" && MADinput->Get_d("K0L", index))
-		MADinput->Set_s("KEYWORD", index, "SBEND");
+		MADinput->Set_s(col.keyword, index, "COLLIMATOR");
+	if(keyword == "RBEND" && MADinput->Get_d(col.k0l, index))
+		MADinput->Set_s(col.keyword, index, "SBEND");
 }
 
 string MADInterface::GetMutipoleType(unique_ptr<DataTable>& MADinput, size_t index)
 {
-	if(!MADinput->Get_d("K0L", index))
+	return GetMutipoleType(MADinput, MADTableColumns(*MADinput), index);
+}
+
+string MADInterface::GetMutipoleType(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, size_t index)
+{
+	if(!MADinput->Get_d(col.k0l, index))
 		return "SBEND";
-	if(!MADinput->Get_d("K1L", index))
+	if(!MADinput->Get_d(col.k1l, index))
 		return "QUADRUPOLE";
-	if(!MADinput->Get_d("K2L", index))
+	if(!MADinput->Get_d(col.k2l, index))
 		return "SEXTUPOLE";
-	if(!MADinput->Get_d("K3L", index))
+	if(!MADinput->Get_d(col.k3l, index))
 		return "OCTUPOLE";
-	if(!MADinput->Get_d("K4L", index))
+	if(!MADinput->Get_d(col.k4l, index))
 		return "DECAPOLE";
 	return "DRIFT";
 }
@@ -308,11 +338,11 @@ void MADInterface::TreatTypeAsDrift(const std::string& typestr)
 	driftTypes.insert(typestr);
 }
 
-AcceleratorComponent* DriftComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* DriftComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	if(length != 0)
 		return new Drift(name, length);
@@ -320,14 +350,14 @@ AcceleratorComponent* DriftComponent::GetInstance(unique_ptr<DataTable>& MADinpu
 		return nullptr;
 }
 
-AcceleratorComponent* RBendComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* RBendComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double angle = MADinput->Get_d("ANGLE", id);
-	double k1l = MADinput->Get_d("K1L", id);
-	double tilt = MADinput->Get_d("TILT", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double angle = MADinput->Get_d(col.angle, id);
+	double k1l = MADinput->Get_d(col.k1l, id);
+	double tilt = MADinput->Get_d(col.tilt, id);
 	double h = angle / length;
 
 	SectorBend* bend = new SectorBend(name, length, h, brho * h);
@@ -335,8 +365,8 @@ AcceleratorComponent* RBendComponent::GetInstance(unique_ptr<DataTable>& MADinpu
 	if(k1l)
 		bend->SetB1(brho * k1l / length);
 
-	double e1 = MADinput->Get_d("E1", id);
-	double e2 = MADinput->Get_d("E2", id);
+	double e1 = MADinput->Get_d(col.e1, id);
+	double e2 = MADinput->Get_d(col.e2, id);
 
 	if(e1 != 0 || e2 != 0)
 	{
@@ -358,14 +388,14 @@ AcceleratorComponent* RBendComponent::GetInstance(unique_ptr<DataTable>& MADinpu
 	return bend;
 }
 
-AcceleratorComponent* SBendComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* SBendComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double angle = MADinput->Get_d("ANGLE", id);
-	double k1l = MADinput->Get_d("K1L", id);
-	double tilt = MADinput->Get_d("TILT", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double angle = MADinput->Get_d(col.angle, id);
+	double k1l = MADinput->Get_d(col.k1l, id);
+	double tilt = MADinput->Get_d(col.tilt, id);
 	double h = angle / length;
 
 	SectorBend* bend = new SectorBend(name, length, h, brho * h);
@@ -373,8 +403,8 @@ AcceleratorComponent* SBendComponent::GetInstance(unique_ptr<DataTable>& MADinpu
 	if(k1l)
 		bend->SetB1(brho * k1l / length);
 
-	double e1 = MADinput->Get_d("E1", id);
-	double e2 = MADinput->Get_d("E2", id);
+	double e1 = MADinput->Get_d(col.e1, id);
+	double e2 = MADinput->Get_d(col.e2, id);
 
 	if(e1 || e2)
 	{
@@ -396,78 +426,80 @@ AcceleratorComponent* SBendComponent::GetInstance(unique_ptr<DataTable>& MADinpu
 	return bend;
 }
 
-AcceleratorComponent* QuadrupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* QuadrupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double k1l = MADinput->Get_d("K1L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double k1l = MADinput->Get_d(col.k1l, id);
 
 	return new Quadrupole(name, length, brho * k1l / length);
 }
 
-AcceleratorComponent* SkewQuadrupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* SkewQuadrupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double k1l = MADinput->Get_d("K1L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double k1l = MADinput->Get_d(col.k1l, id);
 
 	return new SkewQuadrupole(name, length, brho * k1l / length);
 }
 
-AcceleratorComponent* SextupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* SextupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double k2l = MADinput->Get_d("K2L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double k2l = MADinput->Get_d(col.k2l, id);
 
 	return new Sextupole(name, length, brho * k2l / length);
 }
 
-AcceleratorComponent* SkewSextupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* SkewSextupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double k2l = MADinput->Get_d("K2L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double k2l = MADinput->Get_d(col.k2l, id);
 
 	return new SkewSextupole(name, length, brho * k2l / length);
 }
 
-AcceleratorComponent* OctupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* OctupoleComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double k3l = MADinput->Get_d("K3L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double k3l = MADinput->Get_d(col.k3l, id);
 
 	return new Octupole(name, length, brho * k3l / length);
 }
 
-AcceleratorComponent* YCorComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+AcceleratorComponent* YCorComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new YCor(name, length);
 }
 
-AcceleratorComponent* XCorComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+AcceleratorComponent* XCorComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new XCor(name, length);
 }
 
-AcceleratorComponent* VKickerComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* VKickerComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double kick = MADinput->Get_d("VKICK", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double kick = MADinput->Get_d(col.vkick, id);
 	double scale;
 	if(length > 0)
 		scale = brho / length;
@@ -477,12 +509,12 @@ AcceleratorComponent* VKickerComponent::GetInstance(unique_ptr<DataTable>& MADin
 	return new YCor(name, length, scale * kick);
 }
 
-AcceleratorComponent* HKickerComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* HKickerComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double kick = MADinput->Get_d("HKICK", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double kick = MADinput->Get_d(col.hkick, id);
 	double scale;
 	if(length > 0)
 		scale = brho / length;
@@ -492,25 +524,25 @@ AcceleratorComponent* HKickerComponent::GetInstance(unique_ptr<DataTable>& MADin
 	return new XCor(name, length, -scale * kick);
 }
 
-AcceleratorComponent* SolenoidComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* SolenoidComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
-	double ks = MADinput->Get_d("KS", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
+	double ks = MADinput->Get_d(col.ks, id);
 
 	return new Solenoid(name, length, brho * ks / length);
 }
 
-AcceleratorComponent* RFCavityComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* RFCavityComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 	// Here we assume an SW cavity
-	double freq = MADinput->Get_d("FREQ", id);
-	double phase = MADinput->Get_d("LAG", id);
-	double volts = MADinput->Get_d("VOLT", id);
+	double freq = MADinput->Get_d(col.freq, id);
+	double phase = MADinput->Get_d(col.lag, id);
+	double volts = MADinput->Get_d(col.volt, id);
 	// standing wave cavities need an exact integer of half-wavelengths
 	freq *= MHz;
 	double lambdaOver2 = SpeedOfLight / freq / 2;
@@ -569,48 +601,49 @@ AcceleratorComponent* RFCavityComponent::GetInstance(unique_ptr<DataTable>& MADi
 
 }
 
-AcceleratorComponent* CrabMarkerComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* CrabMarkerComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	double mux = MADinput->Get_d("MUX", id);
-	double muy = MADinput->Get_d("MUY", id);
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	double mux = MADinput->Get_d(col.mux, id);
+	double muy = MADinput->Get_d(col.muy, id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new CrabMarker(name, length, mux, muy);
 }
 
-AcceleratorComponent* CrabRFComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* CrabRFComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new TransverseRFStructure(name, length, 0, 0);
 }
 
-AcceleratorComponent* CollimatorComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho,
-	size_t id)
+AcceleratorComponent* CollimatorComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new Collimator(name, length);
 }
 
-AcceleratorComponent* HELComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+AcceleratorComponent* HELComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	return new HollowElectronLens(name, length, 0, 0, 0, 0, 0);
 }
 
-AcceleratorComponent* MonitorComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* MonitorComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	if(name.substr(0, 2) == "WS")
 		return new RMSProfileMonitor(name, length);
@@ -618,20 +651,21 @@ AcceleratorComponent* MonitorComponent::GetInstance(unique_ptr<DataTable>& MADin
 		return new BPM(name, length);
 }
 
-AcceleratorComponent* MarkerComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* MarkerComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	const string& name = MADinput->Get_s("NAME", id);
+	const string& name = MADinput->Get_s(col.name, id);
 
 	return new Marker(name);
 }
 
-AcceleratorComponent* LineComponent::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+AcceleratorComponent* LineComponent::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
 	bool MADInterface::* fl = &MADInterface::flatLattice;
 
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	if(!fl)
 	{
@@ -651,13 +685,13 @@ AcceleratorComponent* LineComponent::GetInstance(unique_ptr<DataTable>& MADinput
 	return nullptr;
 }
 
-AcceleratorComponent* SROTComponenet::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t
-	id)
+AcceleratorComponent* SROTComponenet::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
 	MADInterface* mad = new MADInterface();
 	AcceleratorModelConstructor* constr = mad->GetModelConstructor();
-	const string& name = MADinput->Get_s("NAME", id);
-	double length = MADinput->Get_d("L", id);
+	const string& name = MADinput->Get_s(col.name, id);
+	double length = MADinput->Get_d(col.l, id);
 
 	constr->AppendComponentFrame(ConstructSrot(length, name));
 
@@ -665,42 +699,54 @@ AcceleratorComponent* SROTComponenet::GetInstance(unique_ptr<DataTable>& MADinpu
 	return nullptr;
 }
 
-AcceleratorComponent* TypeFactory::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+AcceleratorComponent* TypeFactory::GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id)
 {
-	string type = MADinput->Get_s("KEYWORD", id);
+	string type = MADinput->Get_s(col.keyword, id);
 	map<string, getTypeFunc>::iterator itr = componentTypes.find(type);
 	if(itr != componentTypes.end())
 	{
 		return (*itr->second)(MADinput, energy, brho, id);
 	}
+	map<string, getTypeColumnsFunc>::iterator citr = columnTypes.find(type);
+	if(citr != columnTypes.end())
+	{
+		return (*citr->second)(MADinput, col, energy, brho, id);
+	}
 	return nullptr;
 }
 
+AcceleratorComponent* TypeFactory::GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id)
+{
+	return GetInstance(MADinput, MADTableColumns(*MADinput), energy, brho, id);
+}
+
 TypeFactoryInit::TypeFactoryInit()
 {
-	TypeFactory::componentTypes["DRIFT"] = &DriftComponent::GetInstance;
-	TypeFactory::componentTypes["RBEND"] = &RBendComponent::GetInstance;
-	TypeFactory::componentTypes["SBEND"] = &SBendComponent::GetInstance;
-	TypeFactory::componentTypes["QUADRUPOLE"] = &QuadrupoleComponent::GetInstance;
-	TypeFactory::componentTypes["SKEWQUAD"] = &SkewQuadrupoleComponent::GetInstance;
-	TypeFactory::componentTypes["SEXTUPOLE"] = &SextupoleComponent::GetInstance;
-	TypeFactory::componentTypes["SKEWSEXT"] = &SkewSextupoleComponent::GetInstance;
-	TypeFactory::componentTypes["OCTUPOLE"] = &OctupoleComponent::GetInstance;
-	TypeFactory::componentTypes["YCOR"] = &YCorComponent::GetInstance;
-	TypeFactory::componentTypes["XCOR"] = &XCorComponent::GetInstance;
-	TypeFactory::componentTypes["VKICKER"] = &VKickerComponent::GetInstance;
-	TypeFactory::componentTypes["HKICKER"] = &HKickerComponent::GetInstance;
-	TypeFactory::componentTypes["SOLENOID"] = &SolenoidComponent::GetInstance;
-	TypeFactory::componentTypes["RFCAVITY"] = &RFCavityComponent::GetInstance;
-	TypeFactory::componentTypes["CRABMARKER"] = &CrabMarkerComponent::GetInstance;
-	TypeFactory::componentTypes["CRABRF"] = &CrabRFComponent::GetInstance;
-	TypeFactory::componentTypes["COLLIMATOR"] = &CollimatorComponent::GetInstance;
-	TypeFactory::componentTypes["HEL"] = &HELComponent::GetInstance;
-	TypeFactory::componentTypes["MONITOR"] = &MonitorComponent::GetInstance;
-	TypeFactory::componentTypes["MARKER"] = &MarkerComponent::GetInstance;
-	TypeFactory::componentTypes["LINE"] = &LineComponent::GetInstance;
-	TypeFactory::componentTypes["SROT"] = &SROTComponenet::GetInstance;
+	TypeFactory::columnTypes["DRIFT"] = &DriftComponent::GetInstance;
+	TypeFactory::columnTypes["RBEND"] = &RBendComponent::GetInstance;
+	TypeFactory::columnTypes["SBEND"] = &SBendComponent::GetInstance;
+	TypeFactory::columnTypes["QUADRUPOLE"] = &QuadrupoleComponent::GetInstance;
+	TypeFactory::columnTypes["SKEWQUAD"] = &SkewQuadrupoleComponent::GetInstance;
+	TypeFactory::columnTypes["SEXTUPOLE"] = &SextupoleComponent::GetInstance;
+	TypeFactory::columnTypes["SKEWSEXT"] = &SkewSextupoleComponent::GetInstance;
+	TypeFactory::columnTypes["OCTUPOLE"] = &OctupoleComponent::GetInstance;
+	TypeFactory::columnTypes["YCOR"] = &YCorComponent::GetInstance;
+	TypeFactory::columnTypes["XCOR"] = &XCorComponent::GetInstance;
+	TypeFactory::columnTypes["VKICKER"] = &VKickerComponent::GetInstance;
+	TypeFactory::columnTypes["HKICKER"] = &HKickerComponent::GetInstance;
+	TypeFactory::columnTypes["SOLENOID"] = &SolenoidComponent::GetInstance;
+	TypeFactory::columnTypes["RFCAVITY"] = &RFCavityComponent::GetInstance;
+	TypeFactory::columnTypes["CRABMARKER"] = &CrabMarkerComponent::GetInstance;
+	TypeFactory::columnTypes["CRABRF"] = &CrabRFComponent::GetInstance;
+	TypeFactory::columnTypes["COLLIMATOR"] = &CollimatorComponent::GetInstance;
+	TypeFactory::columnTypes["HEL"] = &HELComponent::GetInstance;
+	TypeFactory::columnTypes["MONITOR"] = &MonitorComponent::GetInstance;
+	TypeFactory::columnTypes["MARKER"] = &MarkerComponent::GetInstance;
+	TypeFactory::columnTypes["LINE"] = &LineComponent::GetInstance;
+	TypeFactory::columnTypes["SROT"] = &SROTComponenet::GetInstance;
 }
 
 map<string, getTypeFunc> TypeFactory::componentTypes;
+map<string, getTypeColumnsFunc> TypeFactory::columnTypes;
 TypeFactoryInit TypeFactoryInit::init;
@@ -22,6 +22,24 @@ class AcceleratorModelConstructor;
 using std::ifstream;
 using std::ostream;
 
+/**
+ *      Handles of the MAD table columns used when building
+ *      components, resolved once per table rather than by name
+ *      for every element. Columns not in the table have invalid
+ *      handles, and throw if they are read.
+ */
+struct MADTableColumns
+{
+	explicit MADTableColumns(const DataTable& table);
+
+	DataTable::ColumnHandle name, keyword, l, angle;
+	DataTable::ColumnHandle k0l, k1l, k2l, k3l, k4l;
+	DataTable::ColumnHandle tilt, e1, e2;
+	DataTable::ColumnHandle hkick, vkick, ks;
+	DataTable::ColumnHandle freq, lag, volt;
+	DataTable::ColumnHandle mux, muy;
+};
+
 /**
  *      Class used to construct a MERLIN model from a MAD optics
  *      output listing. The class now automatically  identifies
@@ -73,11 +91,13 @@ public:
 	 * Function to return corresponding multipole string *
 	 */
 	string GetMutipoleType(unique_ptr<DataTable>& MADinput, size_t id);
+	string GetMutipoleType(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, size_t id);
 
 	/**
 	 * Function to define all type overrides
 	 */
 	void TypeOverrides(unique_ptr<DataTable>& MADinput, size_t index);
+	void TypeOverrides(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, size_t index);
 
 	/**
 	 *   If true, all RFCavities will be forced to a length of
@@ -196,14 +216,33 @@ inline void MADInterface::ScaleForSynchRad(bool scaleSR)
 	inc_sr = scaleSR;
 }
 
+/**
+ * Builders registered in TypeFactory::componentTypes look up their own columns by name
+ */
 typedef AcceleratorComponent* (*getTypeFunc)(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
 
+/**
+ * Builders registered in TypeFactory::columnTypes are passed the column handles found once per table
+ */
+typedef AcceleratorComponent* (*getTypeColumnsFunc)(unique_ptr<DataTable>& MADinput, const MADTableColumns& col,
+	double energy, double brho, size_t id);
+
 class TypeFactory
 {
 public:
+	/**
+	 * Builders for each MAD keyword. Entries here take precedence over the built in column builders.
+	 */
 	static map<string, getTypeFunc> componentTypes;
-	AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static map<string, getTypeColumnsFunc> columnTypes;
 
+	AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
+
+	/**
+	 * Finds the column handles of the table for each call
+	 */
+	AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
 };
 
 class TypeFactoryInit
@@ -216,133 +255,155 @@ public:
 class DriftComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class RBendComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SBendComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class QuadrupoleComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SkewQuadrupoleComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SextupoleComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SkewSextupoleComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class OctupoleComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class YCorComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class XCorComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class VKickerComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class HKickerComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SolenoidComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class RFCavityComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class CollimatorComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class CrabMarkerComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class CrabRFComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class HELComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class MonitorComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class MarkerComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class LineComponent: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 class SROTComponenet: public AcceleratorComponent
 {
 public:
-	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, double energy, double brho, size_t id);
+	static AcceleratorComponent* GetInstance(unique_ptr<DataTable>& MADinput, const MADTableColumns& col, double energy,
+		double brho, size_t id);
 };
 
 #endif
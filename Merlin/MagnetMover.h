@@ -124,21 +124,25 @@ inline double MagnetMover::GetRoll() const
 inline void MagnetMover::SetX(double x)
 {
 	t.setTranslationX(x);
+	SetModified();
 }
 
 inline void MagnetMover::SetY(double y)
 {
 	t.setTranslationY(y);
+	SetModified();
 }
 
 inline void MagnetMover::SetRoll(double roll)
 {
 	t.setRotation(roll);
+	SetModified();
 }
 
 inline void MagnetMover::Reset()
 {
 	t = Transform2D();
+	SetModified();
 }
 
 #endif
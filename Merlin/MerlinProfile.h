@@ -8,6 +8,13 @@
 #ifndef _MerlinProfile_hpp_
 #define _MerlinProfile_hpp_ 1
 
+/*
+ * Note: MerlinProfile looks up string IDs on every call and so adds
+ * significant overhead to what it measures. ScopeProfiler gives a per
+ * process, per element type and per element breakdown at much lower cost,
+ * and can be switched on at run time.
+ */
+
 // Macros that do nothing if profiling not enabled
 #ifdef MERLIN_PROFILE
 #define MERLIN_PROFILE_ADD_PROCESS(s) MerlinProfile::AddProcess(s)
@@ -0,0 +1,24 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <atomic>
+#include "ModelElement.h"
+
+namespace
+{
+std::atomic<unsigned long> lastSerial(0);
+}
+
+void ModelElement::SetModified() const
+{
+	modSerial = ++lastSerial;
+}
+
+unsigned long ModelElement::GetLastModificationSerial()
+{
+	return lastSerial;
+}
@@ -73,6 +73,28 @@ public:
 
 	virtual void AppendBeamlineIndexes(std::vector<size_t>& ivec) const = 0;
 
+	/**
+	 * Marks the element as changed. Component parameter setters,
+	 * frame transformations and channel writes call this; code
+	 * which changes a field directly should call it too, so that
+	 * cached results (see LatticeFunctionTable::Update()) are
+	 * recalculated.
+	 */
+	void SetModified() const;
+
+	/**
+	 * Returns the serial number of the last change to the element,
+	 * or zero if it has not been changed since construction.
+	 * Serial numbers increase with each change to any element.
+	 */
+	unsigned long GetModificationSerial() const;
+
+	/**
+	 * Returns the serial number of the most recent change to any
+	 * element.
+	 */
+	static unsigned long GetLastModificationSerial();
+
 protected:
 
 	/**
@@ -86,10 +108,12 @@ protected:
 	 */
 	std::string id;
 
+private:
+	mutable unsigned long modSerial;
 }; // Class ModelElement
 
 inline ModelElement::ModelElement(const std::string& aName) :
-	id(aName)
+	id(aName), modSerial(0)
 {
 }
 
@@ -125,6 +149,11 @@ inline size_t ModelElement::GetBeamlineIndexes(std::vector<size_t>& ivec) const
 	return ivec.size();
 }
 
+inline unsigned long ModelElement::GetModificationSerial() const
+{
+	return modSerial;
+}
+
 // utility macros:
 // GetType() implementation
 #define _TYPESTR(s) static const std::string typestr(#s); return typestr;
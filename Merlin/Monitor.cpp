@@ -25,6 +25,11 @@ void Monitor::MakeMeasurement(const Bunch&)
 {
 }
 
+bool Monitor::IsRecording() const
+{
+	return false;
+}
+
 void Monitor::SetMeasurementPt(double mpt)
 {
 	//GetGeometry().CheckBounds(mpt); // might throw
@@ -46,6 +46,13 @@ public:
 	 */
 	virtual void MakeMeasurement(const Bunch&);
 
+	/**
+	 *	Returns true if MakeMeasurement() would record data,
+	 *	that is the monitor is active and has somewhere to put
+	 *	it. The base class records nothing.
+	 */
+	virtual bool IsRecording() const;
+
 	/**
 	 *	Sets the position of the measurement point on the local
 	 *	geometry. Must be in the range -length/2 to +length/2.
@@ -8,6 +8,7 @@
 #include "MonitorProcess.h"
 #include "AcceleratorComponent.h"
 #include <fstream>
+#include "MerlinException.h"
 #include "ParticleBunchProcess.h"
 
 using namespace ParticleTracking;
@@ -30,6 +31,38 @@ void MonitorProcess::AddElement(const string e)
 	dump_at_elements.push_back(e);
 }
 
+void MonitorProcess::SetAsync(size_t nbuffers)
+{
+	writer.reset();
+	if(nbuffers)
+	{
+		writer.reset(new AsyncOutput(nbuffers));
+	}
+}
+
+void MonitorProcess::Flush()
+{
+	if(writer)
+	{
+		writer->Flush();
+	}
+}
+
+namespace
+{
+
+void WriteMonitorFile(const AsyncOutput::Buffer& b)
+{
+	ofstream out_file(b.name);
+	if(!out_file.good())
+	{
+		throw MerlinException("MonitorProcess: error opening " + b.name);
+	}
+	ParticleBunch::OutputParticles(out_file, b.particles, b.time, b.momentum);
+}
+
+} // end anonymous namespace
+
 void MonitorProcess::InitialiseProcess(Bunch& bunch)
 {
 	ParticleBunchProcess::InitialiseProcess(bunch);
@@ -50,14 +83,27 @@ void MonitorProcess::DoProcess(const double ds)
 #endif
 	{
 		cout << "MonitorProcess writing" << filename << endl;
-		ofstream out_file(filename);
-		if(!out_file.good())
+		if(writer)
+		{
+			AsyncOutput::Buffer& b = writer->Acquire();
+			b.name = filename;
+			b.particles.assign(currentBunch->begin(), currentBunch->end());
+			b.time = currentBunch->GetReferenceTime();
+			b.momentum = currentBunch->GetReferenceMomentum();
+			b.write = WriteMonitorFile;
+			writer->Submit(b);
+		}
+		else
 		{
-			cerr << "Error opening " << filename << endl;
-			exit(EXIT_FAILURE);
+			ofstream out_file(filename);
+			if(!out_file.good())
+			{
+				cerr << "Error opening " << filename << endl;
+				exit(EXIT_FAILURE);
+			}
+			currentBunch->Output(out_file);
+			out_file.close();
 		}
-		currentBunch->Output(out_file);
-		out_file.close();
 	}
 #ifdef ENABLE_MPI
 	currentBunch->distribute();
@@ -9,8 +9,10 @@
 #define MonitorProcess_h 1
 
 #include "ParticleBunchProcess.h"
+#include <memory>
 #include <vector>
 #include <string>
+#include "AsyncOutput.h"
 #include "ParticleBunch.h"
 
 namespace ParticleTracking
@@ -20,6 +22,11 @@ namespace ParticleTracking
  *
  * Can be attached to the tracker to record particle coordinates at all
  * or specific elements to files.
+ *
+ * With SetAsync() the coordinates are copied and the files are written
+ * by a background thread while tracking continues. They are written in
+ * the format of ParticleBunch::Output(), so bunch types with their own
+ * output, such as SpinParticleBunch, should be written synchronously.
  */
 class MonitorProcess: public ParticleBunchProcess
 {
@@ -27,6 +34,7 @@ private:
 	vector<string> dump_at_elements;
 	string file_prefix;
 	unsigned int count;
+	std::unique_ptr<AsyncOutput> writer;
 
 public:
 	/**
@@ -44,6 +52,19 @@ public:
 
 	/// Add element at which to record
 	void AddElement(const string e);
+
+	/**
+	 * Write the files in the background, with up to nbuffers snapshots
+	 * waiting to be written. Zero writes them synchronously (the default).
+	 */
+	void SetAsync(size_t nbuffers);
+
+	/**
+	 * Wait until every file has been written. A file written in the
+	 * background that could not be opened is reported here, or by the
+	 * next snapshot, as a MerlinException.
+	 */
+	void Flush();
 	void InitialiseProcess(Bunch&  bunch);
 	void DoProcess(const double ds);
 	double GetMaxAllowedStepSize() const;
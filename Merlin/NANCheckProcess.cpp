@@ -9,6 +9,9 @@
 #include "AcceleratorComponent.h"
 #include "ParticleBunchProcess.h"
 #include "ParticleBunch.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <string>
 
 using namespace ParticleTracking;
@@ -30,18 +33,37 @@ static bool is_good(const PSvector &p)
 		   std::isfinite(p.yp()) && std::isfinite(p.dp());
 }
 
+bool NANCheckProcess::AllFinite(const PSvectorArray& particles)
+{
+	// NaN fails every comparison, so !(|x| <= max) is set for NaN and infinity alone. The flags are combined with
+	// an integer or, which the compiler can vectorise without reordering any floating point sums.
+	const double big = std::numeric_limits<double>::max();
+	const size_t n = particles.size();
+	int bad = 0;
+#ifdef ENABLE_OPENMP
+	#pragma omp simd reduction(|:bad)
+#endif
+	for(size_t i = 0; i < n; i++)
+	{
+		const PSvector& p = particles[i];
+		bad |= !(std::fabs(p[0]) <= big) | !(std::fabs(p[1]) <= big) | !(std::fabs(p[2]) <= big)
+			| !(std::fabs(p[3]) <= big) | !(std::fabs(p[4]) <= big) | !(std::fabs(p[5]) <= big);
+	}
+	return bad == 0;
+}
+
 void NANCheckProcess::DoProcess(const double ds)
 {
-	ParticleBunch::iterator p;
+	if(AllFinite(currentBunch->GetParticles()))
+	{
+		return;
+	}
+
 	size_t count = 0;
 	bool do_cull = 0;
 	for(auto &p : *currentBunch)
 	{
-		if(reported.count(p.id()))
-		{
-			continue;
-		}
-		if(!is_good(p))
+		if(!is_good(p) && !reported.count(p.id()))
 		{
 			std::cout << "NAN entry found in currentBunch[" << count << "], p.id = " << p.id() << ", at "
 					  << currentComponent->GetQualifiedName() << std::endl;
@@ -93,19 +115,15 @@ void NANCheckProcess::Report(int id) const
 
 void NANCheckProcess::DoCull()
 {
-	ParticleBunch* NewBunch = new ParticleBunch(currentBunch->GetReferenceMomentum(), currentBunch->GetTotalCharge()
-		/ currentBunch->size());
-	NewBunch->reserve(currentBunch->size());
-	for(auto &p : *currentBunch)
+	// removed in place, and through the bunch so that any data it holds for each particle follows;
+	// the charge per macro particle is unchanged
+	const PSvectorArray& particles = currentBunch->GetParticles();
+	std::vector<char> lost(particles.size());
+	for(size_t n = 0; n < particles.size(); n++)
 	{
-		if(is_good(p))
-		{
-			NewBunch->AddParticle(p);
-		}
+		lost[n] = !is_good(particles[n]);
 	}
-	currentBunch->clear();
-	currentBunch->swap(*NewBunch);
-	delete NewBunch;
+	currentBunch->RemoveParticles(lost);
 }
 
 double NANCheckProcess::GetMaxAllowedStepSize() const
@@ -118,9 +136,8 @@ void NANCheckProcess::SetCurrentComponent(AcceleratorComponent& component)
 	currentComponent = &component;
 	if(detailed)
 	{
-		prev_coords.clear();
-		prev_coords = start_coords;
-		start_coords.clear();
+		// the old start becomes the previous element without a copy
+		prev_coords.swap(start_coords);
 		start_coords = currentBunch->GetParticles();
 	}
 }
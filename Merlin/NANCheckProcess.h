@@ -32,6 +32,11 @@ namespace ParticleTracking
  *
  * halt: stops the simulation when an invalid particle is found.
  *
+ * The bunch is first checked by AllFinite(), which has no branches in its
+ * loop and vectorises, so that a clean bunch costs one pass over the
+ * coordinates. The particles are only examined one at a time, and
+ * reported, when it finds an invalid value.
+ *
  */
 class NANCheckProcess: public ParticleBunchProcess
 {
@@ -58,6 +63,12 @@ public:
 	{
 		halt = enable;
 	}
+
+	/**
+	 * Returns true if all six coordinates of every particle are
+	 * finite. Can be called from other loops over the bunch.
+	 */
+	static bool AllFinite(const PSvectorArray& particles);
 private:
 	bool detailed;
 	bool cull;
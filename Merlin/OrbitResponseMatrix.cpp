@@ -0,0 +1,382 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+
+#include "ClosedOrbit.h"
+#include "LinearMapTracker.h"
+#include "MerlinException.h"
+#include "OrbitResponseMatrix.h"
+#include "ParticleBunch.h"
+#include "ParticleTracker.h"
+
+using namespace std;
+using namespace ParticleTracking;
+
+namespace
+{
+
+// transverse (4x4) block of a map
+RealMatrix Transverse(const RealMatrix& M)
+{
+	RealMatrix T(4, 4);
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			T(i, j) = M(i, j);
+		}
+	}
+	return T;
+}
+
+RealVector Transverse(const PSvector& x)
+{
+	RealVector v(4);
+	for(int i = 0; i < 4; i++)
+	{
+		v(i) = x[i];
+	}
+	return v;
+}
+
+Particle* FindParticle(ParticleBunch& bunch, int id)
+{
+	for(Particle& p : bunch.GetParticles())
+	{
+		if(p.id() == id)
+		{
+			return &p;
+		}
+	}
+	throw MerlinException("OrbitResponseMatrix: particle lost while tracking");
+}
+
+} // end of anonymous namespace
+
+OrbitResponseMatrix::OrbitResponseMatrix(AcceleratorModel* aModel, double refMomentum) :
+	theModel(aModel), p0(refMomentum), ring(true), orbit0(0), delta(1.0e-6), tol(1.0e-12)
+{
+}
+
+void OrbitResponseMatrix::SetRing(bool flag)
+{
+	ring = flag;
+}
+
+void OrbitResponseMatrix::SetInitialOrbit(const PSvector& p)
+{
+	orbit0 = p;
+}
+
+void OrbitResponseMatrix::SetDelta(double new_delta)
+{
+	delta = new_delta;
+}
+
+void OrbitResponseMatrix::SetTolerance(double tolerance)
+{
+	tol = tolerance;
+}
+
+void OrbitResponseMatrix::AddCorrector(RectMultipole* cor)
+{
+	correctors.push_back(cor);
+}
+
+void OrbitResponseMatrix::AddBPM(BPM* bpm, bool horizontal)
+{
+	bpms.push_back(bpm);
+	planes.push_back(horizontal ? 0 : 2);
+}
+
+void OrbitResponseMatrix::AddBPMs(const vector<BPM*>& bpmVec, bool horizontal)
+{
+	for(BPM* bpm : bpmVec)
+	{
+		AddBPM(bpm, horizontal);
+	}
+}
+
+void OrbitResponseMatrix::FindIndexes()
+{
+	// first occurrence of each component in the beamline
+	map<const AcceleratorComponent*, size_t> index;
+	AcceleratorModel::Beamline bline = theModel->GetBeamline();
+	size_t n = 0;
+	for(AcceleratorModel::BeamlineIterator fi = bline.begin(); fi != bline.end(); fi++, n++)
+	{
+		if((*fi)->IsComponent())
+		{
+			index.insert(make_pair(&(*fi)->GetComponent(), n));
+		}
+	}
+
+	corIndex.clear();
+	for(RectMultipole* cor : correctors)
+	{
+		auto i = index.find(cor);
+		if(i == index.end())
+		{
+			throw MerlinException("OrbitResponseMatrix: corrector " + cor->GetQualifiedName() + " not in beamline");
+		}
+		corIndex.push_back(i->second);
+	}
+
+	bpmIndex.clear();
+	for(BPM* bpm : bpms)
+	{
+		auto i = index.find(bpm);
+		if(i == index.end())
+		{
+			throw MerlinException("OrbitResponseMatrix: BPM " + bpm->GetQualifiedName() + " not in beamline");
+		}
+		bpmIndex.push_back(i->second);
+	}
+}
+
+void OrbitResponseMatrix::FindOrbitAndMaps()
+{
+	PSvector x = orbit0;
+	if(ring)
+	{
+		ClosedOrbit co(theModel, p0);
+		co.TransverseOnly(true);
+		co.FindClosedOrbit(x);
+	}
+
+	orbits.assign(1, x);
+	momenta.assign(1, p0);
+	maps.assign(1, IdentityMatrix(4));
+
+	LinearMapTracker lmt(p0);
+	lmt.SetObserver([&](ComponentFrame*, const PSvector& out, const RealMatrix& J) {
+		orbits.push_back(out);
+		momenta.push_back(lmt.GetFinalMomentum());
+		maps.push_back(Transverse(J) * maps.back());
+	});
+
+	RealMatrix M(6, 6);
+	lmt.Track(theModel->GetBeamline(), x, M);
+}
+
+void OrbitResponseMatrix::FindKicks()
+{
+	kicks.clear();
+	for(size_t i = 0; i < correctors.size(); i++)
+	{
+		const size_t f = corIndex[i];
+		const double b = correctors[i]->GetFieldStrength();
+		LinearMapTracker lmt(momenta[f]);
+		RealMatrix J(6, 6);
+
+		PSvector x1 = orbits[f];
+		correctors[i]->SetFieldStrength(b + delta);
+		lmt.Track(theModel->GetBeamline(f, f), x1, J);
+
+		PSvector x0 = orbits[f];
+		correctors[i]->SetFieldStrength(b);
+		lmt.Track(theModel->GetBeamline(f, f), x0, J);
+
+		PSvector k(0);
+		for(int j = 0; j < 6; j++)
+		{
+			k[j] = (x1[j] - x0[j]) / delta;
+		}
+		kicks.push_back(k);
+	}
+}
+
+const RealMatrix& OrbitResponseMatrix::Calculate()
+{
+	FindIndexes();
+	FindOrbitAndMaps();
+	FindKicks();
+
+	const size_t N = maps.size() - 1;
+	const RealMatrix& CN = maps[N];
+
+	// (I - C_N)^-1 C_N gives the closed orbit at the start for a kick referred back to the start
+	RealMatrix A(4, 4);
+	if(ring)
+	{
+		A = IdentityMatrix(4);
+		A -= CN;
+		Invert(A);
+		A = A * CN;
+	}
+
+	R.redim(bpms.size(), correctors.size());
+	for(size_t i = 0; i < correctors.size(); i++)
+	{
+		const size_t f = corIndex[i] + 1;
+
+		// kick referred back to the start, v = C_f^-1 k
+		RealMatrix Cinv = maps[f];
+		Invert(Cinv);
+		const RealVector v = Cinv * Transverse(kicks[i]);
+		RealVector u(0.0, 4);
+		if(ring)
+		{
+			u = A * v;
+		}
+
+		for(size_t n = 0; n < bpms.size(); n++)
+		{
+			const size_t j = bpmIndex[n];
+			const int r = planes[n];
+			double z = 0;
+			for(int k = 0; k < 4; k++)
+			{
+				z += maps[j](r, k) * (j >= f ? u(k) + v(k) : u(k));
+			}
+			R(n, i) = z;
+		}
+	}
+	return R;
+}
+
+const RealMatrix& OrbitResponseMatrix::CalculateByTracking()
+{
+	FindIndexes();
+	FindOrbitAndMaps();
+
+	const size_t N = maps.size() - 1;
+	const size_t nc = correctors.size();
+
+	// the beamline is tracked in segments which end at each BPM and start and end at each corrector
+	vector<size_t> cuts = {0, N};
+	cuts.insert(cuts.end(), bpmIndex.begin(), bpmIndex.end());
+	for(size_t f : corIndex)
+	{
+		cuts.push_back(f);
+		cuts.push_back(f + 1);
+	}
+	sort(cuts.begin(), cuts.end());
+	cuts.erase(unique(cuts.begin(), cuts.end()), cuts.end());
+
+	// the reference particle has id 0 and the particle kicked by corrector i has id i + 1
+	ParticleBunch bunch(p0, 1.0);
+	vector<unique_ptr<ParticleTracker>> trackers;
+	for(size_t s = 0; s + 1 < cuts.size(); s++)
+	{
+		trackers.emplace_back(new ParticleTracker(theModel->GetBeamline(cuts[s], cuts[s + 1] - 1), &bunch, false));
+	}
+
+	// corrector at the start of each segment, or -1
+	vector<int> segCorrector(trackers.size(), -1);
+	for(size_t i = 0; i < nc; i++)
+	{
+		segCorrector[lower_bound(cuts.begin(), cuts.end(), corIndex[i]) - cuts.begin()] = i;
+	}
+
+	// chord iteration for the closed orbits with the unperturbed one turn map
+	RealMatrix G(4, 4);
+	if(ring)
+	{
+		G = maps[N];
+		G -= IdentityMatrix(4);
+		Invert(G);
+	}
+
+	vector<PSvector> start(nc + 1, orbits[0]);
+	RealMatrix readings(bpms.size(), nc + 1);
+	const int maxIterations = ring ? 50 : 1;
+	int iteration = 0;
+	for(; iteration < maxIterations; iteration++)
+	{
+		bunch.clear();
+		for(size_t k = 0; k <= nc; k++)
+		{
+			Particle p = start[k];
+			p.id() = k;
+			bunch.push_back(p);
+		}
+
+		for(size_t s = 0; s < trackers.size(); s++)
+		{
+			for(size_t n = 0; n < bpms.size(); n++)
+			{
+				if(bpmIndex[n] == cuts[s])
+				{
+					for(size_t k = 0; k <= nc; k++)
+					{
+						readings(n, k) = (*FindParticle(bunch, k))[planes[n]];
+					}
+				}
+			}
+
+			const int i = segCorrector[s];
+			if(i < 0)
+			{
+				trackers[s]->Track(&bunch);
+				continue;
+			}
+
+			// the kicked particle is tracked alone through its corrector with the changed field
+			Particle* pk = FindParticle(bunch, i + 1);
+			ParticleBunch single(bunch.GetReferenceMomentum(), 1.0);
+			single.push_back(*pk);
+			bunch.GetParticles().erase(bunch.GetParticles().begin() + (pk - &bunch.GetParticles()[0]));
+
+			trackers[s]->Track(&bunch);
+
+			const double b = correctors[i]->GetFieldStrength();
+			correctors[i]->SetFieldStrength(b + delta);
+			trackers[s]->Track(&single);
+			correctors[i]->SetFieldStrength(b);
+			bunch.push_back(single.FirstParticle());
+		}
+
+		if(!ring)
+		{
+			break;
+		}
+
+		double residual = 0;
+		double size = 0;
+		for(size_t k = 0; k <= nc; k++)
+		{
+			const Particle& p = *FindParticle(bunch, k);
+			RealVector dx(4);
+			for(int j = 0; j < 4; j++)
+			{
+				dx(j) = p[j] - start[k][j];
+				residual = max(residual, fabs(dx(j)));
+				size = max(size, fabs(p[j]));
+			}
+			const RealVector step = G * dx;
+			for(int j = 0; j < 4; j++)
+			{
+				start[k][j] -= step(j);
+			}
+		}
+		// converged once the change of the orbits in one turn is small relative to the largest orbit
+		if(residual <= tol * size)
+		{
+			break;
+		}
+	}
+
+	if(iteration == maxIterations)
+	{
+		throw MerlinException("OrbitResponseMatrix: closed orbit did not converge");
+	}
+
+	R.redim(bpms.size(), nc);
+	for(size_t n = 0; n < bpms.size(); n++)
+	{
+		for(size_t i = 0; i < nc; i++)
+		{
+			R(n, i) = (readings(n, i + 1) - readings(n, 0)) / delta;
+		}
+	}
+	return R;
+}
@@ -0,0 +1,110 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef OrbitResponseMatrix_h
+#define OrbitResponseMatrix_h 1
+
+#include "merlin_config.h"
+#include <vector>
+#include "AcceleratorModel.h"
+#include "BPM.h"
+#include "PSTypes.h"
+#include "RectMultipole.h"
+#include "TLAS.h"
+
+using namespace TLAS;
+
+/**
+ *	Response of the orbit at a set of BPMs to a set of dipole
+ *	correctors.
+ *
+ *	Column i of the matrix is the change of the orbit at each BPM
+ *	row per unit change of the field strength of corrector i (the
+ *	value of its B channel), and row n is the horizontal or
+ *	vertical orbit at the entrance of BPM n. The rows and columns
+ *	are in the order the BPMs and correctors were added, so that
+ *	with the matching channels the matrix can be passed to
+ *	LinearFBSystem::SetResponseMatrix().
+ *
+ *	For a ring the response is that of the closed orbit, with the
+ *	energy fixed. Otherwise the beamline is a transfer line, and
+ *	the response is that of the trajectory from the initial orbit.
+ *
+ *	Calculate() finds the whole matrix from the cumulative linear
+ *	maps of one pass of LinearMapTracker, and the kick of each
+ *	corrector. CalculateByTracking() tracks one particle for each
+ *	corrector, kicked at the exit of that corrector, together in
+ *	one bunch through the full (non-linear) lattice, to check the
+ *	linear result.
+ */
+class OrbitResponseMatrix
+{
+public:
+	OrbitResponseMatrix(AcceleratorModel* aModel, double refMomentum);
+
+	void SetRing(bool flag);                        // default: true
+	void SetInitialOrbit(const PSvector& p);        // transfer line only, default: zero
+	void SetDelta(double new_delta);                // field step for the kicks, default: 1.0e-6
+	void SetTolerance(double tolerance);            // closed orbit tolerance relative to the orbit, default: 1.0e-12
+
+	void AddCorrector(RectMultipole* cor);
+	void AddBPM(BPM* bpm, bool horizontal);
+
+	template<class C>
+	void AddCorrectors(const std::vector<C*>& cors)
+	{
+		for(C* c : cors)
+		{
+			AddCorrector(c);
+		}
+	}
+
+	void AddBPMs(const std::vector<BPM*>& bpms, bool horizontal);
+
+	/// Finds the response from the linear maps about the orbit
+	const RealMatrix& Calculate();
+
+	/// Finds the response by tracking
+	const RealMatrix& CalculateByTracking();
+
+	const RealMatrix& GetMatrix() const
+	{
+		return R;
+	}
+
+private:
+	AcceleratorModel* theModel;
+	double p0;
+	bool ring;
+	PSvector orbit0;
+	double delta;
+	double tol;
+
+	std::vector<RectMultipole*> correctors;
+	std::vector<BPM*> bpms;
+	std::vector<int> planes;
+
+	RealMatrix R;
+
+	// lattice index of each corrector and BPM
+	std::vector<size_t> corIndex;
+	std::vector<size_t> bpmIndex;
+
+	// orbit, reference momentum and transverse map from the start at the entrance of each element
+	std::vector<PSvector> orbits;
+	std::vector<double> momenta;
+	std::vector<RealMatrix> maps;
+
+	// orbit change at the exit of each corrector per unit field
+	std::vector<PSvector> kicks;
+
+	void FindIndexes();
+	void FindOrbitAndMaps();
+	void FindKicks();
+};
+
+#endif
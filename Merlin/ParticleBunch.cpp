@@ -333,12 +333,31 @@ void ParticleBunch::SortByCT()
 	SortArray(pArray);
 }
 
+void ParticleBunch::RemoveParticles(const std::vector<char>& lost)
+{
+	size_t m = 0;
+	for(size_t n = 0; n < pArray.size(); n++)
+	{
+		if(!lost[n])
+		{
+			pArray[m++] = pArray[n];
+		}
+	}
+	pArray.resize(m);
+}
+
 void ParticleBunch::Output(std::ostream& os) const
 {
 	Output(os, true);
 }
 
 void ParticleBunch::Output(std::ostream& os, bool show_header) const
+{
+	OutputParticles(os, pArray, GetReferenceTime(), GetReferenceMomentum(), show_header);
+}
+
+void ParticleBunch::OutputParticles(std::ostream& os, const PSvectorArray& particles, double reftime, double
+	refmomentum, bool show_header)
 {
 	int oldp = os.precision(16);
 	ios_base::fmtflags oflg = os.setf(ios::scientific, ios::floatfield);
@@ -346,10 +365,10 @@ void ParticleBunch::Output(std::ostream& os, bool show_header) const
 	{
 		os << "#T P0 X XP Y YP CT DP" << std::endl;
 	}
-	for(PSvectorArray::const_iterator p = begin(); p != end(); p++)
+	for(PSvectorArray::const_iterator p = particles.begin(); p != particles.end(); p++)
 	{
-		os << std::setw(35) << GetReferenceTime();
-		os << std::setw(35) << GetReferenceMomentum();
+		os << std::setw(35) << reftime;
+		os << std::setw(35) << refmomentum;
 		for(size_t k = 0; k < 6; k++)
 		{
 			os << std::setw(35) << (*p)[k];
@@ -70,6 +70,9 @@ public:
 	 * Constructs an ParticleBunch with coordinates generated from a
 	 * random distribution matched to a beam. Particles can be filtered
 	 * using an optional ParticleBunchFilter.
+	 *
+	 * For large or heavily filtered bunches see GenerateBunchParticles() in
+	 * ParticleBunchUtilities.h, which generates in parallel blocks.
 	 */
 
 	ParticleBunch(size_t np, const ParticleDistributionGenerator & generator, const BeamData& beam,
@@ -141,6 +144,13 @@ public:
 	virtual void OutputIndexParticle(std::ostream& os, int index) const;
 	virtual void Input(double Q, std::istream& is);
 
+	/**
+	 *	Output particles in the format of ParticleBunch::Output(),
+	 *	for example from a snapshot of the bunch.
+	 */
+	static void OutputParticles(std::ostream& os, const PSvectorArray& particles, double reftime, double refmomentum,
+		bool show_header = true);
+
 	/**
 	 *	Add a (macro-)particle to the bunch.
 	 */
@@ -160,6 +170,20 @@ public:
 	virtual ParticleBunch::iterator erase(ParticleBunch::iterator p);
 	void reserve(const size_t n);
 
+	/**
+	 *	Removes in one pass the particles n for which lost[n] is
+	 *	non-zero, keeping the order of the others. Bunches which
+	 *	hold more data for each particle override this to keep it
+	 *	in step.
+	 */
+	virtual void RemoveParticles(const std::vector<char>& lost);
+
+	/**
+	 *	Direct access to the particle array. Bunches which hold
+	 *	more data for each particle (SpinParticleBunch) cannot see
+	 *	changes made through it, so add and remove particles with
+	 *	AddParticle(), erase() or RemoveParticles() on the bunch.
+	 */
 	PSvectorArray& GetParticles();
 	const PSvectorArray& GetParticles() const;
 
@@ -185,12 +209,14 @@ public:
 	/**
 	 * Removes all particles from the bunch
 	 */
-	void clear();
+	virtual void clear();
 
 	/**
-	 * Swaps particles with another ParticleBunch
+	 * Swaps particles with another ParticleBunch. Bunches which
+	 * hold more data for each particle override this to keep it
+	 * in step.
 	 */
-	void swap(ParticleBunch newbunch);
+	virtual void swap(ParticleBunch& newbunch);
 
 	/**
 	 * Init flag
@@ -248,6 +274,11 @@ public:
 	 */
 	virtual double GetParticleLifetime() const;
 
+	virtual size_t GetParticleCount() const
+	{
+		return size();
+	}
+
 #ifdef ENABLE_MPI
 	/**
 	 * Destructor - cleans up MPI code
@@ -345,11 +376,9 @@ protected:
 	PSvectorArray pArray;
 
 };
-inline void ParticleBunch::swap(ParticleBunch newbunch)
+inline void ParticleBunch::swap(ParticleBunch& newbunch)
 {
-	//cout << "Before " << size() << "\t" << newbunch.size() << endl;
 	pArray.swap(newbunch.pArray);
-	//cout << "After " << size() << "\t" << newbunch.size() << endl;
 }
 
 inline size_t ParticleBunch::AddParticle(const Particle& p)
@@ -7,7 +7,14 @@
 
 #include "merlin_config.h"
 #include "ParticleBunchUtilities.h"
+#include "ParticleDistributionGenerator.h"
+#include "BeamData.h"
+#include "BunchFilter.h"
+#include "NormalTransform.h"
+#include "MatrixMaps.h"
+#include "RandomNG.h"
 
+#include <algorithm>
 #include <vector>
 #include <cmath>
 
@@ -200,4 +207,94 @@ size_t ParticleBunchDistribution(ParticleBunch& bunch, PScoord u, double umin, d
 	return lost;
 }
 
+size_t GenerateBunchParticles(PSvectorArray& particles, size_t np, const ParticleDistributionGenerator& generator,
+	const BeamData& beam, ParticleBunchFilter* filter, size_t block_size)
+{
+	particles.clear();
+	if(np == 0)
+	{
+		return 0;
+	}
+	if(block_size == 0)
+	{
+		block_size = 1;
+	}
+
+	RMtrx M;
+	M.R = NormalTransform(beam);
+
+	// The first particle is *always* the centroid particle
+	PSvector p0;
+	p0.x() = beam.x0;
+	p0.xp() = beam.xp0;
+	p0.y() = beam.y0;
+	p0.yp() = beam.yp0;
+	p0.dp() = 0;
+	p0.ct() = beam.ct0;
+	p0.type() = -1.0;
+	p0.location() = -1.0;
+	p0.id() = 0;
+	p0.sd() = 0.0;
+
+	particles.resize(np);
+	particles[0] = p0;
+
+	const size_t ngen = np - 1;
+	const long nblocks = (ngen + block_size - 1) / block_size;
+	const size_t stream_hash = hash_string("GenerateBunchParticles");
+	const bool local_gen = generator.SupportsLocalGenerator();
+	std::vector<size_t> filtered(nblocks, 0);
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(dynamic) if(local_gen)
+#endif
+	for(long b = 0; b < nblocks; b++)
+	{
+		std::mt19937_64 gen = RandomNG::getStreamGenerator(stream_hash, b);
+		const size_t first = 1 + b * block_size;
+		const size_t last = std::min(first + block_size, np);
+
+		size_t i = first;
+		while(i < last)
+		{
+			PSvector p = local_gen ? generator.GenerateFromDistribution(gen) : generator.GenerateFromDistribution();
+
+			// apply emittance
+			p.x() *= sqrt(beam.emit_x);
+			p.xp() *= sqrt(beam.emit_x);
+			p.y() *= sqrt(beam.emit_y);
+			p.yp() *= sqrt(beam.emit_y);
+			p.dp() *= sqrt(beam.sig_dp);
+			p.ct() *= sqrt(beam.sig_z);
+
+			// Apply Courant-Snyder
+			M.Apply(p);
+
+			p += p0; // add centroid
+
+			p.type() = -1.0;
+			p.location() = -1.0;
+			p.id() = i;
+			p.sd() = 0.0;
+
+			if(filter == nullptr || filter->Apply(p))
+			{
+				particles[i] = p;
+				i++;
+			}
+			else
+			{
+				filtered[b]++;
+			}
+		}
+	}
+
+	size_t total_filtered = 0;
+	for(auto f : filtered)
+	{
+		total_filtered += f;
+	}
+	return total_filtered;
 }
+
+} // end namespace ParticleTracking
@@ -13,6 +13,9 @@
 
 #include <vector>
 
+class ParticleDistributionGenerator;
+class BeamData;
+
 namespace ParticleTracking
 {
 
@@ -40,6 +43,23 @@ size_t ParticleBinList(ParticleBunch& bunch, double zmin, double zmax, size_t nb
 size_t ParticleBunchDistribution(ParticleBunch& bunch, PScoord u, double umin, double umax, double du,
 	std::vector<double>& bins, bool normalise, bool truncate);
 
+/**
+ * Fill particles with np phase space vectors drawn from generator and
+ * matched to beam, in the same way as the ParticleBunch constructor. The
+ * first particle is the centroid. An optional filter rejects particles.
+ *
+ * Particles are generated in blocks of block_size, each block using its own
+ * generator stream (RandomNG::getStreamGenerator()), so the result depends
+ * only on the seed and block_size. When built with ENABLE_OPENMP, and the
+ * generator supports local generators, the blocks are generated in parallel.
+ * The filter must then be safe to call from several threads.
+ *
+ * The result can be passed to the ParticleBunch(P0, Q, particles) constructor.
+ * Returns the number of particles rejected by the filter.
+ */
+size_t GenerateBunchParticles(PSvectorArray& particles, size_t np, const ParticleDistributionGenerator& generator,
+	const BeamData& beam, ParticleBunchFilter* filter = nullptr, size_t block_size = 4096);
+
 }
 
 #endif
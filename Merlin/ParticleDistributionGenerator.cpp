@@ -10,39 +10,54 @@
 #include "NumericalConstants.h"
 
 PSvector NormalParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector NormalParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	p.x()   = RandomGauss(1, cutoffs.x());
-	p.xp()  = RandomGauss(1, cutoffs.xp());
-	p.y()   = RandomGauss(1, cutoffs.y());
-	p.yp()  = RandomGauss(1, cutoffs.yp());
-	p.dp()  = RandomGauss(1, cutoffs.dp());
-	p.ct()  = RandomGauss(1, cutoffs.ct());
+	p.x()   = RandomGauss(gen, 1, cutoffs.x());
+	p.xp()  = RandomGauss(gen, 1, cutoffs.xp());
+	p.y()   = RandomGauss(gen, 1, cutoffs.y());
+	p.yp()  = RandomGauss(gen, 1, cutoffs.yp());
+	p.dp()  = RandomGauss(gen, 1, cutoffs.dp());
+	p.ct()  = RandomGauss(gen, 1, cutoffs.ct());
 	return p;
 }
 
 PSvector UniformParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector UniformParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	p.x()   = RandomNG::uniform(-1, 1);
-	p.xp()  = RandomNG::uniform(-1, 1);
-	p.y()   = RandomNG::uniform(-1, 1);
-	p.yp()  = RandomNG::uniform(-1, 1);
-	p.dp()  = RandomNG::uniform(-1, 1);
-	p.ct()  = RandomNG::uniform(-1, 1);
+	p.x()   = RandomNG::uniform(gen, -1, 1);
+	p.xp()  = RandomNG::uniform(gen, -1, 1);
+	p.y()   = RandomNG::uniform(gen, -1, 1);
+	p.yp()  = RandomNG::uniform(gen, -1, 1);
+	p.dp()  = RandomNG::uniform(gen, -1, 1);
+	p.ct()  = RandomNG::uniform(gen, -1, 1);
 	return p;
 }
 
 PSvector RingParticleDistributionGenerator::GenerateFromDistribution() const
+{
+	return GenerateFromDistribution(RandomNG::getGenerator());
+}
+
+PSvector RingParticleDistributionGenerator::GenerateFromDistribution(std::mt19937_64& gen) const
 {
 	PSvector p(0);
-	double u = RandomNG::uniform(-pi, pi);
+	double u = RandomNG::uniform(gen, -pi, pi);
 	p.x()   = cos(u);
 	p.xp()  = sin(u);
-	u = RandomNG::uniform(-pi, pi);
+	u = RandomNG::uniform(gen, -pi, pi);
 	p.y()   = cos(u);
 	p.yp()  = sin(u);
-	p.dp()  = RandomNG::uniform(-1, 1);
-	p.ct()  = RandomNG::uniform(-1, 1);
+	p.dp()  = RandomNG::uniform(gen, -1, 1);
+	p.ct()  = RandomNG::uniform(gen, -1, 1);
 	return p;
 }
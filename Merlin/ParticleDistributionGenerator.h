@@ -16,6 +16,11 @@ inline double RandomGauss(double variance, double cutoff)
 	return cutoff == 0 ? RandomNG::normal(0, variance) : RandomNG::normal(0, variance, cutoff);
 }
 
+inline double RandomGauss(std::mt19937_64& gen, double variance, double cutoff)
+{
+	return RandomNG::normal(gen, 0, variance, cutoff);
+}
+
 /**
  * Base class for distribution generators. These can be used by
  * ParticleTracking::ParticleBunch::ParticleBunch to construct bunches with
@@ -25,6 +30,11 @@ inline double RandomGauss(double variance, double cutoff)
  * that returns a single PSvector from the distribution.
  *
  *  Additional parameters can be passed to the constructors of derived classes.
+ *
+ *  Derived classes that can draw from an explicit generator should also
+ *  override GenerateFromDistribution(std::mt19937_64&) and
+ *  SupportsLocalGenerator(), which allows the bunch to be generated in
+ *  parallel, see ParticleTracking::GenerateBunchParticles().
  */
 class ParticleDistributionGenerator
 {
@@ -33,6 +43,25 @@ public:
 	 * Returns a single PSvector from the distribution
 	 */
 	virtual PSvector GenerateFromDistribution() const = 0;
+
+	/**
+	 * Returns a single PSvector from the distribution, drawn using gen.
+	 * The default falls back to the global RandomNG generator.
+	 */
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const
+	{
+		return GenerateFromDistribution();
+	}
+
+	/**
+	 * True if GenerateFromDistribution(std::mt19937_64&) only uses the
+	 * supplied generator, and so may be called from several threads.
+	 */
+	virtual bool SupportsLocalGenerator() const
+	{
+		return false;
+	}
+
 	virtual ~ParticleDistributionGenerator()
 	{
 	}
@@ -60,6 +89,11 @@ public:
 	{
 	}
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 private:
 	PSvector cutoffs;
 };
@@ -71,6 +105,11 @@ class UniformParticleDistributionGenerator: public ParticleDistributionGenerator
 {
 public:
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 /**
@@ -80,6 +119,11 @@ class RingParticleDistributionGenerator: public ParticleDistributionGenerator
 {
 public:
 	virtual PSvector GenerateFromDistribution() const override;
+	virtual PSvector GenerateFromDistribution(std::mt19937_64& gen) const override;
+	virtual bool SupportsLocalGenerator() const override
+	{
+		return true;
+	}
 };
 
 #endif
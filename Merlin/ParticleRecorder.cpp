@@ -0,0 +1,358 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+#include "ComponentFrame.h"
+#include "MerlinException.h"
+#include "ParticleBunch.h"
+#include "ParticleRecorder.h"
+
+using namespace std;
+using namespace ParticleTracking;
+
+namespace
+{
+
+const char magic[8] = {'M', 'E', 'R', 'L', 'I', 'N', 'P', 'R'};
+const uint32_t version = 1;
+const uint32_t point_record = 1;
+const uint32_t data_record = 2;
+
+template<class T>
+void Put(ostream& os, const T& x)
+{
+	os.write(reinterpret_cast<const char*>(&x), sizeof(T));
+}
+
+template<class T>
+void PutArray(ostream& os, const vector<T>& v)
+{
+	os.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+}
+
+template<class T>
+T Get(istream& is)
+{
+	T x;
+	if(!is.read(reinterpret_cast<char*>(&x), sizeof(T)))
+	{
+		throw MerlinException("ParticleRecorder: file is truncated");
+	}
+	return x;
+}
+
+// appends n values to v
+template<class T>
+void GetArray(istream& is, vector<T>& v, size_t n)
+{
+	const size_t n0 = v.size();
+	v.resize(n0 + n);
+	if(n && !is.read(reinterpret_cast<char*>(&v[n0]), n * sizeof(T)))
+	{
+		throw MerlinException("ParticleRecorder: file is truncated");
+	}
+}
+
+} // end anonymous namespace
+
+void ParticleRecorder::Columns::clear()
+{
+	turn.clear();
+	id.clear();
+	for(int k = 0; k < 6; k++)
+	{
+		coord[k].clear();
+	}
+}
+
+void ParticleRecorder::Columns::reserve(size_t n)
+{
+	turn.reserve(n);
+	id.reserve(n);
+	for(int k = 0; k < 6; k++)
+	{
+		coord[k].reserve(n);
+	}
+}
+
+ParticleRecorder::ParticleRecorder(const string& filename, size_t chunk_rows) :
+	SimulationOutput(), file(filename, ios::binary), chunkRows(max(chunk_rows, size_t(1))), turn(0), rows(0),
+	selectIds(false), selectScattered(false), selectAmplitude(false), a2min(0), a2max(0), betax(1), alphax(0),
+	betay(1), alphay(0)
+{
+	if(!file)
+	{
+		throw MerlinException("ParticleRecorder: cannot open " + filename);
+	}
+	file.write(magic, sizeof(magic));
+	Put(file, version);
+
+	// observation points are picked out in Record(), and turns counted at the end of each run
+	output_all = true;
+	output_initial = false;
+	output_final = true;
+}
+
+ParticleRecorder::~ParticleRecorder()
+{
+	try
+	{
+		Flush();
+	}
+	catch(MerlinException& e)
+	{
+		cerr << e.Msg() << endl;
+	}
+}
+
+void ParticleRecorder::AddObservationPoint(const string& pattern)
+{
+	patterns.push_back(StringPattern(pattern));
+	ForgetUnobserved();
+}
+
+void ParticleRecorder::AddObservationRange(double s0, double s1)
+{
+	ranges.push_back(make_pair(min(s0, s1), max(s0, s1)));
+	ForgetUnobserved();
+}
+
+void ParticleRecorder::ForgetUnobserved()
+{
+	// look again at the frames that were not observation points
+	for(auto it = pointIndex.begin(); it != pointIndex.end();)
+	{
+		it = it->second < 0 ? pointIndex.erase(it) : ++it;
+	}
+}
+
+void ParticleRecorder::SelectIds(const vector<int>& ids)
+{
+	selectIds = true;
+	idSelected.clear();
+	for(int id : ids)
+	{
+		if(id >= 0)
+		{
+			if(size_t(id) >= idSelected.size())
+			{
+				idSelected.resize(id + 1, 0);
+			}
+			idSelected[id] = 1;
+		}
+	}
+}
+
+void ParticleRecorder::SelectScattered(bool scattered)
+{
+	selectScattered = scattered;
+}
+
+void ParticleRecorder::SelectAmplitude(double amin, double amax, double beta_x, double alpha_x, double beta_y, double
+	alpha_y)
+{
+	selectAmplitude = true;
+	a2min = amin * amin;
+	a2max = amax * amax;
+	betax = beta_x;
+	alphax = alpha_x;
+	betay = beta_y;
+	alphay = alpha_y;
+}
+
+void ParticleRecorder::ClearSelection()
+{
+	selectIds = false;
+	idSelected.clear();
+	selectScattered = false;
+	selectAmplitude = false;
+}
+
+inline bool ParticleRecorder::Selected(const PSvector& p) const
+{
+	if(selectIds)
+	{
+		const double id = p.id();
+		if(!(id >= 0 && id < idSelected.size() && idSelected[size_t(id)]))
+		{
+			return false;
+		}
+	}
+	if(selectScattered && p.type() == -1)
+	{
+		return false;
+	}
+	if(selectAmplitude)
+	{
+		// 2J = (x^2 + (alpha x + beta x')^2) / beta
+		const double ux = alphax * p.x() + betax * p.xp();
+		const double uy = alphay * p.y() + betay * p.yp();
+		const double a2 = (p.x() * p.x() + ux * ux) / betax + (p.y() * p.y() + uy * uy) / betay;
+		if(a2 < a2min || a2 > a2max)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int ParticleRecorder::FindPoint(const ComponentFrame* frame)
+{
+	const string name = frame->GetComponent().GetQualifiedName();
+	const double s = frame->GetPosition();
+	bool observed = any_of(ranges.begin(), ranges.end(), [s](const pair<double, double>& r)
+	{
+		return s >= r.first && s <= r.second;
+	});
+	observed = observed || any_of(patterns.begin(), patterns.end(), [&name](const StringPattern& pattern)
+	{
+		return pattern.Match(name);
+	});
+	if(!observed)
+	{
+		return -1;
+	}
+
+	const uint32_t point = buffers.size();
+	buffers.push_back(Columns());
+	buffers.back().reserve(min(chunkRows, size_t(4096)));
+
+	Put(file, point_record);
+	Put(file, point);
+	Put(file, uint32_t(name.size()));
+	file.write(name.data(), name.size());
+	return point;
+}
+
+void ParticleRecorder::Record(const ComponentFrame* frame, const Bunch* bunch)
+{
+	auto it = pointIndex.find(frame);
+	if(it == pointIndex.end())
+	{
+		it = pointIndex.insert(make_pair(frame, FindPoint(frame))).first;
+	}
+	if(it->second < 0)
+	{
+		return;
+	}
+
+	const size_t point = it->second;
+	Columns& c = buffers[point];
+	const ParticleBunch* PB = static_cast<const ParticleBunch*>(bunch);
+	for(ParticleBunch::const_iterator p = PB->begin(); p != PB->end(); p++)
+	{
+		if(Selected(*p))
+		{
+			c.turn.push_back(turn);
+			c.id.push_back(int32_t(p->id()));
+			for(int k = 0; k < 6; k++)
+			{
+				c.coord[k].push_back((*p)[k]);
+			}
+		}
+	}
+
+	if(c.size() >= chunkRows)
+	{
+		WriteChunk(point);
+	}
+}
+
+void ParticleRecorder::RecordInitialBunch(const Bunch* bunch)
+{
+}
+
+void ParticleRecorder::RecordFinalBunch(const Bunch* bunch)
+{
+	turn++;
+}
+
+void ParticleRecorder::WriteChunk(size_t point)
+{
+	Columns& c = buffers[point];
+	if(c.size() == 0)
+	{
+		return;
+	}
+
+	Put(file, data_record);
+	Put(file, uint32_t(point));
+	Put(file, uint64_t(c.size()));
+	PutArray(file, c.turn);
+	PutArray(file, c.id);
+	for(int k = 0; k < 6; k++)
+	{
+		PutArray(file, c.coord[k]);
+	}
+	if(!file)
+	{
+		throw MerlinException("ParticleRecorder: write failed");
+	}
+
+	rows += c.size();
+	c.clear();
+}
+
+void ParticleRecorder::Flush()
+{
+	for(size_t point = 0; point < buffers.size(); point++)
+	{
+		WriteChunk(point);
+	}
+	file.flush();
+}
+
+void ParticleRecorder::Read(const string& filename, vector<string>& points, vector<Columns>& data)
+{
+	points.clear();
+	data.clear();
+
+	ifstream is(filename, ios::binary);
+	if(!is)
+	{
+		throw MerlinException("ParticleRecorder: cannot open " + filename);
+	}
+	char m[sizeof(magic)];
+	if(!is.read(m, sizeof(m)) || memcmp(m, magic, sizeof(magic)) != 0 || Get<uint32_t>(is) != version)
+	{
+		throw MerlinException("ParticleRecorder: " + filename + " is not a recorder file");
+	}
+
+	while(is.peek() != char_traits<char>::eof())
+	{
+		const uint32_t tag = Get<uint32_t>(is);
+		const uint32_t point = Get<uint32_t>(is);
+		if(tag == point_record && point == points.size())
+		{
+			string name(Get<uint32_t>(is), '\0');
+			if(!name.empty() && !is.read(&name[0], name.size()))
+			{
+				throw MerlinException("ParticleRecorder: file is truncated");
+			}
+			points.push_back(name);
+			data.push_back(Columns());
+		}
+		else if(tag == data_record && point < points.size())
+		{
+			const uint64_t n = Get<uint64_t>(is);
+			Columns& c = data[point];
+			GetArray(is, c.turn, n);
+			GetArray(is, c.id, n);
+			for(int k = 0; k < 6; k++)
+			{
+				GetArray(is, c.coord[k], n);
+			}
+		}
+		else
+		{
+			throw MerlinException("ParticleRecorder: file is corrupt");
+		}
+	}
+}
@@ -0,0 +1,170 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef ParticleRecorder_h
+#define ParticleRecorder_h 1
+
+#include "merlin_config.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "PSvector.h"
+#include "StringPattern.h"
+#include "TrackingSimulation.h"
+
+/**
+ * Records the phase space history of selected particles at a few
+ * observation points, in a binary file.
+ *
+ * Observation points are the elements whose qualified name matches a
+ * pattern given to AddObservationPoint(), or whose centre lies in an s
+ * range given to AddObservationRange(). Each matching frame is found
+ * once, the first time the bunch passes it. A particle is recorded if it
+ * passes every selection that has been set: its id is in a set of ids,
+ * it has been scattered (type() != -1), or its betatron amplitude is in
+ * a range. The selected particles are copied into columns kept for each
+ * observation point, and written to the file in chunks, so the output
+ * and its cost follow the number of particles selected rather than the
+ * size of the bunch.
+ *
+ * The turn number is advanced at the end of each TrackingSimulation::Run()
+ * or Continue(), which for a ring is one turn. It can also be set directly
+ * with SetTurn() or NextTurn().
+ *
+ * The file holds a header and a sequence of records, in native byte order:
+ *
+ *     "MERLINPR" uint32 version
+ *     point record: uint32 1, uint32 point, uint32 length, name
+ *     data record:  uint32 2, uint32 point, uint64 n, int32 turn[n], int32 id[n], double coord[6][n]
+ *
+ * with the coordinates in the order x, xp, y, yp, ct, dp. Read() reads
+ * it back.
+ */
+class ParticleRecorder: public SimulationOutput
+{
+public:
+	/**
+	 * The particles recorded at an observation point, by column
+	 */
+	struct Columns
+	{
+		std::vector<int32_t> turn;
+		std::vector<int32_t> id;
+		std::vector<double> coord[6];
+
+		size_t size() const
+		{
+			return id.size();
+		}
+		void clear();
+		void reserve(size_t n);
+	};
+
+	/**
+	 * @param[in] filename Output file
+	 * @param[in] chunk_rows Number of rows of an observation point held before they are written
+	 */
+	ParticleRecorder(const std::string& filename, size_t chunk_rows = 65536);
+
+	/// Writes any rows still held
+	~ParticleRecorder();
+
+	/// Record at the elements whose qualified name matches pattern
+	void AddObservationPoint(const std::string& pattern);
+
+	/// Record at the elements whose centre lies from s0 to s1
+	void AddObservationRange(double s0, double s1);
+
+	/// Record only particles with one of these ids
+	void SelectIds(const std::vector<int>& ids);
+
+	/// Record only particles that have been scattered, with type() != -1
+	void SelectScattered(bool scattered = true);
+
+	/**
+	 * Record only particles with betatron amplitude sqrt(2 Jx + 2 Jy)
+	 * from amin to amax, with the actions found from the given Twiss
+	 * parameters, which are used at every observation point.
+	 */
+	void SelectAmplitude(double amin, double amax, double beta_x, double alpha_x, double beta_y, double alpha_y);
+
+	/// Record every particle
+	void ClearSelection();
+
+	/// Set the number of the current turn
+	void SetTurn(int n)
+	{
+		turn = n;
+	}
+
+	/// Advance to the next turn
+	void NextTurn()
+	{
+		turn++;
+	}
+
+	int GetTurn() const
+	{
+		return turn;
+	}
+
+	/// Number of observation points found so far
+	size_t GetNumberOfPoints() const
+	{
+		return buffers.size();
+	}
+
+	/// Number of rows recorded so far
+	size_t GetNumberOfRows() const
+	{
+		return rows;
+	}
+
+	/// Writes the rows held for every observation point to the file
+	void Flush();
+
+	/**
+	 * Reads a file written by ParticleRecorder, giving the name and the
+	 * recorded particles of each observation point.
+	 */
+	static void Read(const std::string& filename, std::vector<std::string>& points, std::vector<Columns>& data);
+
+protected:
+	void Record(const ComponentFrame* frame, const Bunch* bunch);
+	void RecordInitialBunch(const Bunch* bunch);
+	void RecordFinalBunch(const Bunch* bunch);
+
+private:
+	void ForgetUnobserved();
+	int FindPoint(const ComponentFrame* frame);
+	bool Selected(const PSvector& p) const;
+	void WriteChunk(size_t point);
+
+	std::ofstream file;
+	size_t chunkRows;
+	int turn;
+	size_t rows;
+
+	std::vector<StringPattern> patterns;
+	std::vector<std::pair<double, double> > ranges;
+	std::unordered_map<const ComponentFrame*, int> pointIndex;
+	std::vector<Columns> buffers;
+
+	// compiled selection
+	bool selectIds;
+	std::vector<char> idSelected;
+	bool selectScattered;
+	bool selectAmplitude;
+	double a2min, a2max;
+	double betax, alphax, betay, alphay;
+};
+
+#endif
@@ -9,37 +9,31 @@
 
 #include "AcceleratorModel.h"
 
-#include "ParticleBunch.h"
-#include "ParticleTracker.h"
-#include "RingDeltaTProcess.h"
-
-#include "ClosedOrbit.h"
-#include "TransferMatrix.h"
 #include "PhaseAdvance.h"
 #include "LatticeFunctions.h"
 
 #include "MatrixPrinter.h"
 
-using namespace ParticleTracking;
-
-PhaseAdvance::PhaseAdvance(AcceleratorModel* aModel, LatticeFunctionTable* aTwiss, double refMomentum) :
-	theModel(aModel), theTwiss(aTwiss), p0(refMomentum), delta(1.0E-8), bendscale(1E-16)
+PhaseAdvance::PhaseAdvance(AcceleratorModel* aModel, LatticeFunctionTable*, double refMomentum) :
+	theModel(aModel), maps(aModel, refMomentum)
 {
-	//~ std::cout << "\n\tPhaseAdvance Class created" << std::endl;
-	//~ std::cout << "please note that the following functions must be added to your LatticeFunctionTable: (0,0,1), (0,0,2), (0,0,3), using the following function:" << std::endl;
-	//~ std::cout << "\n\t\t myLatticeFunctionTable->AddFunction(0,0,1);" << std::endl;
-	//~ std::cout << "\n\t\t myLatticeFunctionTable->AddFunction(0,0,2);" << std::endl;
-	//~ std::cout << "\n\t\t myLatticeFunctionTable->AddFunction(0,0,3);" << std::endl;
+	maps.SetDelta(1.0E-8);
+	maps.ScaleBendPathLength(1E-16);
 }
 
 void PhaseAdvance::SetDelta(double new_delta)
 {
-	delta = new_delta;
+	maps.SetDelta(new_delta);
 }
 
 void PhaseAdvance::ScaleBendPathLength(double scale)
 {
-	bendscale = scale;
+	maps.ScaleBendPathLength(scale);
+}
+
+void PhaseAdvance::Invalidate()
+{
+	maps.Invalidate();
 }
 
 double PhaseAdvance::PhaseAdvanceBetween(int n1, int n2, bool horizontal)
@@ -59,16 +53,6 @@ double PhaseAdvance::PhaseAdvanceBetween(int n1, int n2, bool horizontal)
 		deltamu = element2.second - element1.second;
 	}
 
-	//OBSOLETE/NOT WORKING
-	//~ RealMatrix M = TransferMapBetween(n1,n2);
-
-	//~ if(horizontal){
-	//~ deltamu = asin( M(1,0) / (sqrt(theTwiss->Value(1,1,1,n1) * theTwiss->Value(1,1,1,n2))) );
-	//~ }
-	//~ else{
-	//~ deltamu = asin( M(2,3) / (sqrt(theTwiss->Value(3,3,2,n1) * theTwiss->Value(3,3,2,n2))) );
-	//~ }
-
 	return deltamu;
 }
 
@@ -98,32 +82,7 @@ double PhaseAdvance::PhaseAdvanceBetween(string name, bool horizontal)
 
 RealMatrix PhaseAdvance::TransferMapBetween(int n1, int n2)
 {
-	Particle p2(0.);
-
-	if(n1 > n2)
-	{
-		std::cout
-			<<
-			"\n\tPhaseAdvance::TransferMapBetween: WARNING: n1>n2, tracker cannot compute \nt Use GetPhaseAdvanceX(n2, n1)"
-			<< endl;
-	}
-
-	ClosedOrbit co(theModel, p0);
-	co.SetDelta(delta);
-	co.TransverseOnly(false);
-	co.ScaleBendPathLength(bendscale);
-
-	RealMatrix M(6);
-	TransferMatrix tm(theModel, p0);
-	tm.SetDelta(delta);
-	tm.ScaleBendPathLength(bendscale);
-
-	co.FindClosedOrbit(p2);
-	//~ std::cout << "PhaseAdvance::TransferMapBetween: ClosedOrbit done" << endl;
-	tm.FindTM(M, p2, n1, n2);
-	//~ std::cout << "PhaseAdvance::TransferMapBetween: TransferMatrix done" << endl;
-
-	return M;
+	return maps.MapBetween(n1, n2 + 1);
 }
 
 double PhaseAdvance::GetPhaseAdvanceX(int n2, int n1)
@@ -138,46 +97,5 @@ double PhaseAdvance::GetPhaseAdvanceY(int n2, int n1)
 
 pair<double, double> PhaseAdvance::CalcIntegerPart(int n)
 {
-	//Fractional Phase Advance stored in Twiss
-	//MuX = theTwiss->Value(0,0,1,n)
-	//MuY = theTwiss->Value(0,0,2,n)
-	double mux(0.), muy(0.);
-	int intmux(0), intmuy(0);
-	double last_mux(0.), last_muy(0.);
-
-	//Iterate through all elements to sum integer parts
-	for(int i = 1; i < n; ++i)
-	{
-		if((theTwiss->Value(0, 0, 1, i) == last_mux) || (theTwiss->Value(0, 0, 1, i) <= 0.))
-		{
-		}
-		else if((theTwiss->Value(0, 0, 1, i) < last_mux))
-		{
-			//~ if( (theTwiss->Value(0,0,1,i)/last_mux) < 0.9999999999){ //to stop iteration for small fluctuations
-			if((theTwiss->Value(0, 0, 1, i) / last_mux) < 0.9999)  //to stop iteration for small fluctuations
-			{
-				++intmux;
-			}
-		}
-		if(theTwiss->Value(0, 0, 2, i) == last_muy || (theTwiss->Value(0, 0, 2, i) <= 0.))
-		{
-		}
-		else if(theTwiss->Value(0, 0, 2, i) < last_muy)
-		{
-			//~ if( (theTwiss->Value(0,0,2,i)/last_muy) < 0.9999999999){ //to stop iteration for small fluctuations
-			if((theTwiss->Value(0, 0, 2, i) / last_muy) < 0.9999)  //to stop iteration for small fluctuations
-			{
-				++intmuy;
-			}
-		}
-		last_mux = theTwiss->Value(0, 0, 1, i);
-		last_muy = theTwiss->Value(0, 0, 2, i);
-	}
-
-	mux = intmux + theTwiss->Value(0, 0, 1, n);
-	muy = intmuy + theTwiss->Value(0, 0, 2, n);
-	//~ cout << "mux = " << mux << endl;
-	//~ cout << "muy = " << muy << endl;
-
-	return make_pair(mux, muy);
+	return make_pair(maps.GetPhaseAdvance(n, true), maps.GetPhaseAdvance(n, false));
 }
@@ -12,6 +12,7 @@
 #include "AcceleratorModel.h"
 #include "PSTypes.h"
 #include "LatticeFunctions.h"
+#include "TransferMapTable.h"
 #include "TLAS.h"
 
 using namespace TLAS;
@@ -21,15 +22,28 @@ using namespace TLAS;
  * or the phase advance between two elements
  * or the transfer matrix between two elements
  * We assume that the lattice starts at the beginning of the AcceleratorModel
+ *
+ * The closed orbit, the cumulative transfer maps and the phase advance at every
+ * element are found once, on first use, and held in a TransferMapTable; each
+ * query is then a lookup. Call Invalidate() after changing the model.
  */
 class PhaseAdvance
 {
 public:
+	/**
+	 * The lattice function table is not used, the optics are found
+	 * from the transfer maps; it is kept for existing callers.
+	 */
 	PhaseAdvance(AcceleratorModel* aModel, LatticeFunctionTable* aTwiss, double refMomentum);
 
 	void SetDelta(double new_delta);
 	void ScaleBendPathLength(double scale);
 
+	/**
+	 * Discards the cached optics
+	 */
+	void Invalidate();
+
 	/**
 	 * PA between two lattice elements
 	 * can take either the ID number of the elements in the AcceleratorModel
@@ -47,7 +61,9 @@ public:
 	double PhaseAdvanceBetween(string name, bool horizontal);
 
 	/**
-	 * Calculates the transfer matrix between two lattice elements
+	 * Calculates the transfer matrix between two lattice elements,
+	 * from the entrance of n1 to the exit of n2. If n1 > n2 the map
+	 * continues around the ring.
 	 */
 	RealMatrix TransferMapBetween(int n1, int n2);
 
@@ -55,14 +71,23 @@ public:
 	double GetPhaseAdvanceX(int n2, int n1 = 0);
 	double GetPhaseAdvanceY(int n2, int n1 = 0);
 
+	/**
+	 * Total phase advance (in units of 2 pi) in x and y at the
+	 * entrance of element n
+	 */
 	pair<double, double> CalcIntegerPart(int n);
 
+	/**
+	 * The cached optics
+	 */
+	TransferMapTable& GetTransferMaps()
+	{
+		return maps;
+	}
+
 private:
 	AcceleratorModel* theModel;
-	LatticeFunctionTable* theTwiss;
-	double p0;
-	double delta;
-	double bendscale;
+	TransferMapTable maps;
 };
 
 #endif
@@ -5,10 +5,12 @@
  * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
  */
 
+#include <algorithm>
 #include <cmath>
 #include <random>
 #include "NumericalConstants.h"
 #include "RandomNG.h"
+#include "SynchRadParticleProcess.h"
 
 namespace
 {
@@ -32,6 +34,72 @@ double AWSpectrumGen(double uc)
 	return u2;
 }
 
+double TabulatedSpectrumGen(double uc)
+{
+	return uc * SynchRadSpectrumTable::Get().Sample(Ran1());
+}
+
+const SynchRadSpectrumTable& SynchRadSpectrumTable::Get()
+{
+	static const SynchRadSpectrumTable table;
+	return table;
+}
+
+SynchRadSpectrumTable::SynchRadSpectrumTable()
+{
+	// Nodes equally spaced in log(x). Below the first node the spectrum is
+	// a1 x^-2/3 - pi / sqrt(3), and beyond the last one it is negligible.
+	const int nodes = 4096;
+	const double xmin = 1.0e-6;
+	const double xmax = 50.0;
+	const double a1 = pow(2., 2. / 3.) * tgamma(2. / 3.);
+
+	// 4 point Gauss-Legendre integration in log(x) over each interval
+	const double gx[4] = {-0.8611363115940526, -0.3399810435848563, 0.3399810435848563, 0.8611363115940526};
+	const double gw[4] = {0.3478548451374538, 0.6521451548625461, 0.6521451548625461, 0.3478548451374538};
+
+	const double step = log(xmax / xmin) / (nodes - 1);
+	x.resize(nodes);
+	F.resize(nodes);
+	x[0] = xmin;
+	F[0] = 3 * a1 * cbrt(xmin) - pi / sqrt(3.) * xmin;
+	for(int i = 1; i < nodes; i++)
+	{
+		const double t0 = log(xmin) + (i - 1) * step;
+		double sum = 0;
+		for(int k = 0; k < 4; k++)
+		{
+			const double xk = exp(t0 + (1 + gx[k]) * step / 2);
+			sum += gw[k] * SynRadC(xk) * xk;
+		}
+		x[i] = exp(t0 + step);
+		F[i] = F[i - 1] + sum * step / 2;
+	}
+
+	total = F.back() + SynRadC(xmax);
+	for(double& f : F)
+	{
+		f /= total;
+	}
+}
+
+double SynchRadSpectrumTable::Sample(double u) const
+{
+	if(u < F.front())
+	{
+		const double r = u / F.front();
+		return x.front() * r * r * r;
+	}
+
+	const size_t i = std::upper_bound(F.begin(), F.end(), u) - F.begin();
+	if(i == F.size())
+	{
+		// exponential tail
+		return u < 1 && F.back() < 1 ? x.back() - log((1 - u) / (1 - F.back())) : x.back();
+	}
+	return x[i - 1] + (x[i] - x[i - 1]) * (u - F[i - 1]) / (F[i] - F[i - 1]);
+}
+
 namespace
 {
 
@@ -14,6 +14,8 @@
 #include "deleters.h"
 
 #include "MerlinProfile.h"
+#include "ScopeProfiler.h"
+#include "Bunch.h"
 
 namespace
 {
@@ -83,9 +85,10 @@ struct DoProc
 	double ds;
 	const string& cid;
 	ostream* vos;
+	const Bunch* bunch;
 
-	DoProc(double s, double ds1, const string& id, ostream* os) :
-		s0(s), ds(ds1), cid(id), vos(os)
+	DoProc(double s, double ds1, const string& id, ostream* os, const Bunch* b) :
+		s0(s), ds(ds1), cid(id), vos(os), bunch(b)
 	{
 	}
 
@@ -99,7 +102,17 @@ struct DoProc
 			}
 			MERLIN_PROFILE_START_TIMER(proc->GetID());
 //	    cout << proc->GetID() << "\t" << ds << endl;
-			proc->DoProcess(ds);
+			if(ScopeProfiler::IsEnabled())
+			{
+				size_t np = bunch ? bunch->GetParticleCount() : 0;
+				ScopeProfiler::Begin(proc->GetProfileID());
+				proc->DoProcess(ds);
+				ScopeProfiler::End(np);
+			}
+			else
+			{
+				proc->DoProcess(ds);
+			}
 			MERLIN_PROFILE_END_TIMER(proc->GetID());
 		}
 	}
@@ -118,7 +131,7 @@ void DoProc::Trace(BunchProcess* proc)
 } // end of anonymous namespace
 
 ProcessStepManager::ProcessStepManager() :
-	total_s(0), log(nullptr), processTable()
+	total_s(0), log(nullptr), currentBunch(nullptr), processTable()
 {
 }
 
@@ -131,6 +144,7 @@ void ProcessStepManager::Initialise(Bunch& bunch)
 {
 	for_each(processTable.begin(), processTable.end(), InitProc(bunch));
 	total_s = 0;
+	currentBunch = &bunch;
 }
 
 void ProcessStepManager::Track(AcceleratorComponent& component)
@@ -139,15 +153,29 @@ void ProcessStepManager::Track(AcceleratorComponent& component)
 
 	for_each(processTable.begin(), processTable.end(), SetCmpnt(component));
 
+	const bool profile = ScopeProfiler::IsEnabled();
+	size_t np = 0;
+	if(profile)
+	{
+		np = currentBunch ? currentBunch->GetParticleCount() : 0;
+		ScopeProfiler::BeginComponent(component);
+	}
+
 	const double sc = component.GetLength();
 	double s = 0;
 	do
 	{
 		double ds = for_each(processTable.begin(), processTable.end(), CalcStepSize(sc - s)).ds;
-		for_each(processTable.begin(), processTable.end(), DoProc(s, ds, id, log));
+		for_each(processTable.begin(), processTable.end(), DoProc(s, ds, id, log, currentBunch));
 		s += ds;
 	} while(!fequal(sc, s));
 
+	if(profile)
+	{
+		ScopeProfiler::End(np); // element instance
+		ScopeProfiler::End(np); // element type
+	}
+
 	total_s += sc;
 }
 
@@ -78,6 +78,11 @@ private:
 
 	std::ostream* log;
 
+	/**
+	 * The bunch being tracked, used for ScopeProfiler particle counts.
+	 */
+	Bunch* currentBunch;
+
 	/**
 	 * list of processes in order of priority.
 	 */
@@ -22,6 +22,7 @@ double RFStructure::GetPhase() const
 void RFStructure::SetAmplitude(double Epk)
 {
 	_FIELD->SetAmplitude(Epk);
+	SetModified();
 }
 
 double RFStructure::GetAmplitude() const
@@ -42,23 +43,27 @@ double RFStructure::GetK() const
 void RFStructure::SetFrequency(double f)
 {
 	_FIELD->SetFrequency(f);
+	SetModified();
 }
 
 void RFStructure::SetPhase(double phase)
 {
 	_FIELD->SetPhase(phase);
+	SetModified();
 }
 
 void RFStructure::SetWavelength(double lambda)
 {
 	using PhysicalConstants::SpeedOfLight;
 	_FIELD->SetFrequency(SpeedOfLight / lambda);
+	SetModified();
 }
 
 void RFStructure::SetK(double k)
 {
 	using PhysicalConstants::SpeedOfLight;
 	_FIELD->SetFrequency(SpeedOfLight * k / twoPi);
+	SetModified();
 }
 
 RFStructure::RFStructure(const string& id, double len, RFAcceleratingField* aField) :
@@ -27,6 +27,11 @@ const string& RMSProfileMonitor::GetType() const
 	_TYPESTR(RMSProfileMonitor)
 }
 
+bool RMSProfileMonitor::IsRecording() const
+{
+	return !buffers.empty() && IsActive();
+}
+
 void RMSProfileMonitor::MakeMeasurement(const Bunch& aBunch)
 {
 	if(!buffers.empty() && IsActive())
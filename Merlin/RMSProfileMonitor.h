@@ -72,6 +72,19 @@ public:
 		res_u = ru;
 	}
 
+	void GetResolution(double& rx, double& ry, double& ru) const
+	{
+		rx = res_x;
+		ry = res_y;
+		ru = res_u;
+	}
+
+	/// Angle of the u measurement plane
+	double GetUAngle() const
+	{
+		return uangle;
+	}
+
 	void AddBuffer(Buffer* buffer)
 	{
 		buffers.AddBuffer(buffer);
@@ -113,6 +126,11 @@ public:
 	 */
 	virtual void MakeMeasurement(const Bunch& aBunch);
 
+	/**
+	 *	Returns true if the monitor is active and has a buffer.
+	 */
+	virtual bool IsRecording() const;
+
 	/**
 	 *	Primary tracking interface. Prepares the specified
 	 *	Tracker object for tracking this component.
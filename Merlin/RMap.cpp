@@ -23,6 +23,21 @@ void RMap::ToMatrix(RealMatrix& R, bool init) const
 	}
 }
 
+void RMap::ToArray(double R[6][6]) const
+{
+	for(int i = 0; i < 6; i++)
+	{
+		for(int j = 0; j < 6; j++)
+		{
+			R[i][j] = 0;
+		}
+	}
+	for(const_itor t = rterms.begin(); t != rterms.end(); t++)
+	{
+		R[t->i][t->j] += t->val;
+	}
+}
+
 RMap::operator RealMatrix() const
 {
 	RealMatrix R(6, 6, 0);
@@ -164,6 +164,12 @@ public:
 	 * Conversion to a matrix
 	 */
 	void ToMatrix(RealMatrix&, bool init = true) const;
+
+	/**
+	 * Conversion to a dense 6x6 array, summing any repeated terms
+	 * as Apply() does
+	 */
+	void ToArray(double R[6][6]) const;
 	operator RealMatrix() const;
 
 	/**
@@ -58,3 +58,17 @@ PSvector& RTMap::Apply(PSvector& X) const
 
 	return X = Y;
 }
+
+void RTMap::Jacobian(const PSvector& x, RealMatrix& J) const
+{
+	J = RealMatrix(6, 6, 0.0);
+	for(RMap::const_itor r = rterms.begin(); r != rterms.end(); r++)
+	{
+		J(r->i, r->j) += r->val;
+	}
+	for(const_itor t = tterms.begin(); t != tterms.end(); t++)
+	{
+		J(t->i, t->j) += t->val * x[t->k];
+		J(t->i, t->k) += t->val * x[t->j];
+	}
+}
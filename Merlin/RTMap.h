@@ -79,6 +79,11 @@ public:
 	 */
 	PSvector& Apply(PSvector& p) const;
 
+	/**
+	 * Jacobian of the map about the point x
+	 */
+	void Jacobian(const PSvector& x, RealMatrix& J) const;
+
 	/**
 	 * Output
 	 */
@@ -8,6 +8,8 @@
 #include "RandomNG.h"
 #include "LandauDistribution.h"
 
+#include <cmath>
+
 std::vector<std::uint32_t> RandomNG::master_seed;
 std::unique_ptr<std::mt19937_64> RandomNG::generator;
 
@@ -63,9 +65,10 @@ const std::vector<std::uint32_t>& RandomNG::getSeed()
 double RandomNG::normal(double mean, double variance)
 {
 	if(!generator)
+	{
 		not_seeded();
-	std::normal_distribution<double> dist{mean, sqrt(variance)};
-	return dist(*generator);
+	}
+	return normal(*generator, mean, variance);
 }
 double RandomNG::normal(double mean, double variance, double cutoff)
 {
@@ -73,29 +76,60 @@ double RandomNG::normal(double mean, double variance, double cutoff)
 	{
 		not_seeded();
 	}
+	return normal(*generator, mean, variance, cutoff);
+}
+double RandomNG::normal(std::mt19937_64& gen, double mean, double variance, double cutoff)
+{
+	std::normal_distribution<double> dist{mean, sqrt(variance)};
 	if(cutoff == 0)
 	{
-		return normal(mean, variance);
+		return dist(gen);
 	}
 
 	cutoff = fabs(cutoff) * sqrt(variance);
-	std::normal_distribution<double> dist{mean, sqrt(variance)};
-
 	double x;
 	do
 	{
-		x = dist(*generator);
+		x = dist(gen);
 	} while(fabs(x - mean) > cutoff);
 	return x;
 }
+double RandomNG::normalTail(std::mt19937_64& gen, double cut)
+{
+	cut = fabs(cut);
+	std::uniform_real_distribution<double> flat{0, 1};
+	double x;
+	if(cut < 1)
+	{
+		// acceptance of plain rejection is still above 30%
+		std::normal_distribution<double> dist{0, 1};
+		do
+		{
+			x = dist(gen);
+		} while(fabs(x) < cut);
+		return x;
+	}
+
+	double y;
+	do
+	{
+		x = -log(1 - flat(gen)) / cut;
+		y = -log(1 - flat(gen));
+	} while(2 * y < x * x);
+	return flat(gen) < 0.5 ? cut + x : -(cut + x);
+}
 double RandomNG::uniform(double low, double high)
 {
 	if(!generator)
 	{
 		not_seeded();
 	}
+	return uniform(*generator, low, high);
+}
+double RandomNG::uniform(std::mt19937_64& gen, double low, double high)
+{
 	std::uniform_real_distribution<double> dist{low, high};
-	return dist(*generator);
+	return dist(gen);
 }
 double RandomNG::poisson(double u)
 {
@@ -118,6 +152,10 @@ double RandomNG::landau()
 
 std::mt19937_64& RandomNG::getGenerator()
 {
+	if(!generator)
+	{
+		not_seeded();
+	}
 	return *generator;
 }
 
@@ -159,6 +197,20 @@ void RandomNG::resetLocalGenerator(size_t name_hash)
 	generator_store[name_hash] = new_gen;
 }
 
+std::mt19937_64 RandomNG::getStreamGenerator(size_t name_hash, size_t stream)
+{
+	if(!generator)
+	{
+		not_seeded();
+	}
+	std::vector<std::uint32_t> new_seed{master_seed};
+	new_seed.push_back(name_hash);
+	new_seed.push_back(stream);
+	new_seed.push_back(static_cast<std::uint64_t>(stream) >> 32);
+	std::seed_seq ss(new_seed.begin(), new_seed.end());
+	return std::mt19937_64{ss};
+}
+
 std::uint32_t hash_string(std::string s)
 {
 	return std::hash<std::string>{} (s);
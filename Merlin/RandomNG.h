@@ -74,12 +74,29 @@ public:
 	 */
 	static double normal(double mean, double variance, double cutoff);
 
+	/**
+	 * As normal(), but drawing from the supplied generator rather than the
+	 * global one. A cutoff of 0 gives no truncation.
+	 */
+	static double normal(std::mt19937_64& gen, double mean, double variance, double cutoff = 0);
+
+	/**
+	 * Generates a random number from the tail of a unit normal distribution,
+	 * |x| >= cut, using the supplied generator. Samples are drawn directly
+	 * (Marsaglia's tail method) rather than by rejecting from the full
+	 * distribution, so the cost does not grow with cut.
+	 */
+	static double normalTail(std::mt19937_64& gen, double cut);
+
 	/**
 	 * Generates a uniform random number in the range
 	 * |low,high> inclusive.
 	 */
 	static double uniform(double low, double high);
 
+	/// As uniform(), but drawing from the supplied generator
+	static double uniform(std::mt19937_64& gen, double low, double high);
+
 	/**
 	 * Generates a Poisson random number in with a given expected value.
 	 */
@@ -110,6 +127,16 @@ public:
 	/// Reset a given local generator
 	static void resetLocalGenerator(size_t name_hash);
 
+	/**
+	 * Get an independent generator for one stream of a parallel task.
+	 *
+	 * The seed is built from the master seed, name_hash and the stream
+	 * number, so a task split into numbered blocks gives the same result
+	 * however the blocks are distributed over threads. Unlike
+	 * getLocalGenerator() the generator is returned by value and not stored.
+	 */
+	static std::mt19937_64 getStreamGenerator(size_t name_hash, size_t stream);
+
 private:
 	static std::vector<std::uint32_t> master_seed;
 	static std::unique_ptr<std::mt19937_64> generator;
@@ -98,6 +98,7 @@ private:
 inline void RectMultipole::SetFieldStrength(double b)
 {
 	GetField().SetFieldScale(b);
+	SetModified();
 }
 
 inline double RectMultipole::GetFieldStrength() const
@@ -7,6 +7,7 @@
 
 #include "SMPBunch.h"
 #include "SMPTransform3D.h"
+#include <algorithm>
 #include <fstream>
 #include <iterator>
 
@@ -77,26 +78,73 @@ double SMPBunch::GetTotalCharge() const
 
 PSmoments& SMPBunch::GetMoments(PSmoments& sigma) const
 {
-	sigma.zero();
-	int i, j;
-	for(const_iterator p = begin(); p != end(); p++)
+	// charge weighted sums of x[i] and of x[i]x[j] + <xi xj>, the second
+	// packed by row after the first, in blocks of slices. The blocks are
+	// summed in order, so the result does not depend on the number of threads.
+	const int nsum = 6 + 21;
+	const int block_size = 256;
+	const int n = slices.size();
+	const int nblocks = (n + block_size - 1) / block_size;
+	vector<double> blockSums(nblocks * nsum, 0.0);
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(static) if(nblocks > 1)
+#endif
+	for(int b = 0; b < nblocks; b++)
 	{
-		const SliceMacroParticle& x = (*p);
-		double w = x.Q() / Qt;
-		for(i = 0; i < 6; i++)
+		double* s = &blockSums[b * nsum];
+		const int last = min((b + 1) * block_size, n);
+		for(int k = b * block_size; k < last; k++)
 		{
-			sigma[i] += w * x[i];  // centroid
-			for(j = 0; j <= i; j++) //2nd-order moments
+			const SliceMacroParticle& x = slices[k];
+			const double w = x.Q();
+			double* s2 = s + 6;
+			for(int i = 0; i < 6; i++)
 			{
-				sigma(i, j) += w * (x[i] * x[j] + x(i, j));
+				const double wx = w * x[i];
+				s[i] += wx;
+				for(int j = 0; j <= i; j++)
+				{
+					s2[j] += wx * x[j];
+				}
+				s2 += i + 1;
 			}
+			// the slices only carry the 4x4 moments
+			s2 = s + 6;
+			for(int i = 0; i < 4; i++)
+			{
+				for(int j = 0; j <= i; j++)
+				{
+					s2[j] += w * x(i, j);
+				}
+				s2 += i + 1;
+			}
+		}
+	}
+
+	double sum[nsum] = {0};
+	for(int b = 0; b < nblocks; b++)
+	{
+		for(int k = 0; k < nsum; k++)
+		{
+			sum[k] += blockSums[b * nsum + k];
 		}
 	}
-	for(i = 0; i < 6; i++)
-		for(j = 0; j <= i; j++)
+
+	sigma.zero();
+	for(int i = 0; i < 6; i++)
+	{
+		sigma[i] = sum[i] / Qt;
+	}
+	const double* s2 = sum + 6;
+	for(int i = 0; i < 6; i++)
+	{
+		for(int j = 0; j <= i; j++)
 		{
-			sigma(i, j) -= sigma[i] * sigma[j];
+			sigma(i, j) = s2[j] / Qt - sigma[i] * sigma[j];
 		}
+		s2 += i + 1;
+	}
 
 	return sigma;
 }
@@ -133,6 +133,10 @@ public:
 	{
 		return slices.size();
 	}
+	virtual size_t GetParticleCount() const
+	{
+		return slices.size();
+	}
 	SliceMacroParticle& Get(size_t i)
 	{
 		return slices[i];
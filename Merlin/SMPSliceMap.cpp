@@ -0,0 +1,31 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "SMPSliceMap.h"
+
+namespace SMPTracking
+{
+
+SliceMap::SliceMap() :
+	pRatio(1.0)
+{
+	for(int i = 0; i < 6; i++)
+	{
+		for(int j = 0; j < 6; j++)
+		{
+			R[i][j] = i == j ? 1.0 : 0.0;
+		}
+	}
+}
+
+SliceMap::SliceMap(const RMap& M, double p_ratio) :
+	pRatio(p_ratio)
+{
+	M.ToArray(R);
+}
+
+} // end namespace SMPTracking
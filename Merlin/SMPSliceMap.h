@@ -0,0 +1,120 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef SMPSliceMap_h
+#define SMPSliceMap_h 1
+
+#include "merlin_config.h"
+#include "RMap.h"
+#include "SMPBunch.h"
+
+namespace SMPTracking
+{
+
+/**
+ * A linear map for the slices of an SMPBunch, held as a dense 6x6 matrix
+ * of fixed size.
+ *
+ * The centroid of a slice is mapped by the full matrix, and its 4x4
+ * second-order moments by S -> R.S.R', as RMap::Apply() does for a
+ * TPSMoments<2>. With the size fixed at compile time the loops are
+ * unrolled and vectorised, rather than going through every pair of
+ * sparse terms.
+ */
+class SliceMap
+{
+public:
+	/// The identity map
+	SliceMap();
+
+	/**
+	 * Map with the terms of M. If p_ratio is not one, the momentum of
+	 * each slice is scaled by it while the map is applied, as for a
+	 * magnet whose matched momentum is not the reference momentum.
+	 */
+	explicit SliceMap(const RMap& M, double p_ratio = 1.0);
+
+	void Apply(SliceMacroParticle& p) const;
+
+	double R[6][6];
+	double pRatio;
+};
+
+/**
+ * Applies m.Apply() to every slice of the bunch, with the slices spread
+ * across threads when OpenMP is enabled. Each slice must be mapped
+ * independently of the others.
+ */
+template<class M>
+void ApplyToSlices(const M& m, SMPBunch& bunch)
+{
+	const int n = bunch.Size();
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(static) if(n >= 64)
+#endif
+	for(int i = 0; i < n; i++)
+	{
+		m.Apply(bunch.Get(i));
+	}
+}
+
+inline void SliceMap::Apply(SliceMacroParticle& p) const
+{
+	const double dp = p.dp();
+	if(pRatio != 1.0)
+	{
+		p.dp() = pRatio * (1 + dp) - 1;
+	}
+
+	double x[6];
+	for(int i = 0; i < 6; i++)
+	{
+		double xi = 0;
+		for(int j = 0; j < 6; j++)
+		{
+			xi += R[i][j] * p[j];
+		}
+		x[i] = xi;
+	}
+	for(int i = 0; i < 6; i++)
+	{
+		p[i] = x[i];
+	}
+
+	// T = R.S, then the lower triangle of T.R'
+	double S[4][4], T[4][4];
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j <= i; j++)
+		{
+			S[i][j] = S[j][i] = p(i, j);
+		}
+	}
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			T[i][j] = R[i][0] * S[0][j] + R[i][1] * S[1][j] + R[i][2] * S[2][j] + R[i][3] * S[3][j];
+		}
+	}
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j <= i; j++)
+		{
+			p(i, j) = T[i][0] * R[j][0] + T[i][1] * R[j][1] + T[i][2] * R[j][2] + T[i][3] * R[j][3];
+		}
+	}
+
+	if(pRatio != 1.0)
+	{
+		p.dp() = dp;
+	}
+}
+
+} // end namespace SMPTracking
+
+#endif
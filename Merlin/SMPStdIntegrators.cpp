@@ -6,6 +6,7 @@
  */
 
 #include "SMPStdIntegrators.h"
+#include "SMPSliceMap.h"
 #include "RMap.h"
 #include "TransportRMap.h"
 #include "MerlinIO.h"
@@ -96,12 +97,12 @@ struct ThinLensKick
 		p[ps_YP] += dpp * k0.imag();
 		if(k1 != 0)
 		{
-			double k = dpp * k1;
-			RMap M;
-			MakeIdentity(M);
-			M.AddTerm(2, 1) = k;
-			M.AddTerm(4, 3) = -k;
-			M.Apply(p);
+			const double k = dpp * k1;
+			const R2Map Mx(1, 0, k, 1);
+			const R2Map My(1, 0, -k, 1);
+			ApplyR2Map(Mx, p, 0);
+			ApplyR2Map(My, p, 1);
+			ApplyR2Map(Mx, p, My);
 		}
 	}
 
@@ -122,7 +123,7 @@ struct ApplySolenoid
 	{
 		RMap M;
 		TransportRMap::Solenoid(ds, k / (1 + p.dp()), 0, true, true, M);
-		M.Apply(p);
+		SliceMap(M).Apply(p);
 	}
 
 	double ds;
@@ -187,12 +188,11 @@ struct ApplyTWRFEdgeField
 
 	void Apply(SliceMacroParticle& x) const
 	{
-		double a = -0.5 * Ez * cos(phi0 - k * x.ct()) / (1 + x.dp());
-		RMap M;
-		MakeIdentity(M);
-		M.AddTerm(2, 1) = a;
-		M.AddTerm(4, 3) = a;
-		M.Apply(x);
+		const double a = -0.5 * Ez * cos(phi0 - k * x.ct()) / (1 + x.dp());
+		const R2Map M(1, 0, a, 1);
+		ApplyR2Map(M, x, 0);
+		ApplyR2Map(M, x, 1);
+		ApplyR2Map(M, x, M);
 	}
 
 };
@@ -201,12 +201,12 @@ void RotateBunchAboutZ(SMPBunch& b, double phi)
 {
 	RMap M;
 	TransportRMap::Srot(phi, M);
-	ApplyMap(M, b);
+	ApplyToSlices(SliceMap(M), b);
 }
 
 void ApplyDrift(double s, SMPBunch& bunch)
 {
-	ApplyMap(ApplySimpleDrift(s), bunch);
+	ApplyToSlices(ApplySimpleDrift(s), bunch);
 }
 
 // Error and Warning messages
@@ -261,14 +261,7 @@ void SectorBendCI::TrackStep(double ds)
 
 	RMap M;
 	TransportRMap::SectorBend(ds, h, K1.real(), M);
-	if(!fequal(Pref, P0, 1.0e-6))
-	{
-		ApplyMap(M, *currentBunch, P0, Pref);
-	}
-	else
-	{
-		ApplyMap(M, *currentBunch);
-	}
+	ApplyToSlices(SliceMap(M, fequal(Pref, P0, 1.0e-6) ? 1.0 : P0 / Pref), *currentBunch);
 
 	if(tilt != 0)
 	{
@@ -302,7 +295,7 @@ void SectorBendCI::ApplyPoleFaceRotation(double h, const SectorBend::PoleFace& p
 {
 	RMap M;
 	TransportRMap::PoleFaceRot(h, pf.rot, pf.fint, pf.hgap, M);
-	ApplyMap(M, *currentBunch);
+	ApplyToSlices(SliceMap(M), *currentBunch);
 }
 
 void RectMultipoleCI::TrackStep(double ds)
@@ -361,11 +354,11 @@ void RectMultipoleCI::TrackStep(double ds)
 
 	if(currentComponent->GetLength() == 0 && ds == 0 && !field.IsNullField())
 	{
-		ApplyMap(ThinLensKick(cK0, K1), *currentBunch);
+		ApplyToSlices(ThinLensKick(cK0, K1), *currentBunch);
 	}
 	else
 	{
-		ApplyMap(ThickLens(ds, cK0, K1), *currentBunch);
+		ApplyToSlices(ThickLens(ds, cK0, K1), *currentBunch);
 	}
 
 	if(tilt != 0)
@@ -390,7 +383,7 @@ void SolenoidCI::TrackStep(double ds)
 	}
 	else
 	{
-		ApplyMap(ApplySolenoid(ds, q * Bz / brho), *currentBunch);
+		ApplyToSlices(ApplySolenoid(ds, q * Bz / brho), *currentBunch);
 	}
 	return;
 }
@@ -441,7 +434,7 @@ void TWRFStructureCI::TrackStep(double ds)
 	{
 		double p0 = currentBunch->GetReferenceMomentum();
 		ApplyTWRF cavmap(p0, ds, g, f, phi, AtEntrance(), AtExit(ds));
-		ApplyMap(cavmap, *currentBunch);
+		ApplyToSlices(cavmap, *currentBunch);
 		currentBunch->SetReferenceMomentum(cavmap.E1);
 	}
 	return;
@@ -456,7 +449,7 @@ void TWRFStructureCI::ApplyEndField(double gsgn)
 	double p0 = currentBunch->GetReferenceMomentum();
 	if(g != 0)
 	{
-		ApplyMap(ApplyTWRFEdgeField(p0, g, f, phi), *currentBunch);
+		ApplyToSlices(ApplyTWRFEdgeField(p0, g, f, phi), *currentBunch);
 	}
 }
 
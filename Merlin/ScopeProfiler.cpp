@@ -0,0 +1,433 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "ScopeProfiler.h"
+#include "AcceleratorComponent.h"
+
+#include <algorithm>
+#ifdef __x86_64__
+#include <x86intrin.h>
+#endif
+#include <ctime>
+#include <deque>
+#include <iomanip>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+bool ScopeProfiler::enabled = false;
+
+namespace
+{
+
+typedef ScopeProfiler::ScopeID ScopeID;
+
+inline std::uint64_t MonotonicNanoseconds()
+{
+	timespec t;
+	clock_gettime(CLOCK_MONOTONIC, &t);
+	return static_cast<std::uint64_t>(t.tv_sec) * 1000000000ull + t.tv_nsec;
+}
+
+#ifdef __x86_64__
+inline std::uint64_t ReadClock()
+{
+	return __rdtsc();
+}
+const char* clock_name = "tsc";
+#else
+inline std::uint64_t ReadClock()
+{
+	return MonotonicNanoseconds();
+}
+const char* clock_name = "monotonic";
+#endif
+
+struct ScopeInfo
+{
+	std::string name;
+	ScopeProfiler::ScopeKind kind;
+};
+
+// Function local statics so that scopes can be registered during static
+// initialisation. The deque keeps references from GetScopeName() valid.
+struct ScopeRegistry
+{
+	std::deque<ScopeInfo> scopes;
+	std::unordered_map<std::string, ScopeID> lookup;
+	std::mutex mutex;
+};
+
+ScopeRegistry& GetRegistry()
+{
+	static ScopeRegistry registry;
+	return registry;
+}
+
+struct Node
+{
+	ScopeID scope;
+	std::uint32_t parent;
+	std::uint64_t calls;
+	std::uint64_t particles;
+	std::uint64_t ticks;
+	std::uint64_t child_ticks;
+};
+
+struct Frame
+{
+	std::uint32_t node;
+	std::uint64_t start;
+};
+
+struct ThreadData
+{
+	// node 0 is the root
+	std::vector<Node> nodes{Node{0, 0, 0, 0, 0, 0}};
+	std::unordered_map<std::uint64_t, std::uint32_t> children;
+	std::vector<Frame> stack;
+	std::unordered_map<const AcceleratorComponent*, std::pair<ScopeID, ScopeID> > components;
+	std::uint32_t current = 0;
+};
+
+std::vector<std::unique_ptr<ThreadData> > all_threads;
+std::mutex threads_mutex;
+thread_local ThreadData* this_thread = nullptr;
+
+// clock calibration points
+std::uint64_t calib_ticks = 0;
+std::uint64_t calib_ns = 0;
+
+ThreadData& GetThreadData()
+{
+	if(!this_thread)
+	{
+		std::lock_guard<std::mutex> lock(threads_mutex);
+		all_threads.emplace_back(new ThreadData);
+		this_thread = all_threads.back().get();
+	}
+	return *this_thread;
+}
+
+double SecondsPerTick()
+{
+	std::uint64_t dt = ReadClock() - calib_ticks;
+	std::uint64_t dns = MonotonicNanoseconds() - calib_ns;
+	if(dt == 0 || dns == 0)
+	{
+		return 1e-9;
+	}
+	return 1e-9 * dns / dt;
+}
+
+const char* KindName(ScopeProfiler::ScopeKind kind)
+{
+	switch(kind)
+	{
+	case ScopeProfiler::process_scope:
+		return "process";
+	case ScopeProfiler::element_type_scope:
+		return "element_type";
+	case ScopeProfiler::element_scope:
+		return "element";
+	default:
+		return "user";
+	}
+}
+
+std::string JSONString(const std::string& s)
+{
+	std::string out = "\"";
+	for(char c : s)
+	{
+		if(c == '"' || c == '\\')
+		{
+			out += '\\';
+		}
+		out += c;
+	}
+	return out + "\"";
+}
+
+// per scope totals. Time in a scope that is re-entered further down the
+// stack is only counted once in total_time.
+struct ScopeTotal
+{
+	std::uint64_t calls = 0;
+	std::uint64_t particles = 0;
+	double total_time = 0;
+	double self_time = 0;
+};
+
+std::map<ScopeID, ScopeTotal> SumByScope(const std::vector<ScopeProfiler::Entry>& entries)
+{
+	std::map<ScopeID, ScopeTotal> totals;
+	for(auto& e : entries)
+	{
+		ScopeID id = e.path.back();
+		ScopeTotal& t = totals[id];
+		t.calls += e.calls;
+		t.particles += e.particles;
+		t.self_time += e.self_time;
+		if(std::find(e.path.begin(), e.path.end() - 1, id) == e.path.end() - 1)
+		{
+			t.total_time += e.total_time;
+		}
+	}
+	return totals;
+}
+
+} // end of anonymous namespace
+
+ScopeProfiler::ScopeID ScopeProfiler::RegisterScope(const std::string& name, ScopeKind kind)
+{
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	std::string key = std::to_string(kind) + ':' + name;
+	auto it = reg.lookup.find(key);
+	if(it != reg.lookup.end())
+	{
+		return it->second;
+	}
+	ScopeID id = reg.scopes.size();
+	reg.scopes.push_back(ScopeInfo{name, kind});
+	reg.lookup[key] = id;
+	return id;
+}
+
+const std::string& ScopeProfiler::GetScopeName(ScopeID id)
+{
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	return reg.scopes.at(id).name;
+}
+
+void ScopeProfiler::Enable()
+{
+	if(calib_ticks == 0)
+	{
+		calib_ticks = ReadClock();
+		calib_ns = MonotonicNanoseconds();
+	}
+	enabled = true;
+}
+
+void ScopeProfiler::Disable()
+{
+	enabled = false;
+}
+
+void ScopeProfiler::Reset()
+{
+	std::lock_guard<std::mutex> lock(threads_mutex);
+	for(auto& td : all_threads)
+	{
+		td->nodes.resize(1);
+		td->nodes[0] = Node{0, 0, 0, 0, 0, 0};
+		td->children.clear();
+		td->stack.clear();
+		td->current = 0;
+	}
+}
+
+void ScopeProfiler::DoBegin(ScopeID id)
+{
+	ThreadData& td = GetThreadData();
+	std::uint64_t key = (static_cast<std::uint64_t>(td.current) << 32) | id;
+	auto it = td.children.find(key);
+	std::uint32_t node;
+	if(it == td.children.end())
+	{
+		node = td.nodes.size();
+		td.nodes.push_back(Node{id, td.current, 0, 0, 0, 0});
+		td.children[key] = node;
+	}
+	else
+	{
+		node = it->second;
+	}
+	td.current = node;
+	td.stack.push_back(Frame{node, ReadClock()});
+}
+
+void ScopeProfiler::DoEnd(std::size_t nparticles)
+{
+	std::uint64_t now = ReadClock();
+	ThreadData& td = GetThreadData();
+	if(td.stack.empty())
+	{
+		// scope was entered while the profiler was disabled
+		return;
+	}
+	Frame f = td.stack.back();
+	td.stack.pop_back();
+	std::uint64_t dt = now - f.start;
+	Node& n = td.nodes[f.node];
+	n.calls++;
+	n.particles += nparticles;
+	n.ticks += dt;
+	td.nodes[n.parent].child_ticks += dt;
+	td.current = n.parent;
+}
+
+void ScopeProfiler::DoBeginComponent(const AcceleratorComponent& component)
+{
+	ThreadData& td = GetThreadData();
+	auto it = td.components.find(&component);
+	if(it == td.components.end())
+	{
+		ScopeID type_id = RegisterScope(component.GetType(), element_type_scope);
+		ScopeID elem_id = RegisterScope(component.GetQualifiedName(), element_scope);
+		it = td.components.insert(std::make_pair(&component, std::make_pair(type_id, elem_id))).first;
+	}
+	DoBegin(it->second.first);
+	DoBegin(it->second.second);
+}
+
+std::vector<ScopeProfiler::Entry> ScopeProfiler::GetEntries()
+{
+	const double spt = SecondsPerTick();
+	std::map<std::vector<ScopeID>, Entry> merged;
+
+	std::lock_guard<std::mutex> lock(threads_mutex);
+	for(auto& td : all_threads)
+	{
+		for(std::uint32_t i = 1; i < td->nodes.size(); i++)
+		{
+			std::vector<ScopeID> path;
+			for(std::uint32_t n = i; n != 0; n = td->nodes[n].parent)
+			{
+				path.push_back(td->nodes[n].scope);
+			}
+			std::reverse(path.begin(), path.end());
+
+			const Node& n = td->nodes[i];
+			Entry& e = merged[path];
+			if(e.path.empty())
+			{
+				e = Entry{path, 0, 0, 0, 0};
+			}
+			e.calls += n.calls;
+			e.particles += n.particles;
+			e.total_time += spt * n.ticks;
+			e.self_time += spt * (n.ticks - std::min(n.ticks, n.child_ticks));
+		}
+	}
+
+	std::vector<Entry> entries;
+	entries.reserve(merged.size());
+	for(auto& m : merged)
+	{
+		entries.push_back(m.second);
+	}
+	return entries;
+}
+
+void ScopeProfiler::WriteCSV(std::ostream& os)
+{
+	auto entries = GetEntries();
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	const std::deque<ScopeInfo>& scopes = reg.scopes;
+	os << "path,kind,calls,particles,total_s,self_s,ns_per_particle\n";
+	os << std::setprecision(9);
+	for(auto& e : entries)
+	{
+		std::string path;
+		for(auto id : e.path)
+		{
+			path += (path.empty() ? "" : ";") + scopes[id].name;
+		}
+		os << '"' << path << "\"," << KindName(scopes[e.path.back()].kind) << ',' << e.calls << ',' << e.particles
+		   << ',' << e.total_time << ',' << e.self_time << ',' << (e.particles ? 1e9 * e.total_time / e.particles : 0)
+		   << '\n';
+	}
+}
+
+void ScopeProfiler::WriteJSON(std::ostream& os)
+{
+	auto entries = GetEntries();
+	auto totals = SumByScope(entries);
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	const std::deque<ScopeInfo>& scopes = reg.scopes;
+	os << std::setprecision(9);
+	os << "{\n  \"clock\": \"" << clock_name << "\",\n  \"scopes\": [";
+	bool first = true;
+	for(auto& t : totals)
+	{
+		os << (first ? "\n" : ",\n");
+		first = false;
+		os << "    {\"name\": " << JSONString(scopes[t.first].name) << ", \"kind\": \"" << KindName(
+			scopes[t.first].kind) << "\", \"calls\": " << t.second.calls << ", \"particles\": " << t.second.particles
+		   << ", \"total_s\": " << t.second.total_time << ", \"self_s\": " << t.second.self_time << "}";
+	}
+	os << "\n  ],\n  \"tree\": [";
+	first = true;
+	for(auto& e : entries)
+	{
+		os << (first ? "\n" : ",\n");
+		first = false;
+		os << "    {\"path\": [";
+		for(size_t i = 0; i < e.path.size(); i++)
+		{
+			os << (i ? ", " : "") << JSONString(scopes[e.path[i]].name);
+		}
+		os << "], \"calls\": " << e.calls << ", \"particles\": " << e.particles << ", \"total_s\": " << e.total_time
+		   << ", \"self_s\": " << e.self_time << "}";
+	}
+	os << "\n  ]\n}\n";
+}
+
+void ScopeProfiler::WriteFoldedStacks(std::ostream& os)
+{
+	auto entries = GetEntries();
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	const std::deque<ScopeInfo>& scopes = reg.scopes;
+	for(auto& e : entries)
+	{
+		std::uint64_t us = e.self_time * 1e6 + 0.5;
+		if(us == 0)
+		{
+			continue;
+		}
+		std::string path;
+		for(auto id : e.path)
+		{
+			std::string name = scopes[id].name;
+			std::replace(name.begin(), name.end(), ';', '_');
+			std::replace(name.begin(), name.end(), ' ', '_');
+			path += (path.empty() ? "" : ";") + name;
+		}
+		os << path << ' ' << us << '\n';
+	}
+}
+
+void ScopeProfiler::WriteSummary(std::ostream& os)
+{
+	auto totals = SumByScope(GetEntries());
+	std::vector<std::pair<ScopeID, ScopeTotal> > sorted(totals.begin(), totals.end());
+	std::sort(sorted.begin(), sorted.end(), [](const std::pair<ScopeID, ScopeTotal>& a, const std::pair<ScopeID,
+		ScopeTotal>& b){
+		return a.second.total_time > b.second.total_time;
+	});
+
+	ScopeRegistry& reg = GetRegistry();
+	std::lock_guard<std::mutex> lock(reg.mutex);
+	const std::deque<ScopeInfo>& scopes = reg.scopes;
+	os << std::left << std::setw(40) << "SCOPE" << std::setw(14) << "KIND" << std::setw(12) << "CALLS"
+	   << std::setw(14) << "TOTAL (s)" << std::setw(14) << "SELF (s)" << "ns/particle" << std::endl;
+	for(auto& s : sorted)
+	{
+		const ScopeTotal& t = s.second;
+		os << std::left << std::setw(40) << scopes[s.first].name << std::setw(14) << KindName(scopes[s.first].kind)
+		   << std::setw(12) << t.calls << std::setw(14) << t.total_time << std::setw(14) << t.self_time
+		   << (t.particles ? 1e9 * t.total_time / t.particles : 0) << std::endl;
+	}
+}
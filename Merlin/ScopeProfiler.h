@@ -0,0 +1,179 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef ScopeProfiler_h
+#define ScopeProfiler_h 1
+
+#include "merlin_config.h"
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class AcceleratorComponent;
+
+/**
+ * Low overhead hierarchical profiler.
+ *
+ * Scopes are registered once by name and afterwards referred to by an
+ * integer ScopeID. Timing uses the CPU time stamp counter where available
+ * (calibrated against CLOCK_MONOTONIC) and CLOCK_MONOTONIC otherwise.
+ * Each thread accumulates into its own call tree, so no locking is needed
+ * while profiling. Results are merged when they are written out.
+ *
+ * ProcessStepManager records a scope per element type, per element
+ * instance and per process, together with the number of particles
+ * processed, so a run breaks down as
+ *
+ *     SectorBend -> SectorBend.MB.A8R1.B1 -> TRANSPORT
+ *
+ * Profiling is disabled by default. When disabled, Begin() and End() only
+ * test a flag.
+ *
+ *     ScopeProfiler::Enable();
+ *     tracker.Track(bunch);
+ *     ScopeProfiler::WriteCSV(csv_file);
+ *     ScopeProfiler::WriteFoldedStacks(flame_file); // for flamegraph.pl
+ */
+class ScopeProfiler
+{
+public:
+	typedef std::uint32_t ScopeID;
+
+	/// Kind of scope, used to group the output
+	enum ScopeKind
+	{
+		user_scope,
+		process_scope,
+		element_type_scope,
+		element_scope
+	};
+
+	ScopeProfiler() = delete;
+
+	/**
+	 * Register a scope and return its id. Registering an existing name and
+	 * kind returns the existing id.
+	 */
+	static ScopeID RegisterScope(const std::string& name, ScopeKind kind = user_scope);
+
+	/// Name of a registered scope
+	static const std::string& GetScopeName(ScopeID id);
+
+	/// Start collecting profile data
+	static void Enable();
+
+	/// Stop collecting profile data. Collected data is kept.
+	static void Disable();
+
+	static bool IsEnabled()
+	{
+		return enabled;
+	}
+
+	/// Discard all collected data. Registered scopes are kept.
+	static void Reset();
+
+	/// Enter a scope on the calling thread
+	static void Begin(ScopeID id)
+	{
+		if(enabled)
+		{
+			DoBegin(id);
+		}
+	}
+
+	/**
+	 * Leave the innermost scope on the calling thread, recording
+	 * nparticles as the number of particles it processed.
+	 */
+	static void End(std::size_t nparticles = 0)
+	{
+		if(enabled)
+		{
+			DoEnd(nparticles);
+		}
+	}
+
+	/**
+	 * Enter the element type and element instance scopes for component.
+	 * The scope ids are cached per component. Leave with two calls to End().
+	 */
+	static void BeginComponent(const AcceleratorComponent& component)
+	{
+		if(enabled)
+		{
+			DoBeginComponent(component);
+		}
+	}
+
+	/// Summary of one node of the merged call tree
+	struct Entry
+	{
+		/// Scope ids from the root to this node
+		std::vector<ScopeID> path;
+		std::uint64_t calls;
+		std::uint64_t particles;
+		/// Time including child scopes (s)
+		double total_time;
+		/// Time excluding child scopes (s)
+		double self_time;
+	};
+
+	/// Merge the per thread data into a list of call tree nodes
+	static std::vector<Entry> GetEntries();
+
+	/**
+	 * Write one line per call tree node:
+	 * path,kind,calls,particles,total_s,self_s,ns_per_particle
+	 */
+	static void WriteCSV(std::ostream& os);
+
+	/// Write the call tree and per scope totals as JSON
+	static void WriteJSON(std::ostream& os);
+
+	/**
+	 * Write folded stacks, "a;b;c self_time_us", as read by flamegraph.pl
+	 * and compatible viewers.
+	 */
+	static void WriteFoldedStacks(std::ostream& os);
+
+	/// Write a short table of time per scope, summed over the call tree
+	static void WriteSummary(std::ostream& os);
+
+private:
+	static bool enabled;
+
+	static void DoBegin(ScopeID id);
+	static void DoEnd(std::size_t nparticles);
+	static void DoBeginComponent(const AcceleratorComponent& component);
+};
+
+/**
+ * Enter a profiler scope for the lifetime of the object.
+ */
+class ProfileScope
+{
+public:
+	explicit ProfileScope(ScopeProfiler::ScopeID id, std::size_t np = 0) :
+		nparticles(np)
+	{
+		ScopeProfiler::Begin(id);
+	}
+	~ProfileScope()
+	{
+		ScopeProfiler::End(nparticles);
+	}
+	void SetParticles(std::size_t np)
+	{
+		nparticles = np;
+	}
+private:
+	std::size_t nparticles;
+};
+
+#endif
@@ -76,11 +76,13 @@ ModelElement* SectorBend::Copy() const
 void SectorBend::SetPoleFaceInfo(PoleFace* entr, PoleFace* exit)
 {
 	pfInfo.SetInfo(entr, exit);
+	SetModified();
 }
 
 void SectorBend::SetPoleFaceInfo(PoleFace* pf)
 {
 	pfInfo.SetInfo(pf);
+	SetModified();
 }
 
 double SectorBend::GetMatchedMomentum(double q) const
@@ -100,4 +102,5 @@ double SectorBend::GetB1() const
 void SectorBend::SetB1(double b1)
 {
 	GetField().SetComponent(1, b1);
+	SetModified();
 }
@@ -212,6 +212,7 @@ public:
 	void SetB0(double By)
 	{
 		GetField().SetFieldScale(By);
+		SetModified();
 	}
 
 	/**
@@ -166,6 +166,7 @@ void SequenceFrame::ConsolidateConstruction()
 
 void SequenceFrame::Invalidate() const
 {
+	SetModified();
 	if(!subFrames.empty())
 	{
 		(subFrames.front())->Invalidate();
@@ -95,6 +95,7 @@ inline double Solenoid::GetBz() const
 inline void Solenoid::SetBz(double B)
 {
 	GetField().SetStrength(B);
+	SetModified();
 }
 
 #endif
@@ -5,6 +5,7 @@
  * This file is derived from software bearing the copyright notice: (c) 2004 Daniel A. Bates (LBNL) -- All Rights Reserved --
  */
 
+#include <algorithm>
 #include "SpinParticleProcess.h"
 #include "SectorBend.h"
 #include "Solenoid.h"
@@ -66,14 +67,14 @@ SpinParticleBunch::SpinParticleBunch(double P0, double Qm) :
 
 size_t SpinParticleBunch::AddParticle(const Particle& p)
 {
-	SpinVector* spin = new SpinVector(0, 0, 1);
-	spinArray.push_back(*spin);
-	return ParticleBunch::AddParticle(p);
+	return AddParticle(p, SpinVector(0, 0, 1));
 }
 
 size_t SpinParticleBunch::AddParticle(const Particle& p, const SpinVector& spin)
 {
-	spinArray.push_back(spin);
+	spinX.push_back(spin.x());
+	spinY.push_back(spin.y());
+	spinZ.push_back(spin.z());
 	return ParticleBunch::AddParticle(p);
 }
 
@@ -84,19 +85,38 @@ void SpinParticleBunch::push_back(const Particle& p)
 
 void SpinParticleBunch::SortByCT()
 {
-	// Not yet fully implemented!
-	// At present, only the list of phase space vectors is sorted;
-	// the correlation with the list of spin vectors is lost.
+	// sort an index, and then put the particles and spins in its order
+	vector<size_t> index(size());
+	for(size_t n = 0; n < index.size(); n++)
+	{
+		index[n] = n;
+	}
+	sort(index.begin(), index.end(), [this](size_t i, size_t j)
+	{
+		return pArray[i].ct() < pArray[j].ct();
+	});
 
-	ParticleBunch::SortByCT();
+	PSvectorArray particles(size());
+	vector<double> sx(size()), sy(size()), sz(size());
+	for(size_t n = 0; n < index.size(); n++)
+	{
+		particles[n] = pArray[index[n]];
+		sx[n] = spinX[index[n]];
+		sy[n] = spinY[index[n]];
+		sz[n] = spinZ[index[n]];
+	}
+	pArray.swap(particles);
+	spinX.swap(sx);
+	spinY.swap(sy);
+	spinZ.swap(sz);
 }
 
 void SpinParticleBunch::Output(std::ostream& os) const
 {
 	int oldp = os.precision(10);
 	ios_base::fmtflags oflg = os.setf(ios::scientific, ios::floatfield);
-	vector<SpinVector>::const_iterator sp = spinArray.begin();
-	for(PSvectorArray::const_iterator p = begin(); p != end(); p++, sp++)
+	size_t n = 0;
+	for(PSvectorArray::const_iterator p = begin(); p != end(); p++, n++)
 	{
 		os << std::setw(24) << GetReferenceTime();
 		os << std::setw(24) << GetReferenceMomentum();
@@ -104,9 +124,9 @@ void SpinParticleBunch::Output(std::ostream& os) const
 		{
 			os << std::setw(20) << (*p)[k];
 		}
-		os << std::setw(20) << sp->x();
-		os << std::setw(20) << sp->y();
-		os << std::setw(20) << sp->z();
+		os << std::setw(20) << spinX[n];
+		os << std::setw(20) << spinY[n];
+		os << std::setw(20) << spinZ[n];
 		os << endl;
 	}
 	os.precision(oldp);
@@ -117,33 +137,89 @@ SpinVector SpinParticleBunch::GetAverageSpin() const
 {
 	SpinVector pa(0, 0, 0);
 
-	for(vector<SpinVector>::const_iterator sp = spinArray.begin(); sp != spinArray.end(); sp++)
+	for(size_t n = 0; n < spinX.size(); n++)
 	{
-		pa.x() += sp->x();
-		pa.y() += sp->y();
-		pa.z() += sp->z();
+		pa.x() += spinX[n];
+		pa.y() += spinY[n];
+		pa.z() += spinZ[n];
 	}
-	pa.x() /= spinArray.size();
-	pa.y() /= spinArray.size();
-	pa.z() /= spinArray.size();
+	pa.x() /= spinX.size();
+	pa.y() /= spinX.size();
+	pa.z() /= spinX.size();
 
 	return pa;
 }
 
+SpinVector SpinParticleBunch::GetSpin(size_t n) const
+{
+	return SpinVector(spinX[n], spinY[n], spinZ[n]);
+}
+
+void SpinParticleBunch::SetSpin(size_t n, const SpinVector& spin)
+{
+	spinX[n] = spin.x();
+	spinY[n] = spin.y();
+	spinZ[n] = spin.z();
+}
+
 ParticleBunch::iterator SpinParticleBunch::erase(ParticleBunch::iterator p)
 {
-	// find the 'offset' of p from the start of the particle bunch
+	// remove the spin at the same offset as p
 	size_t n = distance(pArray.begin(), p);
-
-	// remove the n-th spin vector
-	SpinVectorArray::iterator it = spinArray.begin();
-	advance(it, n);
-	spinArray.erase(it);
+	spinX.erase(spinX.begin() + n);
+	spinY.erase(spinY.begin() + n);
+	spinZ.erase(spinZ.begin() + n);
 
 	// called the base function to remove the PSvector
 	return ParticleBunch::erase(p);
 }
 
+void SpinParticleBunch::RemoveParticles(const std::vector<char>& lost)
+{
+	size_t m = 0;
+	for(size_t n = 0; n < spinX.size(); n++)
+	{
+		if(!lost[n])
+		{
+			spinX[m] = spinX[n];
+			spinY[m] = spinY[n];
+			spinZ[m] = spinZ[n];
+			m++;
+		}
+	}
+	spinX.resize(m);
+	spinY.resize(m);
+	spinZ.resize(m);
+	ParticleBunch::RemoveParticles(lost);
+}
+
+void SpinParticleBunch::clear()
+{
+	spinX.clear();
+	spinY.clear();
+	spinZ.clear();
+	ParticleBunch::clear();
+}
+
+void SpinParticleBunch::swap(ParticleBunch& newbunch)
+{
+	SpinParticleBunch* spinbunch = dynamic_cast<SpinParticleBunch*>(&newbunch);
+	if(spinbunch)
+	{
+		spinX.swap(spinbunch->spinX);
+		spinY.swap(spinbunch->spinY);
+		spinZ.swap(spinbunch->spinZ);
+	}
+	else
+	{
+		// the same default spin as AddParticle()
+		spinX.assign(newbunch.size(), 0);
+		spinY.assign(newbunch.size(), 0);
+		spinZ.assign(newbunch.size(), 1);
+	}
+	ParticleBunch::swap(newbunch);
+}
+
 /**
  * Apply transformation to the particle coordinates and apply
  * the required spin vector rotations
@@ -159,30 +235,20 @@ bool SpinParticleBunch::ApplyTransformation(const Transform3D& t)
 	if(!t.R().isIdentity())
 	{
 		const Rotation3D& R(t.R());
-		for(vector<SpinVector>::iterator sp = spinArray.begin(); sp != spinArray.end(); sp++)
+		for(size_t n = 0; n < spinX.size(); n++)
 		{
-			Vector3D S(sp->x(), sp->y(), sp->z());
+			Vector3D S(spinX[n], spinY[n], spinZ[n]);
 			S = R(S);
-			sp->x() = S.x;
-			sp->y() = S.y;
-			sp->z() = S.z;
+			spinX[n] = S.x;
+			spinY[n] = S.y;
+			spinZ[n] = S.z;
 		}
 	}
 	return true;
 }
 
-vector<SpinVector>::iterator SpinParticleBunch::beginSpinArray()
-{
-	return spinArray.begin();
-}
-
-vector<SpinVector>::iterator SpinParticleBunch::endSpinArray()
-{
-	return spinArray.end();
-}
-
 SpinParticleProcess::SpinParticleProcess(int prio, int nstep) :
-	ParticleBunchProcess("SPIN TRACKING PROCESS", prio), ns(nstep), pspin(0)
+	ParticleBunchProcess("SPIN TRACKING PROCESS", prio), ns(nstep), spinbunch(nullptr), pspin(0), uniformField(false)
 {
 }
 
@@ -205,7 +271,7 @@ void SpinParticleProcess::SetCurrentComponent(AcceleratorComponent& component)
 	solnd = dynamic_cast<Solenoid*>(&component);
 
 	//Determine if the present bunch has any spin information
-	SpinParticleBunch* spinbunch = dynamic_cast<SpinParticleBunch*>(currentBunch);
+	spinbunch = dynamic_cast<SpinParticleBunch*>(currentBunch);
 
 	if(currentField && spinbunch)
 	{
@@ -215,176 +281,173 @@ void SpinParticleProcess::SetCurrentComponent(AcceleratorComponent& component)
 	{
 		active = false;
 	}
-}
-
-struct RotateSpinVector
-{
-private:
-	bool isBend;
 
-public:
-	RotateSpinVector(bool bend) :
-		isBend(bend)
+	// the body field of a pure dipole or a solenoid is the same everywhere
+	uniformField = solnd || (sbend && sbend->GetField().HighestMultipole() == 0);
+	if(active && uniformField)
 	{
+		bodyField = currentField->GetBFieldAt(Point3D(0, 0, 0));
 	}
+}
 
-	void RotateSpin(const Vector3D& bnorm, double ds, SpinVector& spin, double gamma)
-	{
-		double& spinx = spin.x();
-		double& spiny = spin.y();
-		double& spinz = spin.z();
-
-		Vector3D w;
-		if(isBend)     // Arc geometry
-		{
-			w.x = -(1 + ElectronGe * gamma) * bnorm.x;
-			w.y = -(ElectronGe * gamma) * bnorm.y;
-			w.z = -(1 + ElectronGe) * bnorm.z;
-		}
-		else        // Rectangular geometry
-		{
-			w.x = -(1 + ElectronGe * gamma) * bnorm.x;
-			w.y = -(1 + ElectronGe * gamma) * bnorm.y;
-			w.z = -(1 + ElectronGe) * bnorm.z;
-		}
-
-		// Calculate Cross Products
-		double pX_crossproduct = w.y * spinz - w.z * spiny;
-		double pY_crossproduct = w.z * spinx - w.x * spinz;
-		double pZ_crossproduct = w.x * spiny - w.y * spinx;
-
-		// Calculate Scalar Product
-		double scalarproduct = w.z * spinz + w.y * spiny + w.x * spinx;
-
-		// Calculate and apply spin rotation
-		double w2 = w.x * w.x + w.y * w.y + w.z * w.z;
-		double omega = sqrt(w2);
-
-		double dt = ds / SpeedOfLight;
-		double cosOmegaT = cos(dt * omega);
-		double sinOmegaT = sin(dt * omega);
-
-		double pX = spinx * cosOmegaT + w.x * scalarproduct * (1 - cosOmegaT) / w2 + pX_crossproduct * sinOmegaT
-			/ omega;
-		double pY = spiny * cosOmegaT + w.y * scalarproduct * (1 - cosOmegaT) / w2 + pY_crossproduct * sinOmegaT
-			/ omega;
-		double pZ = spinz * cosOmegaT + w.z * scalarproduct * (1 - cosOmegaT) / w2 + pZ_crossproduct * sinOmegaT
-			/ omega;
+namespace
+{
 
-		spinx = pX;
-		spiny = pY;
-		spinz = pZ;
-	}
+/**
+ * Rotates the spin (sx, sy, sz) of a particle with the given gamma for a distance ds through the field b, which is
+ * normalised by the rigidity of the particle. Bends have arc geometry, and other components rectangular.
+ */
+inline void RotateSpin(bool isBend, double gamma, double bx, double by, double bz, double ds, double& sx, double& sy,
+	double& sz)
+{
+	const double wx = -(1 + ElectronGe * gamma) * bx;
+	const double wy = isBend ? -(ElectronGe * gamma) * by : -(1 + ElectronGe * gamma) * by;
+	const double wz = -(1 + ElectronGe) * bz;
+
+	// Calculate Cross Products
+	const double pX_crossproduct = wy * sz - wz * sy;
+	const double pY_crossproduct = wz * sx - wx * sz;
+	const double pZ_crossproduct = wx * sy - wy * sx;
+
+	// Calculate Scalar Product
+	const double scalarproduct = wz * sz + wy * sy + wx * sx;
+
+	// Calculate and apply spin rotation; there is none without a field
+	const double w2 = wx * wx + wy * wy + wz * wz;
+	const double omega = w2 > 0 ? sqrt(w2) : 1;
+	const double angle = w2 > 0 ? ds / SpeedOfLight * omega : 0;
+	const double cosOmegaT = cos(angle);
+	const double sinOmegaT = sin(angle);
+	const double c1 = w2 > 0 ? scalarproduct * (1 - cosOmegaT) / w2 : 0;
+
+	const double pX = sx * cosOmegaT + wx * c1 + pX_crossproduct * sinOmegaT / omega;
+	const double pY = sy * cosOmegaT + wy * c1 + pY_crossproduct * sinOmegaT / omega;
+	const double pZ = sz * cosOmegaT + wz * c1 + pZ_crossproduct * sinOmegaT / omega;
+
+	sx = pX;
+	sy = pY;
+	sz = pZ;
+}
 
-};
+} // end of anonymous namespace
 
 void SpinParticleProcess::SetSpinMomentum(double p_spin)
 {
 	pspin = p_spin;
 }
 
-void SpinParticleProcess::DoProcess(double ds)
+void SpinParticleProcess::RotateSpins(double ds)
 {
-	double P0 = currentBunch->GetReferenceMomentum();
-	double brho = P0 / eV / SpeedOfLight;
-	bool isBend = sbend ? true : false;
-	bool isSolenoid = solnd ? true : false;
-
-	if(pspin != 0)
+	const double brho = currentBunch->GetReferenceMomentum() / eV / SpeedOfLight;
+	const double P0 = pspin != 0 ? pspin : currentBunch->GetReferenceMomentum();
+	const bool isBend = sbend != nullptr;
+
+	const Particle* p = currentBunch->GetParticles().data();
+	double* sx = spinbunch->GetSpinX().data();
+	double* sy = spinbunch->GetSpinY().data();
+	double* sz = spinbunch->GetSpinZ().data();
+	const double* fx = bx.data();
+	const double* fy = by.data();
+	const double* fz = bz.data();
+	const long n = currentBunch->size();
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for simd
+#endif
+	for(long i = 0; i < n; i++)
 	{
-		P0 = pspin;
+		const double norm = SpeedOfLight / brho / (1.0 + p[i].dp());
+		const double gamma = P0 * (1.0 + p[i].dp()) / (ElectronMassMeV * MeV);
+		RotateSpin(isBend, gamma, fx[i] * norm, fy[i] * norm, fz[i] * norm, ds, sx[i], sy[i], sz[i]);
 	}
+}
 
-	RotateSpinVector rot(isBend);
-
-	Vector3D b;
-
-	SpinParticleBunch* spinbunch = dynamic_cast<SpinParticleBunch*>(currentBunch);
-	SpinVectorArray::iterator spin = spinbunch->beginSpinArray();
-	for(PSvectorArray::iterator p = spinbunch->begin(); p != spinbunch->end(); p++, spin++)
+void SpinParticleProcess::DoProcess(double ds)
+{
+	// The field for each particle is found first, and then all the spins are rotated together
+	const PSvectorArray& particles = currentBunch->GetParticles();
+	const size_t n = particles.size();
+	bx.resize(n);
+	by.resize(n);
+	bz.resize(n);
+
+	if(intS == 0)
 	{
-		double norm = SpeedOfLight / brho / (1.0 + p->dp());
-		double gamma = P0 * (1.0 + p->dp()) / (ElectronMassMeV * MeV);
-
-		if(intS == 0)
+		// Apply spin rotation from dipole entrance fringe field
+		if(sbend)
 		{
-
-			// Apply spin rotation from dipole entrance fringe field
-			if(isBend)
+			SectorBend::PoleFace* pf = sbend->GetPoleFaceInfo().entrance;
+			double theta = pf ? pf->rot : 0;
+			const double s = sin(theta) * 0.5 * sbend->GetB0();
+			const double c = cos(theta) * 0.5 * sbend->GetB0();
+			for(size_t i = 0; i < n; i++)
 			{
-				SectorBend::PoleFace* pf = sbend->GetPoleFaceInfo().entrance;
-				double theta = pf ? pf->rot : 0;
-				double intbz = 0.5 * sbend->GetB0() * p->y() * norm;
-				b.x = sin(theta) * intbz;
-				b.y = 0;
-				b.z = cos(theta) * intbz;
-				if(b.x != 0 || b.z != 0)
-				{
-					rot.RotateSpin(b, 1.0, *spin, gamma);
-				}
+				bx[i] = s * particles[i].y();
+				by[i] = 0;
+				bz[i] = c * particles[i].y();
 			}
+			RotateSpins(1.0);
+		}
 
-			// Apply spin rotation from solenoid entrance fringe field
-			// We use a hard-edged model for the fringe field;
-			// a positive value for the solenoid field means the field
-			// is pointing in the direction of the beam.
-			if(isSolenoid)
+		// Apply spin rotation from solenoid entrance fringe field
+		// We use a hard-edged model for the fringe field;
+		// a positive value for the solenoid field means the field
+		// is pointing in the direction of the beam.
+		if(solnd)
+		{
+			const double Bz = solnd->GetBz();
+			for(size_t i = 0; i < n; i++)
 			{
-				double bz = solnd->GetBz();
-				b.x = -bz*p->x();
-				b.y = -bz*p->y();
-				b.z = 0.0;
-				if(b.x != 0 || b.y != 0)
-				{
-					rot.RotateSpin(b, 1.0, *spin, gamma);
-				}
+				bx[i] = -Bz * particles[i].x();
+				by[i] = -Bz * particles[i].y();
+				bz[i] = 0;
 			}
+			RotateSpins(1.0);
 		}
+	}
 
-		// Apply spin rotation from body of magnet
-		b = currentField->GetBFieldAt(Point3D(p->x(), p->y(), 0));
-
-		if(b.x != 0 || b.y != 0 || b.z != 0)
-		{
-			b.x *= norm;
-			b.y *= norm;
-			b.z *= norm;
-			rot.RotateSpin(b, ds, *spin, gamma);
-		}
+	// Apply spin rotation from body of magnet
+	for(size_t i = 0; i < n; i++)
+	{
+		const Vector3D b = uniformField ? bodyField : currentField->GetBFieldAt(Point3D(particles[i].x(),
+			particles[i].y(), 0));
+		bx[i] = b.x;
+		by[i] = b.y;
+		bz[i] = b.z;
+	}
+	RotateSpins(ds);
 
-		if(fequal(intS + ds, clength))
+	if(fequal(intS + ds, clength))
+	{
+		// Apply spin rotation from dipole exit fringe field
+		if(sbend)
 		{
-
-			// Apply spin rotation from dipole exit fringe field
-			if(isBend)
+			SectorBend::PoleFace* pf = sbend->GetPoleFaceInfo().exit;
+			double theta = pf ? pf->rot : 0;
+			const double s = sin(theta) * 0.5 * sbend->GetB0();
+			const double c = cos(theta) * 0.5 * sbend->GetB0();
+			for(size_t i = 0; i < n; i++)
 			{
-				SectorBend::PoleFace* pf = sbend->GetPoleFaceInfo().exit;
-				double theta = pf ? pf->rot : 0;
-				double intbz = 0.5 * sbend->GetB0() * p->y() * norm;
-				b.x = sin(theta) * intbz;
-				b.y = 0;
-				b.z = -cos(theta) * intbz;
-				if(b.x != 0 || b.z != 0)
-				{
-					rot.RotateSpin(b, 1.0, *spin, gamma);
-				}
+				bx[i] = s * particles[i].y();
+				by[i] = 0;
+				bz[i] = -c * particles[i].y();
 			}
+			RotateSpins(1.0);
+		}
 
-			// Apply spin rotation from solenoid exit fringe field
-			// We use a hard-edged model for the fringe field
-			if(isSolenoid)
+		// Apply spin rotation from solenoid exit fringe field
+		// We use a hard-edged model for the fringe field
+		if(solnd)
+		{
+			const double Bz = solnd->GetBz();
+			for(size_t i = 0; i < n; i++)
 			{
-				double bz = solnd->GetBz();
-				b.x = bz * p->x();
-				b.y = bz * p->y();
-				b.z = 0.0;
-				if(b.x != 0 || b.y != 0)
-				{
-					rot.RotateSpin(b, 1.0, *spin, gamma);
-				}
+				bx[i] = Bz * particles[i].x();
+				by[i] = Bz * particles[i].y();
+				bz[i] = 0;
 			}
+			RotateSpins(1.0);
 		}
-
 	}
 
 	intS += ds;
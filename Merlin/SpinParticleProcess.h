@@ -32,23 +32,53 @@ private:
 
 typedef vector<SpinVector> SpinVectorArray;
 
+/**
+ *	A ParticleBunch with a spin vector for each particle. The
+ *	spins are held as separate arrays of their x, y and z
+ *	components in the order of the particles, and are kept in
+ *	step by AddParticle(), erase(), RemoveParticles(), clear(),
+ *	swap() and SortByCT().
+ */
 class SpinParticleBunch: public ParticleBunch
 {
 public:
 	SpinParticleBunch(double P0, double Qm = 1);
 	virtual ParticleBunch::iterator erase(ParticleBunch::iterator p);
+	virtual void RemoveParticles(const std::vector<char>& lost);
+	virtual void clear();
+
+	/// Swaps the spins too if newbunch is a SpinParticleBunch, otherwise its particles get the default spin
+	virtual void swap(ParticleBunch& newbunch);
 	virtual size_t AddParticle(const Particle& p);
 	size_t AddParticle(const Particle& p, const SpinVector& spin);
 	virtual void push_back(const Particle& p);
 	virtual void SortByCT();
-	SpinVectorArray::iterator beginSpinArray();
-	SpinVectorArray::iterator endSpinArray();
 	virtual void Output(std::ostream& os) const;
 	SpinVector GetAverageSpin() const;
 	virtual bool ApplyTransformation(const Transform3D& t);
 
+	/// Spin of particle n
+	SpinVector GetSpin(size_t n) const;
+	void SetSpin(size_t n, const SpinVector& spin);
+
+	/// Spin components of all the particles
+	std::vector<double>& GetSpinX()
+	{
+		return spinX;
+	}
+	std::vector<double>& GetSpinY()
+	{
+		return spinY;
+	}
+	std::vector<double>& GetSpinZ()
+	{
+		return spinZ;
+	}
+
 private:
-	SpinVectorArray spinArray;
+	std::vector<double> spinX;
+	std::vector<double> spinY;
+	std::vector<double> spinZ;
 };
 
 class SpinParticleProcess: public ParticleBunchProcess
@@ -91,8 +121,18 @@ private:
 	const SectorBend* sbend;
 	const Solenoid* solnd;
 	const EMField* currentField;
+	SpinParticleBunch* spinbunch;
 	double clength;
 	double pspin;
+
+	// body field, when it is the same for every particle (sector bends with only a dipole field, and solenoids)
+	bool uniformField;
+	Vector3D bodyField;
+
+	// field for each particle in the current step
+	std::vector<double> bx, by, bz;
+
+	void RotateSpins(double ds);
 };
 
 #endif
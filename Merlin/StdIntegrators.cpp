@@ -14,6 +14,7 @@
 #include "StdIntegrators.h"
 #include "LCAVintegrator.h"
 #include "TransRFIntegrator.h"
+#include "LinearMapTracker.h"
 
 using namespace std;
 using namespace PhysicalConstants;
@@ -379,6 +380,14 @@ void SWRFStructureCI::TrackStep(double ds)
 // Class MonitorCI
 void MonitorCI::TrackStep(double ds)
 {
+	// the step is a linear drift, however it is split by the measurement
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(*currentBunch))
+	{
+		RealMatrix J = IdentityMatrix(6);
+		J(0, 1) = J(2, 3) = ds;
+		lm->Concatenate(J);
+		lm->linearised = true;
+	}
 
 	double len = currentComponent->GetLength();
 	if(len == 0)
@@ -442,6 +451,7 @@ void SolenoidCI::TrackStep(double ds)
 
 void MarkerCI::TrackStep(double)
 {
+	LinearMapBunch::MarkLinearised(*currentBunch);
 	return;
 }
 
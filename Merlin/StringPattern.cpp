@@ -116,6 +116,20 @@ bool StringPattern::Match(const std::string& s) const
 	return n == s.length() || wcterm.second;
 }
 
+bool StringPattern::IsLiteral() const
+{
+	return orpatterns.empty() && isLiteral;
+}
+
+std::string StringPattern::LiteralPrefix() const
+{
+	if(!orpatterns.empty() || patterns.empty() || wcterm.first)
+	{
+		return std::string();
+	}
+	return patterns[0];
+}
+
 ostream& operator <<(ostream& os, const StringPattern& pattern)
 {
 	if(pattern.wcterm.first)
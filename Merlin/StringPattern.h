@@ -45,6 +45,19 @@ public:
 	 */
 	bool operator ()(const std::string& s) const;
 
+	/**
+	 *	Returns true if the pattern has no wild cards or OR
+	 *	terms, so only matches itself.
+	 */
+	bool IsLiteral() const;
+
+	/**
+	 *	Returns the literal text that any matching string must
+	 *	start with. This is empty if the pattern starts with a
+	 *	wild card or contains OR terms.
+	 */
+	std::string LiteralPrefix() const;
+
 	/**
 	 *	Outputs to os the original pattern.
 	 */
@@ -7,6 +7,8 @@
 
 #include <cmath>
 #include <algorithm>
+#include <random>
+#include <vector>
 #include "utils.h"
 
 #include "SynchRadParticleProcess.h"
@@ -58,16 +60,29 @@ struct ApplySR
 		return meanU / n;
 	}
 
-	void operator()(PSvector& v)
+	// Returns the critical photon energy of particle v, and the field at v in B
+	double CriticalEnergy(const PSvector& v, double& B) const
 	{
-		double B = abs(Bf.GetField2D(v.x(), v.y()));
+		B = abs(Bf.GetField2D(v.x(), v.y()));
 		double g = P0 * (1 + v.dp()) / ParticleMassMeV;
-		double uc = PHOTCONST1 * B * g * g;
+		return PHOTCONST1 * B * g * g;
+	}
+
+	// Mean number of photons emitted by the particle
+	double MeanPhotons(double B) const
+	{
+		return (PHOTCONST2 * 15. * sqrt(3.) / 8.) * B * dL;
+	}
+
+	void operator()(PSvector& v)
+	{
+		double B;
+		double uc = CriticalEnergy(v, B);
 		double u = 0;
 
 		if(photgen)
 		{
-			int nphot = static_cast<int>(RandomNG::poisson((PHOTCONST2 * 15. * sqrt(3.) / 8.) * B * dL));
+			int nphot = static_cast<int>(RandomNG::poisson(MeanPhotons(B)));
 			for(int n = 0; n < nphot; n++)
 			{
 				u += photgen(uc);
@@ -79,7 +94,40 @@ struct ApplySR
 		}
 
 		meanU += u;
+		Radiate(v, u);
+		n++;
+	}
 
+	// As operator(), but with the photons drawn from gen and the tabulated spectrum. Returns the energy lost.
+	double operator()(PSvector& v, std::mt19937_64& gen) const
+	{
+		double B;
+		double uc = CriticalEnergy(v, B);
+		double u = 0;
+
+		if(photgen)
+		{
+			const SynchRadSpectrumTable& spectrum = SynchRadSpectrumTable::Get();
+			std::poisson_distribution<int> poisson(MeanPhotons(B));
+			std::uniform_real_distribution<double> uniform(0.0, 1.0);
+			int nphot = poisson(gen);
+			for(int n = 0; n < nphot; n++)
+			{
+				u += uc * spectrum.Sample(uniform(gen));
+			}
+		}
+		else
+		{
+			u = PHOTCONST2 * B * dL * uc;
+		}
+
+		Radiate(v, u);
+		return u;
+	}
+
+	// Removes the energy u from the particle
+	void Radiate(PSvector& v, double u) const
+	{
 		double& px = v.xp();
 		double& py = v.yp();
 		double& dp = v.dp();
@@ -105,10 +153,45 @@ struct ApplySR
 			px /= (1.0 + u / P0);
 			py /= (1.0 + u / P0);
 		}
-		n++;
 	}
 
 };
+
+/**
+ * Applies sr to the particles in blocks, in parallel with OpenMP, and returns the mean energy loss. The photons of each
+ * block are drawn from their own random number stream, from a key drawn for each step and the block number, and the
+ * energy loss is summed block by block, so the result does not depend on the number of threads.
+ */
+double ApplySRToBunch(PSvectorArray& particles, const ApplySR& sr)
+{
+	const size_t block_size = 1024;
+	const size_t np = particles.size();
+	const long nblocks = (np + block_size - 1) / block_size;
+	const size_t stream_hash = hash_string("SynchRadParticleProcess");
+	const size_t key = sr.photgen ? RandomNG::getGenerator()() : 0;
+	std::vector<double> blockU(nblocks, 0);
+
+#ifdef ENABLE_OPENMP
+	#pragma omp parallel for schedule(static)
+#endif
+	for(long b = 0; b < nblocks; b++)
+	{
+		std::mt19937_64 gen = sr.photgen ? RandomNG::getStreamGenerator(stream_hash, key + b) : std::mt19937_64();
+		const size_t last = std::min((b + 1) * block_size, np);
+		for(size_t i = b * block_size; i < last; i++)
+		{
+			blockU[b] += sr(particles[i], gen);
+		}
+	}
+
+	double sumU = 0;
+	for(double u : blockU)
+	{
+		sumU += u;
+	}
+	return sumU / np;
+}
+
 } // end of anonymous namespace
 
 // Class SynchRadParticleProcess
@@ -170,11 +253,17 @@ void SynchRadParticleProcess::DoProcess(double ds)
 	if(fequal(intS += ds, (nk1 + 1) * dL))
 	{
 		double E0 = currentBunch->GetReferenceMomentum();
-		double meanU = for_each(
-			currentBunch->begin(),
-			currentBunch->end(),
-			ApplySR(*currentField, dL, E0, sympVars, PHOTCONST1, PHOTCONST2, ParticleMassMeV,
-			quantum)).MeanEnergyLoss();
+		ApplySR sr(*currentField, dL, E0, sympVars, PHOTCONST1, PHOTCONST2, ParticleMassMeV, quantum);
+		double meanU;
+		if(quantum == TabulatedSpectrumGen)
+		{
+			meanU = ApplySRToBunch(currentBunch->GetParticles(), sr);
+		}
+		else
+		{
+			// the other photon generators share random number generators, so are applied serially
+			meanU = for_each(currentBunch->begin(), currentBunch->end(), sr).MeanEnergyLoss();
+		}
 
 		// Finally we adjust the reference of the
 		// bunch to reflect the mean energy loss
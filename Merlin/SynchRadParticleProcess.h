@@ -10,6 +10,7 @@
 
 #include "merlin_config.h"
 
+#include <vector>
 #include "ParticleBunchProcess.h"
 #include "MultipoleField.h"
 
@@ -27,6 +28,45 @@ double HBSpectrumGen(double u);
  */
 double AWSpectrumGen(double u);
 
+/**
+ * Generator sampling the tabulated spectrum of SynchRadSpectrumTable.
+ * When it is selected, SynchRadParticleProcess draws from the same
+ * table in parallel, with a random number stream for each block of
+ * particles.
+ */
+double TabulatedSpectrumGen(double u);
+
+/**
+ *	Inverse cumulative distribution of the photon number spectrum
+ *	of synchrotron radiation, the integral of K_5/3 from x to
+ *	infinity, with x the photon energy in units of the critical
+ *	energy. The table is built once on first use. Sample() only
+ *	reads it, so it can be called from several threads.
+ */
+class SynchRadSpectrumTable
+{
+public:
+	/// Returns the table, building it on the first call
+	static const SynchRadSpectrumTable& Get();
+
+	/// Returns the photon energy in units of the critical energy for u uniform in [0,1)
+	double Sample(double u) const;
+
+	/// Returns the integral of the spectrum over all photon energies (5 pi / 3)
+	double Total() const
+	{
+		return total;
+	}
+
+private:
+	SynchRadSpectrumTable();
+
+	// photon energies and the fraction of the photons below each
+	std::vector<double> x;
+	std::vector<double> F;
+	double total;
+};
+
 /**
  *	Models the effects of synchrotron radiation in dipoles
  *	and (optionally) quadrupoles. The default behaviour is
@@ -35,7 +75,15 @@ double AWSpectrumGen(double u);
  *	random photon generation. The photon spectrum used can
  *	be changed by a call to SetPhotonGenerator(double
  *	(*)(double u)). The default spectrum (dipole radiation)
- *	has been provided by H. Burkhardt (CERN-LEP-Note 632).
+ *	is HBSpectrumGen (H. Burkhardt, CERN-LEP-Note 632), with
+ *	AWSpectrumGen and TabulatedSpectrumGen as alternatives.
+ *
+ *	With TabulatedSpectrumGen the particles are processed in
+ *	blocks, in parallel when OpenMP is enabled. The photons of
+ *	each block are drawn from their own random number stream,
+ *	so the result does not depend on the number of threads.
+ *	The other generators draw from shared random number
+ *	generators and are applied serially.
  *
  *	The number of equally spaced steps to take through a
  *	component can be specified (default = 1). The effect of
@@ -24,10 +24,41 @@ TrackingOutputAV::TrackingOutputAV(const std::string& filename) :
 
 TrackingOutputAV::~TrackingOutputAV()
 {
+	// finish writing before the file is closed
+	writer.reset();
 	output_file->close();
 	delete output_file;
 }
 
+namespace
+{
+
+void WriteTracks(std::ostream& os, PSvectorArray::const_iterator first, PSvectorArray::const_iterator last, unsigned int
+	turn_number, double zComponent, bool suppress_unscattered)
+{
+	for(PSvectorArray::const_iterator pb = first; pb != last; pb++)
+	{
+		if((suppress_unscattered && pb->type() != -1) || (!suppress_unscattered))
+		{
+			os << int(pb->id()) << " "
+			   << turn_number << " "
+			   << std::fixed
+			   << zComponent << " "
+			   << std::scientific
+			   << pb->x() * 1e3  << " "
+			   << pb->xp() * 1e3  << " "
+			   << pb->y() * 1e3  << " "
+			   << pb->yp() * 1e3  << " "
+			   << pb->dp()  << " "
+			   << std::fixed
+			   << int(pb->type()) <<  " "
+			   << int(pb->id())  << "\n";
+		}
+	}
+}
+
+} // end anonymous namespace
+
 void TrackingOutputAV::Record(const ComponentFrame* frame, const Bunch* bunch)
 {
 
@@ -69,31 +100,34 @@ void TrackingOutputAV::Record(const ComponentFrame* frame, const Bunch* bunch)
 		return;
 	}
 
-	string id = (*frame).GetComponent().GetQualifiedName();
 	double zComponent = frame->GetPosition() + frame->GetGeometryLength() / 2;
 
 	const ParticleBunch* PB = static_cast<const ParticleBunch*>(bunch);
-	for(ParticleBunch::const_iterator pb = PB->begin(); pb != PB->end(); pb++)
+	if(writer)
 	{
-		if((suppress_unscattered && pb->type() != -1) || (!suppress_unscattered))
+		// copy the particles to be written, and format them in the background
+		AsyncOutput::Buffer& b = writer->Acquire();
+		b.particles.clear();
+		for(ParticleBunch::const_iterator pb = PB->begin(); pb != PB->end(); pb++)
 		{
-			(*output_file) << int(pb->id()) << " "
-						   << turn_number << " "
-						   << std::fixed
-						   << zComponent << " "
-			    //<< id << " "
-						   << std::scientific
-						   << pb->x() * 1e3  << " "
-						   << pb->xp() * 1e3  << " "
-						   << pb->y() * 1e3  << " "
-						   << pb->yp() * 1e3  << " "
-						   << pb->dp()  << " "
-						   << std::fixed
-						   << int(pb->type()) <<  " "
-						   << int(pb->id())  << endl;
+			if((suppress_unscattered && pb->type() != -1) || (!suppress_unscattered))
+			{
+				b.particles.push_back(*pb);
+			}
 		}
+		b.turn = turn_number;
+		b.s = zComponent;
+		std::ofstream* os = output_file;
+		b.write = [os](const AsyncOutput::Buffer& b)
+		{
+			WriteTracks(*os, b.particles.begin(), b.particles.end(), b.turn, b.s, false);
+		};
+		writer->Submit(b);
+	}
+	else
+	{
+		WriteTracks(*output_file, PB->begin(), PB->end(), turn_number, zComponent, suppress_unscattered);
 	}
-
 }
 
 void TrackingOutputAV::RecordInitialBunch(const Bunch* bunch)
@@ -103,6 +137,24 @@ void TrackingOutputAV::RecordFinalBunch(const Bunch* bunch)
 {
 }
 
+void TrackingOutputAV::SetAsync(size_t nbuffers)
+{
+	writer.reset();
+	if(nbuffers)
+	{
+		writer.reset(new AsyncOutput(nbuffers));
+	}
+}
+
+void TrackingOutputAV::Flush()
+{
+	if(writer)
+	{
+		writer->Flush();
+	}
+	output_file->flush();
+}
+
 void TrackingOutputAV::SuppressUnscattered(const bool s)
 {
 	suppress_unscattered = s;
@@ -9,6 +9,8 @@
 #define _h_TrackingOutputAV
 #include "TrackingSimulation.h"
 #include <fstream>
+#include <memory>
+#include "AsyncOutput.h"
 
 class TrackingOutputAV: public SimulationOutput
 {
@@ -51,6 +53,14 @@ public:
 		single_turn = 0;
 	}
 
+	/**
+	 * Write the output in the background, with up to nbuffers snapshots
+	 * waiting to be written. Zero writes synchronously (the default).
+	 */
+	void SetAsync(size_t nbuffers);
+
+	void Flush();
+
 protected:
 	void Record(const ComponentFrame* frame, const Bunch* bunch);
 	void RecordInitialBunch(const Bunch* bunch);
@@ -74,6 +84,7 @@ private:
 	unsigned int start_turn;
 	unsigned int end_turn;
 
+	std::unique_ptr<AsyncOutput> writer;
 };
 
 #endif
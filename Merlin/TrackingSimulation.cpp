@@ -177,6 +177,7 @@ Bunch& TrackingSimulation::DoRun(bool new_bunch, bool do_init)
 	if(simOp)
 	{
 		simOp->DoRecordFinalBunch(bunch);
+		simOp->Flush();
 	}
 
 	return *bunch;
@@ -321,14 +322,10 @@ void SimulationOutput::AddIdentifier(const string& pattern, size_t nocc)
 
 void SimulationOutput::DoRecord(const ComponentFrame* frame, const Bunch* bunch)
 {
-	if(frame->IsComponent())
+	// the qualified name is only needed when there is a pattern to match
+	if(frame->IsComponent() && (output_all || IsMember((*frame).GetComponent().GetQualifiedName())))
 	{
-		string id = (*frame).GetComponent().GetQualifiedName();
-
-		if(output_all || IsMember(id))
-		{
-			Record(frame, bunch);
-		}
+		Record(frame, bunch);
 	}
 }
 
@@ -35,6 +35,15 @@ public:
 	// Output control
 	void AddIdentifier(const std::string& pattern, size_t nocc = 1);
 
+	/**
+	 * Wait for any output still being written in the background.
+	 * Called by TrackingSimulation at the end of Run() and Continue().
+	 * Outputs that write synchronously have nothing to do.
+	 */
+	virtual void Flush()
+	{
+	}
+
 	// Public output flags
 	bool output_all;
 	bool output_initial;
@@ -0,0 +1,154 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cmath>
+#include "ClosedOrbit.h"
+#include "ComponentFrame.h"
+#include "LinearMapTracker.h"
+#include "MerlinException.h"
+#include "NumericalConstants.h"
+#include "TLASimp.h"
+#include "TransferMapTable.h"
+
+using namespace ParticleTracking;
+
+namespace
+{
+
+// Phase advance from the start to each row, unwrapped to increase through the lattice
+void FillPhase(const std::vector<RealMatrix>& maps, int i, std::vector<double>& mu)
+{
+	double beta, alpha;
+	TransferMapTable::OneTurnTwiss(maps.back(), i, beta, alpha);
+
+	mu.resize(maps.size());
+	double total = 0;
+	double last = 0;
+	for(size_t n = 0; n < maps.size(); n++)
+	{
+		const RealMatrix& C = maps[n];
+		const double phi = atan2(C(i, i + 1), beta * C(i, i) - alpha * C(i, i + 1));
+		total += remainder(phi - last, twoPi);
+		last = phi;
+		mu[n] = total / twoPi;
+	}
+}
+
+} // end of anonymous namespace
+
+TransferMapTable::TransferMapTable(AcceleratorModel* aModel, double refMomentum) :
+	theModel(aModel), p0(refMomentum), delta(1.0e-8), bendscale(0), valid(false)
+{
+}
+
+void TransferMapTable::OneTurnTwiss(const RealMatrix& M, int i, double& beta, double& alpha)
+{
+	const double c = (M(i, i) + M(i + 1, i + 1)) / 2;
+	if(fabs(c) >= 1)
+	{
+		throw MerlinException("TransferMapTable: unstable transverse motion");
+	}
+	const double s = M(i, i + 1) < 0 ? -sqrt(1 - c * c) : sqrt(1 - c * c);
+	beta = M(i, i + 1) / s;
+	alpha = (M(i, i) - M(i + 1, i + 1)) / (2 * s);
+}
+
+void TransferMapTable::SetDelta(double new_delta)
+{
+	delta = new_delta;
+	valid = false;
+}
+
+void TransferMapTable::ScaleBendPathLength(double scale)
+{
+	bendscale = scale;
+	valid = false;
+}
+
+void TransferMapTable::Invalidate()
+{
+	valid = false;
+}
+
+void TransferMapTable::Calculate()
+{
+	PSvector orbit(0);
+	ClosedOrbit co(theModel, p0);
+	co.SetDelta(delta);
+	co.TransverseOnly(false);
+	co.ScaleBendPathLength(bendscale);
+	co.FindClosedOrbit(orbit);
+
+	orbits.clear();
+	maps.clear();
+	orbits.push_back(orbit);
+	maps.push_back(IdentityMatrix(6));
+
+	LinearMapTracker lmt(p0);
+	lmt.SetDelta(delta);
+	lmt.ScaleBendPathLength(bendscale);
+	lmt.SetObserver([this](ComponentFrame*, const PSvector& x, const RealMatrix& J) {
+		orbits.push_back(x);
+		maps.push_back(J * maps.back());
+	});
+	RealMatrix M(6, 6);
+	lmt.Track(theModel->GetBeamline(), orbit, M);
+
+	FillPhase(maps, 0, mux);
+	FillPhase(maps, 2, muy);
+	valid = true;
+}
+
+void TransferMapTable::Check()
+{
+	if(!valid)
+	{
+		Calculate();
+	}
+}
+
+size_t TransferMapTable::NumberOfRows()
+{
+	Check();
+	return maps.size();
+}
+
+const PSvector& TransferMapTable::GetOrbit(size_t n)
+{
+	Check();
+	return orbits.at(n);
+}
+
+const RealMatrix& TransferMapTable::GetMap(size_t n)
+{
+	Check();
+	return maps.at(n);
+}
+
+RealMatrix TransferMapTable::MapBetween(size_t n1, size_t n2)
+{
+	Check();
+	RealMatrix M1inv = maps.at(n1);
+	Invert(M1inv);
+	if(n2 < n1)
+	{
+		return maps.at(n2) * maps.back() * M1inv;
+	}
+	return maps.at(n2) * M1inv;
+}
+
+double TransferMapTable::GetPhaseAdvance(size_t n, bool horizontal)
+{
+	Check();
+	return horizontal ? mux.at(n) : muy.at(n);
+}
+
+double TransferMapTable::GetTune(bool horizontal)
+{
+	Check();
+	return horizontal ? mux.back() : muy.back();
+}
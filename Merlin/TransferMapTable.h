@@ -0,0 +1,95 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef TransferMapTable_h
+#define TransferMapTable_h 1
+
+#include "merlin_config.h"
+#include <vector>
+#include "AcceleratorModel.h"
+#include "PSTypes.h"
+#include "TLAS.h"
+
+using namespace TLAS;
+
+/**
+ *	Cached linear optics of a ring about its closed orbit.
+ *
+ *	The closed orbit is found once, and the cumulative transfer
+ *	map from the start of the lattice and the phase advance in
+ *	each plane are stored at every row. Row n is at the entrance
+ *	of element n (the same rows as a LatticeFunctionTable), and
+ *	the last row is at the end of the ring, so that GetMap() of
+ *	that row is the one turn map. The map between any two rows
+ *	is then a product of two stored matrices.
+ *
+ *	Phase advances are found from the uncoupled Twiss parameters
+ *	of the one turn map, and are in units of 2 pi.
+ *
+ *	The table is calculated on first use. Call Invalidate() after
+ *	changing the model.
+ */
+class TransferMapTable
+{
+public:
+	TransferMapTable(AcceleratorModel* aModel, double refMomentum);
+
+	void SetDelta(double new_delta);
+	void ScaleBendPathLength(double scale);
+
+	/// Discards the table, which is recalculated when next used
+	void Invalidate();
+
+	/**
+	 *	Finds the closed orbit and fills the table. Throws
+	 *	MerlinException if the transverse motion is unstable.
+	 */
+	void Calculate();
+
+	/// Number of rows, one more than the number of elements
+	size_t NumberOfRows();
+
+	/// Closed orbit at row n
+	const PSvector& GetOrbit(size_t n);
+
+	/// Map from the start of the lattice to row n
+	const RealMatrix& GetMap(size_t n);
+
+	/**
+	 *	Map from row n1 to row n2. If n2 < n1 the map continues
+	 *	past the end of the ring to row n2 on the next turn.
+	 */
+	RealMatrix MapBetween(size_t n1, size_t n2);
+
+	/// Phase advance from the start of the lattice to row n
+	double GetPhaseAdvance(size_t n, bool horizontal);
+
+	/// Tune, the phase advance at the last row
+	double GetTune(bool horizontal);
+
+	/**
+	 *	Twiss parameters of the uncoupled one turn map M in the plane
+	 *	(i, i+1). Throws MerlinException if the motion is unstable.
+	 */
+	static void OneTurnTwiss(const RealMatrix& M, int i, double& beta, double& alpha);
+
+private:
+	void Check();
+
+	AcceleratorModel* theModel;
+	double p0;
+	double delta;
+	double bendscale;
+	bool valid;
+
+	std::vector<PSvector> orbits;
+	std::vector<RealMatrix> maps;
+	std::vector<double> mux;
+	std::vector<double> muy;
+};
+
+#endif
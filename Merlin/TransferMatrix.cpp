@@ -12,11 +12,13 @@
 #include "ClosedOrbit.h"
 #include "TransferMatrix.h"
 #include "MatrixPrinter.h"
+#include "LinearMapTracker.h"
 
 using namespace ParticleTracking;
 
 TransferMatrix::TransferMatrix(AcceleratorModel* aModel, double refMomentum) :
-	theModel(aModel), p0(refMomentum), radiation(false), obspnt(0), delta(1.0e-9), bendscale(0)
+	theModel(aModel), p0(refMomentum), radiation(false), obspnt(0), delta(1.0e-9), bendscale(0),
+	mapConcatenation(false)
 {
 }
 
@@ -56,6 +58,11 @@ void TransferMatrix::ScaleBendPathLength(double scale)
 	bendscale = scale;
 }
 
+void TransferMatrix::UseMapConcatenation(bool flag)
+{
+	mapConcatenation = flag;
+}
+
 void TransferMatrix::FindTM(RealMatrix& M)
 {
 	PSvector p(0);
@@ -105,6 +112,15 @@ void TransferMatrix::FindClosedOrbitTM(RealMatrix& M, PSvector& orbit)
 
 void TransferMatrix::FindTM(RealMatrix& M, PSvector& orbit)
 {
+	if(mapConcatenation && !radiation)
+	{
+		PSvector x = orbit;
+		LinearMapTracker lmt(p0);
+		lmt.ScaleBendPathLength(bendscale);
+		lmt.Track(theModel->GetRing(obspnt), x, M);
+		return;
+	}
+
 	ParticleBunch bunch(p0, 1.0);
 	int k = 0;
 	for(k = 0; k < 7; k++)
@@ -165,6 +181,15 @@ void TransferMatrix::FindTM(RealMatrix& M, PSvector& orbit)
 
 void TransferMatrix::FindTM(RealMatrix& M, PSvector& orbit, int n1, int n2)
 {
+	if(mapConcatenation && !radiation)
+	{
+		PSvector x = orbit;
+		LinearMapTracker lmt(p0);
+		lmt.ScaleBendPathLength(bendscale);
+		lmt.Track(theModel->GetBeamline(n1, n2), x, M);
+		return;
+	}
+
 	ParticleBunch bunch(p0, 1.0);
 	int k = 0;
 	for(k = 0; k < 7; k++)
@@ -32,6 +32,15 @@ public:
 	void SetObservationPoint(int n);
 	void SetDelta(double new_delta);
 
+	/**
+	 *	When set and radiation is off, FindTM() finds the matrix as
+	 *	the product of the linear maps of each element about the
+	 *	orbit (see LinearMapTracker), instead of by tracking a finite
+	 *	difference bunch. Off by default; linear_map_test compares
+	 *	the two methods.
+	 */
+	void UseMapConcatenation(bool flag);
+
 private:
 	AcceleratorModel* theModel;
 	double p0;
@@ -43,6 +52,7 @@ private:
 	double radstepsize;
 	int radnumsteps;
 	double bendscale;
+	bool mapConcatenation;
 
 };
 
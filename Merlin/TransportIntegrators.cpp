@@ -13,6 +13,7 @@
 #include "PhysicalUnits.h"
 #include "PhysicalConstants.h"
 #include "TransRFIntegrator.h"
+#include "LinearMapTracker.h"
 
 using namespace PhysicalConstants;
 using namespace PhysicalUnits;
@@ -159,8 +160,59 @@ struct ApplyRFMap
 
 };
 
+// The functions below which act on the whole bunch also update the
+// map carried by a LinearMapBunch, using the Jacobian of each step
+// taken about the first particle before the step is applied.
+
+// Jacobian of the thin kick from field, as applied by MultipoleKick
+void KickJacobian(const MultipoleKick& kick, const PSvector& v, RealMatrix& J)
+{
+	const MultipoleField& field = kick.field;
+	const Complex z0(v.x(), v.y());
+	const double dp1 = 1 + v.dp();
+	Complex dB(0);
+	if(!field.IsNullField())
+	{
+		Complex z(1);
+		for(int n = 1; n <= field.HighestMultipole(); n++)
+		{
+			dB += static_cast<double>(n) * field.GetCoefficient(n) * z;
+			z *= z0;
+		}
+		dB *= field.GetFieldScale();
+	}
+	const Complex F = kick.scale * field.GetField2D(v.x(), v.y()) / dp1;
+	const Complex G = kick.scale * dB / dp1;
+
+	J = IdentityMatrix(6);
+	J(1, 0) = -G.real();
+	J(1, 2) = G.imag();
+	J(1, 5) = F.real() / dp1;
+	J(3, 0) = G.imag();
+	J(3, 2) = G.real();
+	J(3, 5) = -F.imag() / dp1;
+}
+
+inline void ApplyKickToBunch(ParticleBunch& bunch, MultipoleKick kick)
+{
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(bunch))
+	{
+		RealMatrix J(6, 6);
+		KickJacobian(kick, lm->FirstParticle(), J);
+		lm->Concatenate(J);
+	}
+	for_each(bunch.begin(), bunch.end(), kick);
+}
+
 inline void ApplyMapToBunch(ParticleBunch& bunch, RTMap* amap)
 {
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(bunch))
+	{
+		RealMatrix J(6, 6);
+		amap->Jacobian(lm->FirstParticle(), J);
+		lm->Concatenate(J);
+	}
+
 //Old method (and now MPI)
 #ifndef ENABLE_OPENMP
 	for_each(bunch.begin(), bunch.end(), ApplyMap(amap));
@@ -178,11 +230,34 @@ inline void ApplyMapToBunch(ParticleBunch& bunch, RTMap* amap)
 
 inline void ApplyMapToBunch(ParticleBunch& bunch, RTMap* amap, double Er)
 {
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(bunch))
+	{
+		// dp is scaled to the matched momentum before the map, and restored after it
+		PSvector x = lm->FirstParticle();
+		x.dp() = Er * (1 + x.dp()) - 1;
+		RealMatrix J(6, 6);
+		amap->Jacobian(x, J);
+		for(int i = 0; i < 6; i++)
+		{
+			J(i, 5) *= Er;
+			J(5, i) = i == 5 ? 1 : 0;
+		}
+		lm->Concatenate(J);
+	}
 	for_each(bunch.begin(), bunch.end(), ApplyMap1(amap, Er));
 }
 
 inline void ApplyDriftToBunch(ParticleBunch& bunch, double len)
 {
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(bunch))
+	{
+		const PSvector& p = lm->FirstParticle();
+		RealMatrix J = IdentityMatrix(6);
+		J(0, 1) = J(2, 3) = len;
+		J(4, 1) = -len * p.xp();
+		J(4, 3) = -len * p.yp();
+		lm->Concatenate(J);
+	}
 	for_each(bunch.begin(), bunch.end(), ApplyDrift(len));
 }
 
@@ -190,6 +265,18 @@ void RotateBunchAboutZ(ParticleBunch& bunch, double phi)
 {
 	RMtrx M(2);
 	TransportMatrix::Srot(phi, M.R);
+	if(LinearMapBunch* lm = LinearMapBunch::Cast(bunch))
+	{
+		RealMatrix J = IdentityMatrix(6);
+		for(int i = 0; i < 4; i++)
+		{
+			for(int j = 0; j < 4; j++)
+			{
+				J(i, j) = M.R(i, j);
+			}
+		}
+		lm->Concatenate(J);
+	}
 	M.Apply(bunch.GetParticles());
 }
 
@@ -209,6 +296,7 @@ namespace TRANSPORT
 
 void DriftCI::TrackStep(double ds)
 {
+	LinearMapBunch::MarkLinearised(*currentBunch);
 	CHK_ZERO(ds);
 	RTMap* m = DriftTM(ds);
 	ApplyMapToBunch(*currentBunch, m);
@@ -218,10 +306,11 @@ void DriftCI::TrackStep(double ds)
 
 void SectorBendCI::TrackStep(double ds)
 {
+	LinearMapBunch::MarkLinearised(*currentBunch);
 	CHK_ZERO(ds);
 
 	double h = (*currentComponent).GetGeometry().GetCurvature();
-	MultipoleField& field = (*currentComponent).GetField();
+	const MultipoleField& field = (*currentComponent).GetField();
 	const double P0 = (*currentBunch).GetReferenceMomentum();
 	const double q = (*currentBunch).GetChargeSign();
 	const double Pref = (*currentComponent).GetMatchedMomentum(q);
@@ -258,14 +347,17 @@ void SectorBendCI::TrackStep(double ds)
 
 		// First we set the real parts of the
 		// dipole and quad fields to zero, since these
-		// components have been modeled in the matrix
-		Complex b1 = field.GetCoefficient(1);
-		field.SetCoefficient(0, Complex(0, b0.imag()));
-		field.SetCoefficient(1, Complex(0, b1.imag()));
+		// components have been modeled in the matrix.
+		// This is done on a copy, so that the component
+		// can be tracked by other threads at the same time
+		MultipoleField kickField(field);
+		const Complex b1 = field.GetCoefficient(1);
+		kickField.SetCoefficient(0, Complex(0, b0.imag()));
+		kickField.SetCoefficient(1, Complex(0, b1.imag()));
 
 		// Apply the integrated kick, and then track
 		// through the linear second half
-		for_each((*currentBunch).begin(), (*currentBunch).end(), MultipoleKick(field, ds, P0, q));
+		ApplyKickToBunch(*currentBunch, MultipoleKick(kickField, ds, P0, q));
 
 		if(fequal(P0, Pref, REL_ENGY_TOL))
 		{
@@ -275,10 +367,6 @@ void SectorBendCI::TrackStep(double ds)
 		{
 			ApplyMapToBunch(*currentBunch, M, P0 / Pref);
 		}
-
-		// Remember to set the components back
-		field.SetCoefficient(0, b0);
-		field.SetCoefficient(1, b1);
 	}
 
 	// must delete the map
@@ -289,6 +377,7 @@ void SectorBendCI::TrackStep(double ds)
 
 void SectorBendCI::TrackEntrance()
 {
+	LinearMapBunch::MarkLinearised(*currentBunch);
 	const SectorBend::PoleFaceInfo& pfi = currentComponent->GetPoleFaceInfo();
 	double tilt = (*currentComponent).GetGeometry().GetTilt();
 	if(tilt != 0)
@@ -336,10 +425,11 @@ void RectMultipoleCI::TrackStep(double ds)
 	// including any dipole term.
 	using namespace TLAS;
 
+	LinearMapBunch::MarkLinearised(*currentBunch);
 	double P0 = (*currentBunch).GetReferenceMomentum();
 	double q = (*currentBunch).GetChargeSign();
 	double brho = P0 / eV / SpeedOfLight;
-	MultipoleField& field = (*currentComponent).GetField();
+	const MultipoleField& field = (*currentComponent).GetField();
 
 	// we now support thin-lens kicks (this has been added to support
 	// thin-lens corrector dipoles)
@@ -347,7 +437,7 @@ void RectMultipoleCI::TrackStep(double ds)
 	if((*currentComponent).GetLength() == 0 && ds == 0 && !field.IsNullField())
 	{
 		// treat field as integrated strength
-		for_each((*currentBunch).begin(), (*currentBunch).end(), MultipoleKick(field, 1.0, P0, q));
+		ApplyKickToBunch(*currentBunch, MultipoleKick(field, 1.0, P0, q));
 		return;
 	}
 
@@ -390,12 +480,12 @@ void RectMultipoleCI::TrackStep(double ds)
 		ApplyMapToBunch(*currentBunch, M);
 		if(splitMagnet)
 		{
-			Complex b1 = field.GetCoefficient(1);
-			field.SetCoefficient(1, Complex(0));
-			for_each((*currentBunch).begin(), (*currentBunch).end(), MultipoleKick(field, ds, P0, q, -phi));
+			// kick from a copy of the field without the quadrupole term, leaving the component unchanged
+			MultipoleField kickField(field);
+			kickField.SetCoefficient(1, Complex(0));
+			ApplyKickToBunch(*currentBunch, MultipoleKick(kickField, ds, P0, q, -phi));
 			// Apply second half of map
 			ApplyMapToBunch(*currentBunch, M);
-			field.SetCoefficient(1, b1);
 		}
 		delete M;
 		if(!fequal(phi, 0))
@@ -427,12 +517,12 @@ void RectMultipoleCI::TrackStep(double ds)
 		ApplyMapToBunch(*currentBunch, M);
 		if(splitMagnet)
 		{
-			Complex b2 = field.GetCoefficient(2);
-			field.SetCoefficient(2, Complex(0));
-			for_each((*currentBunch).begin(), (*currentBunch).end(), MultipoleKick(field, ds, P0, q, -phi));
+			// kick from a copy of the field without the sextupole term, leaving the component unchanged
+			MultipoleField kickField(field);
+			kickField.SetCoefficient(2, Complex(0));
+			ApplyKickToBunch(*currentBunch, MultipoleKick(kickField, ds, P0, q, -phi));
 			// Apply second half of map
 			ApplyMapToBunch(*currentBunch, M);
-			field.SetCoefficient(2, b2);
 		}
 		delete M;
 		if(!fequal(phi, 0))
@@ -445,7 +535,7 @@ void RectMultipoleCI::TrackStep(double ds)
 		ApplyDriftToBunch(*currentBunch, len);
 		if(splitMagnet)
 		{
-			for_each((*currentBunch).begin(), (*currentBunch).end(), MultipoleKick(field, ds, P0, q));
+			ApplyKickToBunch(*currentBunch, MultipoleKick(field, ds, P0, q));
 			// Apply second half of map
 			ApplyDriftToBunch(*currentBunch, len);
 		}
@@ -85,6 +85,7 @@ inline double TransverseRFStructure::GetFieldOrientation() const
 inline void TransverseRFStructure::SetFieldOrientation(double t)
 {
 	static_cast<TransverseRFfield*>(itsField)->SetFieldOrientation(t);
+	SetModified();
 }
 
 #endif
@@ -7,6 +7,7 @@
 
 #include <time.h>
 
+#include <cmath>
 #include <stdexcept>
 #include <sstream>
 #include <iterator>
@@ -84,7 +85,7 @@ namespace ParticleTracking
 {
 
 WakeFieldProcess::WakeFieldProcess(int prio, size_t nb, double ns, string aID) :
-	ParticleBunchProcess(aID, prio), imploc(atExit), nbins(nb), nsig(ns), currentWake(nullptr), Qd(), Qdp(), filter(
+	ParticleBunchProcess(aID, prio), imploc(atExit), nbins(nb), nsig(ns), sliceWidthSteps(0), currentWake(nullptr), Qd(), Qdp(), filter(
 		nullptr), wake_x(0), wake_y(0), wake_z(0), recalc(true), inc_tw(true), oldBunchLen(0)
 {
 	SetFilter(14, 2, 1);
@@ -117,6 +118,12 @@ size_t WakeFieldProcess::CalculateQdist()
 	zmin = -nsig * sigz + z0;
 	zmax = nsig * sigz + z0;
 	dz = (zmax - zmin) / nbins;
+	if(sliceWidthSteps > 0 && dz > 0)
+	{
+		dz = pow(2.0, ceil(log2(dz) * sliceWidthSteps) / sliceWidthSteps);
+		zmin = z0 - 0.5 * nbins * dz;
+		zmax = z0 + 0.5 * nbins * dz;
+	}
 
 	bunchSlices.clear();
 	Qd.clear();
@@ -75,6 +75,13 @@ protected:
 	size_t nbins;
 	double nsig;
 
+	/**
+	 * When nonzero, CalculateQdist() rounds the slice width up to
+	 * one of this many steps in each factor of two, so that small
+	 * changes of the bunch length give the same slices. Default 0
+	 */
+	int sliceWidthSteps;
+
 	void Init();
 	size_t CalculateQdist();
 	virtual void CalculateWakeL();
@@ -0,0 +1,183 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "bench_runner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
+#include "RandomNG.h"
+
+using namespace std;
+
+namespace
+{
+
+typedef std::chrono::steady_clock bench_clock;
+
+double Seconds(bench_clock::time_point t0, bench_clock::time_point t1)
+{
+	return std::chrono::duration<double>(t1 - t0).count();
+}
+
+} // end of anonymous namespace
+
+size_t BenchRunner::Scaled(size_t n) const
+{
+	return std::max<size_t>(1, n * options.scale);
+}
+
+bool BenchRunner::Selected(const string& name) const
+{
+	return options.filter.empty() || name.find(options.filter) != string::npos;
+}
+
+bool BenchRunner::GroupSelected(const string& prefix) const
+{
+	return Selected(prefix) || options.filter.compare(0, prefix.size(), prefix) == 0;
+}
+
+void BenchRunner::Measure(const string& name, double items, const function<void()>& body,
+	const function<void()>& setup, bool single_shot)
+{
+	if(!Selected(name))
+	{
+		return;
+	}
+
+	RandomNG::reset(options.seed);
+
+	size_t iterations = 0;
+	double total = 0;
+	double fastest = 0;
+
+	if(!single_shot)
+	{
+		// warm up
+		if(setup)
+		{
+			setup();
+		}
+		body();
+	}
+
+	do
+	{
+		if(setup)
+		{
+			setup();
+		}
+		auto t0 = bench_clock::now();
+		body();
+		auto t1 = bench_clock::now();
+		double dt = Seconds(t0, t1);
+		fastest = (iterations == 0) ? dt : std::min(fastest, dt);
+		total += dt;
+		iterations++;
+	} while(!single_shot && total < options.min_time);
+
+	BenchResult r{name, iterations, items, fastest, total / iterations};
+	results.push_back(r);
+
+	cout << left << setw(48) << name << right << setw(8) << iterations << setw(14) << setprecision(4) << r.min_time
+		 << " s" << setw(14) << r.NsPerItem() << " ns/item" << endl;
+}
+
+void BenchRunner::Skip(const string& name, const string& reason)
+{
+	if(Selected(name))
+	{
+		cout << left << setw(48) << name << " skipped: " << reason << endl;
+	}
+}
+
+void BenchRunner::WriteCSV(ostream& os) const
+{
+	os << "name,iterations,items,min_s,mean_s,ns_per_item\n";
+	os << setprecision(9);
+	for(auto& r : results)
+	{
+		os << r.name << ',' << r.iterations << ',' << r.items << ',' << r.min_time << ',' << r.mean_time << ','
+		   << r.NsPerItem() << '\n';
+	}
+}
+
+void BenchRunner::WriteJSON(ostream& os) const
+{
+	os << setprecision(9);
+	os << "{\n  \"seed\": " << options.seed << ",\n  \"scale\": " << options.scale << ",\n  \"results\": [";
+	for(size_t i = 0; i < results.size(); i++)
+	{
+		const BenchResult& r = results[i];
+		os << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"iterations\": " << r.iterations
+		   << ", \"items\": " << r.items << ", \"min_s\": " << r.min_time << ", \"mean_s\": " << r.mean_time
+		   << ", \"ns_per_item\": " << r.NsPerItem() << "}";
+	}
+	os << "\n  ]\n}\n";
+}
+
+bool ReadBaselineCSV(const string& filename, map<string, BenchResult>& baseline)
+{
+	baseline.clear();
+	ifstream in(filename);
+	if(!in)
+	{
+		return false;
+	}
+
+	string line;
+	getline(in, line); // header
+	while(getline(in, line))
+	{
+		for(auto& c : line)
+		{
+			if(c == ',')
+			{
+				c = ' ';
+			}
+		}
+		istringstream is(line);
+		BenchResult r;
+		double ns;
+		if(is >> r.name >> r.iterations >> r.items >> r.min_time >> r.mean_time >> ns)
+		{
+			baseline[r.name] = r;
+		}
+	}
+	return !baseline.empty();
+}
+
+size_t CompareToBaseline(const vector<BenchResult>& results, const map<string, BenchResult>& baseline,
+	double tolerance, ostream& os, size_t& missing)
+{
+	size_t regressions = 0;
+	missing = 0;
+	os << endl << left << setw(48) << "BENCHMARK" << right << setw(14) << "BASELINE (s)" << setw(14) << "NOW (s)"
+	   << setw(10) << "RATIO" << endl;
+	for(auto& r : results)
+	{
+		auto b = baseline.find(r.name);
+		if(b == baseline.end() || b->second.min_time <= 0)
+		{
+			missing++;
+			os << left << setw(48) << r.name << right << setw(14) << "-" << setw(14) << setprecision(4) << r.min_time
+			   << setw(10) << "-" << "  MISSING" << endl;
+			continue;
+		}
+		// compare per item, in case the scale differs
+		double ratio = r.NsPerItem() > 0 && b->second.NsPerItem() > 0 ? r.NsPerItem() / b->second.NsPerItem()
+			: r.min_time / b->second.min_time;
+		bool slow = ratio > 1 + tolerance;
+		regressions += slow;
+		os << left << setw(48) << r.name << right << setw(14) << setprecision(4) << b->second.min_time << setw(14)
+		   << r.min_time << setw(10) << ratio << (slow ? "  SLOWER" : "") << endl;
+	}
+	return regressions;
+}
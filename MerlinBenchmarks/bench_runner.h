@@ -0,0 +1,131 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef bench_runner_h
+#define bench_runner_h 1
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * Result of one benchmark measurement
+ */
+struct BenchResult
+{
+	std::string name;
+	size_t iterations;
+	/// Work items (particles, calls, rows...) per iteration
+	double items;
+	/// Fastest and mean wall time per iteration (s)
+	double min_time;
+	double mean_time;
+
+	double NsPerItem() const
+	{
+		return items > 0 ? 1e9 * min_time / items : 0;
+	}
+};
+
+/**
+ * Options shared by all benchmarks
+ */
+struct BenchOptions
+{
+	/// Seed passed to RandomNG before each measurement
+	std::uint32_t seed = 1;
+	/// Minimum time spent repeating each micro benchmark (s)
+	double min_time = 0.5;
+	/// Scale factor on particle numbers and turns, <1 for a quick run
+	double scale = 1.0;
+	/// Only run benchmarks whose name contains this string
+	std::string filter;
+	/// Directory holding the MerlinTests data files
+	std::string data_dir;
+	/// Optional full LHC optics TFS for the LHC macro benchmarks
+	std::string lhc_tfs;
+	/// Run the macro benchmarks
+	bool macro = true;
+	/// Run the micro benchmarks
+	bool micro = true;
+};
+
+/**
+ * Runs and times benchmarks.
+ *
+ * Each benchmark function calls Measure() once per case, passing the
+ * number of work items per iteration and a body to time. The body is run
+ * once to warm up and then repeated until min_time has passed.
+ */
+class BenchRunner
+{
+public:
+	explicit BenchRunner(const BenchOptions& opts) :
+		options(opts)
+	{
+	}
+
+	const BenchOptions& Options() const
+	{
+		return options;
+	}
+
+	/// Scale an integer count by options.scale, with a minimum of 1
+	size_t Scaled(size_t n) const;
+
+	/// True if the named benchmark passes the filter
+	bool Selected(const std::string& name) const;
+
+	/// True if any benchmark named prefix/... could pass the filter
+	bool GroupSelected(const std::string& prefix) const;
+
+	/**
+	 * Time body. setup is run untimed before every iteration. Set
+	 * single_shot for expensive macro benchmarks that are timed once.
+	 */
+	void Measure(const std::string& name, double items, const std::function<void()>& body,
+		const std::function<void()>& setup = nullptr, bool single_shot = false);
+
+	/// Print a note about a skipped benchmark
+	void Skip(const std::string& name, const std::string& reason);
+
+	const std::vector<BenchResult>& Results() const
+	{
+		return results;
+	}
+
+	void WriteCSV(std::ostream& os) const;
+	void WriteJSON(std::ostream& os) const;
+
+private:
+	BenchOptions options;
+	std::vector<BenchResult> results;
+};
+
+/**
+ * Read results previously written by BenchRunner::WriteCSV() into baseline.
+ * Returns false if the file cannot be read or holds no results.
+ */
+bool ReadBaselineCSV(const std::string& filename, std::map<std::string, BenchResult>& baseline);
+
+/**
+ * Compare results against a baseline and print a table. Returns the number
+ * of benchmarks slower than the baseline by more than tolerance (fraction).
+ * missing is set to the number of results with no baseline to compare with.
+ */
+size_t CompareToBaseline(const std::vector<BenchResult>& results, const std::map<std::string, BenchResult>& baseline,
+	double tolerance, std::ostream& os, size_t& missing);
+
+// Benchmark groups
+void RunMicroBenchmarks(BenchRunner& runner);
+void RunMacroBenchmarks(BenchRunner& runner);
+
+#endif
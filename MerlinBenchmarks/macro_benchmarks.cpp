@@ -0,0 +1,359 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cmath>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_runner.h"
+
+#include "AcceleratorModelConstructor.h"
+#include "BeamData.h"
+#include "Aperture.h"
+#include "ApertureConfiguration.h"
+#include "CollimateProtonProcess.h"
+#include "CollimatorAperture.h"
+#include "Components.h"
+#include "HaloParticleDistributionGenerator.h"
+#include "LatticeFunctions.h"
+#include "LossMapCollimationOutput.h"
+#include "MADInterface.h"
+#include "MaterialDatabase.h"
+#include "NumericalConstants.h"
+#include "ParticleBunchTypes.h"
+#include "ParticleDistributionGenerator.h"
+#include "ParticleTracker.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "ScatteringModelsMerlin.h"
+
+/*
+ * Macro benchmarks: whole ring workflows.
+ *
+ * A synthetic LHC sized ring (about 27 km of 85 degree FODO cells with a
+ * primary collimator at the start) is built programmatically, so these run
+ * without any external optics. The same workflows run on the real LHC
+ * lattice when an optics TFS file is given with --lhc, with the loss map
+ * starting at the horizontal primary collimator TCP.C6L7.B1.
+ */
+
+using namespace std;
+using namespace PhysicalUnits;
+
+namespace
+{
+
+const double beam_energy = 7000.0;
+const double norm_emittance = 3.5e-6;
+
+/// Number of sigma of the primary collimator half gap
+const double tcp_nsig = 6.0;
+
+/// Horizontal primary collimator of LHC beam 1
+const char* lhc_tcp = "TCP.C6L7.B1";
+
+/// Magnetic rigidity in T.m for a momentum in GeV/c
+double BRho(double p0)
+{
+	return p0 / 0.299792458;
+}
+
+double GeometricEmittance()
+{
+	double gamma = beam_energy / PhysicalConstants::ProtonMassMeV / PhysicalUnits::MeV;
+	double beta = sqrt(1.0 - 1.0 / (gamma * gamma));
+	return norm_emittance / (gamma * beta);
+}
+
+/**
+ * Ring of FODO cells, each with six dipoles and a sextupole next to each
+ * quadrupole. Every element gets a circular 22 mm aperture, and a primary
+ * collimator sits at the start of the ring.
+ */
+AcceleratorModel* BuildSyntheticRing(size_t ncells, vector<unique_ptr<Aperture> >& apertures)
+{
+	const double brho = BRho(beam_energy);
+	const double lquad = 3.1 * meter;
+	const double lsext = 0.4 * meter;
+	const double lbend = 14.3 * meter;
+	const double lcell = 2 * (lquad + lsext + 3 * lbend + 5 * meter);
+	const double mu = 85 * pi / 180;
+	const double k1 = 4 * sin(mu / 2) / (lcell * lquad);
+	const double angle = twoPi / (6 * ncells);
+	const double h = angle / lbend;
+
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+
+	apertures.emplace_back(ApertureFactory().getInstance("CIRCLE", 0, 0, 0, 22 * millimeter, 0));
+	Aperture* pipe = apertures.back().get();
+	auto append = [&](AcceleratorComponent* c) {
+		c->SetAperture(pipe);
+		ctor.AppendComponent(c);
+	};
+
+	ctor.AppendComponent(new Collimator("TCP", 0.6 * meter));
+
+	for(size_t n = 0; n < ncells; n++)
+	{
+		string cell = to_string(n);
+		for(int half = 0; half < 2; half++)
+		{
+			double sign = half ? -1 : 1;
+			string f = half ? "D." : "F.";
+			append(new Quadrupole("MQ" + f + cell, lquad, sign * k1 * brho));
+			append(new Drift("DQ" + f + cell, 1 * meter));
+			append(new Sextupole("MS" + f + cell, lsext, sign * 0.05 * brho));
+			append(new Drift("DS" + f + cell, 1 * meter));
+			for(int b = 0; b < 3; b++)
+			{
+				string id = "MB" + f + to_string(b) + "." + cell;
+				append(new SectorBend(id, lbend, h, h * brho));
+				append(new Drift("DB" + f + to_string(b) + "." + cell, 1 * meter));
+			}
+		}
+	}
+	return ctor.GetModel();
+}
+
+/// Lattice functions, with the bend path length scaling used for LHC optics
+unique_ptr<LatticeFunctionTable> CalculateLatticeFunctions(AcceleratorModel* model)
+{
+	unique_ptr<LatticeFunctionTable> twiss(new LatticeFunctionTable(model, beam_energy));
+	twiss->AddFunction(1, 6, 3);
+	twiss->AddFunction(2, 6, 3);
+	twiss->AddFunction(3, 6, 3);
+	twiss->AddFunction(4, 6, 3);
+	twiss->AddFunction(6, 6, 3);
+
+	double bscale = 1e-22;
+	while(true)
+	{
+		twiss->ScaleBendPathLength(bscale);
+		twiss->Calculate();
+		if(!std::isnan(twiss->Value(1, 1, 1, 0)) || bscale > 1e-10)
+		{
+			break;
+		}
+		bscale *= 2;
+	}
+	return twiss;
+}
+
+BeamData MatchedBeam(LatticeFunctionTable& twiss, size_t n)
+{
+	BeamData beam;
+	beam.p0 = beam_energy;
+	beam.beta_x = twiss.Value(1, 1, 1, n) * meter;
+	beam.beta_y = twiss.Value(3, 3, 2, n) * meter;
+	beam.alpha_x = -twiss.Value(1, 2, 1, n);
+	beam.alpha_y = -twiss.Value(3, 4, 2, n);
+	beam.emit_x = beam.emit_y = GeometricEmittance() * meter;
+	beam.sig_dp = 1e-4;
+	beam.sig_z = 75 * millimeter;
+	return beam;
+}
+
+/**
+ * Set a carbon primary collimator with its half gap at tcp_nsig beam sigma,
+ * taken from the optics at element n.
+ */
+void SetPrimaryCollimator(Collimator* tcp, LatticeFunctionTable& twiss, size_t n,
+	vector<unique_ptr<Aperture> >& apertures)
+{
+	static MaterialDatabase materials;
+
+	double sigma = sqrt(twiss.Value(1, 1, 1, n) * GeometricEmittance());
+	apertures.emplace_back(new CollimatorAperture(2 * tcp_nsig * sigma * (1 - 1e-4), 0.1, 0, tcp->GetLength(), 0,
+		0));
+	tcp->SetAperture(apertures.back().get());
+	tcp->SetMaterial(materials.FindMaterial("C"));
+}
+
+/**
+ * Workflows shared by the synthetic ring and the LHC. Tracking starts at
+ * element start, and with collimate set the loss map puts a halo on the
+ * primary collimator there.
+ */
+void RingBenchmarks(BenchRunner& runner, const string& prefix, AcceleratorModel* model, bool collimate,
+	size_t start = 0)
+{
+	unique_ptr<LatticeFunctionTable> twiss;
+	AcceleratorModel::Beamline beamline = model->GetBeamline();
+	size_t nelements = std::distance(beamline.begin(), beamline.end());
+
+	runner.Measure(prefix + "/lattice_functions", nelements, [&]() {
+		twiss = CalculateLatticeFunctions(model);
+	}, nullptr, true);
+
+	if(!twiss)
+	{
+		twiss = CalculateLatticeFunctions(model);
+	}
+	if(std::isnan(twiss->Value(1, 1, 1, 0)))
+	{
+		runner.Skip(prefix, "lattice functions did not converge");
+		return;
+	}
+
+	// core tracking, no collimation
+	const size_t np = runner.Scaled(1000);
+	const size_t nturns = runner.Scaled(10);
+	BeamData beam = MatchedBeam(*twiss, start);
+	{
+		ProtonBunch bunch(np, NormalParticleDistributionGenerator(), beam);
+		AcceleratorModel::RingIterator ring = model->GetRing(start);
+		ParticleTracker tracker(ring, &bunch, false);
+		runner.Measure(prefix + "/track", np * nturns, [&]() {
+			for(size_t turn = 0; turn < nturns; turn++)
+			{
+				tracker.Track(&bunch);
+			}
+		}, nullptr, true);
+	}
+
+	if(!collimate)
+	{
+		return;
+	}
+
+	// halo on the primary collimator jaw, tracked with scattering and apertures
+	const string name = prefix + "/loss_map";
+	if(!runner.Selected(name))
+	{
+		return;
+	}
+	BeamData halo = beam;
+	halo.emit_x *= tcp_nsig * tcp_nsig;
+	halo.sig_dp = 0;
+	halo.sig_z = 0;
+	ProtonBunch bunch(beam_energy, 1);
+	AcceleratorModel::RingIterator ring = model->GetRing(start);
+	ParticleTracker tracker(ring, &bunch, false);
+
+	unique_ptr<LossMapCollimationOutput> losses(new LossMapCollimationOutput(tencm));
+	CollimateProtonProcess* collimation = new CollimateProtonProcess(2, 4);
+	collimation->SetScatteringModel(new ScatteringModelMerlin);
+	collimation->ScatterAtCollimator(true);
+	collimation->SetLossThreshold(200.0);
+	collimation->SetOutputBinSize(0.1);
+	collimation->SetLogStream(nullptr);
+	collimation->SetCollimationOutput(losses.get());
+	tracker.AddProcess(collimation);
+
+	auto setup = [&]() {
+		// the scattering model builds its cross section tables on first use,
+		// so track one untimed turn before the measurement
+		ProtonBunch warm(100, HorizonalHalo2ParticleDistributionGenerator(), halo);
+		tracker.Track(&warm);
+		ProtonBunch generated(np, HorizonalHalo2ParticleDistributionGenerator(), halo);
+		bunch.GetParticles() = generated.GetParticles();
+	};
+
+	runner.Measure(name, np * nturns, [&]() {
+		for(size_t turn = 0; turn < nturns && bunch.size() > 1; turn++)
+		{
+			tracker.Track(&bunch);
+		}
+		losses->Finalise();
+	}, setup, true);
+}
+
+void SyntheticRingBenchmarks(BenchRunner& runner)
+{
+	const string prefix = "macro/ring";
+	if(!runner.GroupSelected(prefix))
+	{
+		return;
+	}
+
+	const size_t ncells = 260;
+	vector<unique_ptr<Aperture> > apertures;
+	AcceleratorModel* model = nullptr;
+	runner.Measure(prefix + "/build", ncells, [&]() {
+		model = BuildSyntheticRing(ncells, apertures);
+	}, nullptr, true);
+	if(!model)
+	{
+		model = BuildSyntheticRing(ncells, apertures);
+	}
+	unique_ptr<AcceleratorModel> model_owner(model);
+
+	// set the primary collimator gap from the optics
+	unique_ptr<LatticeFunctionTable> twiss = CalculateLatticeFunctions(model);
+	vector<Collimator*> tcp;
+	model->ExtractTypedElements(tcp, "TCP");
+	SetPrimaryCollimator(tcp[0], *twiss, 0, apertures);
+
+	RingBenchmarks(runner, prefix, model, true);
+}
+
+void LHCBenchmarks(BenchRunner& runner)
+{
+	const string prefix = "macro/lhc";
+	const string& tfs = runner.Options().lhc_tfs;
+	if(tfs.empty())
+	{
+		runner.Skip(prefix, "no optics file, use --lhc <twiss.tfs>");
+		return;
+	}
+	if(!runner.GroupSelected(prefix))
+	{
+		return;
+	}
+
+	AcceleratorModel* model = nullptr;
+	runner.Measure(prefix + "/build", 1, [&]() {
+		MADInterface mad(tfs, beam_energy);
+		mad.TreatTypeAsDrift("RFCAVITY");
+		model = mad.ConstructModel();
+	}, nullptr, true);
+	unique_ptr<AcceleratorModel> model_owner(model);
+
+	// only the primary collimator gets a jaw, from the optics; the other
+	// collimators have no aperture so collimation passes them by
+	vector<Collimator*> tcp;
+	model->ExtractTypedElements(tcp, lhc_tcp);
+	if(tcp.empty())
+	{
+		runner.Skip(prefix + "/loss_map", string("no ") + lhc_tcp + " in the optics");
+		RingBenchmarks(runner, prefix, model, false);
+		return;
+	}
+	const size_t start = model->FindElementLatticePosition(lhc_tcp);
+	vector<unique_ptr<Aperture> > apertures;
+	{
+		unique_ptr<LatticeFunctionTable> twiss = CalculateLatticeFunctions(model);
+		SetPrimaryCollimator(tcp[0], *twiss, start, apertures);
+	}
+
+	// beam pipe apertures for everything else
+	try
+	{
+		ApertureConfiguration(runner.Options().data_dir + "Aperture_B1_6p5TeV_2016.tfs").ConfigureElementApertures(
+			model);
+	}
+	catch(exception& e)
+	{
+		runner.Skip(prefix + "/loss_map", e.what());
+		RingBenchmarks(runner, prefix, model, false, start);
+		return;
+	}
+
+	RingBenchmarks(runner, prefix, model, true, start);
+}
+
+} // end of anonymous namespace
+
+void RunMacroBenchmarks(BenchRunner& runner)
+{
+	SyntheticRingBenchmarks(runner);
+	LHCBenchmarks(runner);
+}
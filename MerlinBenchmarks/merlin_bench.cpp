@@ -0,0 +1,188 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <string>
+
+#include "bench_runner.h"
+#include "RandomNG.h"
+
+/*
+ * merlin_bench: micro and macro benchmarks for Merlin++
+ *
+ * Build with "make merlin_bench". Results are printed as a table and can be
+ * written as CSV or JSON. A CSV file from an earlier run can be given as a
+ * baseline, in which case the exit status is non-zero if the baseline cannot
+ * be read, if any benchmark run is not in it, or if any got slower by more
+ * than the tolerance.
+ *
+ * All measurements reset RandomNG to a fixed seed, so every run tracks the
+ * same particles.
+ */
+
+using namespace std;
+
+#ifndef MERLIN_BENCH_DATA_DIR
+#define MERLIN_BENCH_DATA_DIR "MerlinTests/data/"
+#endif
+
+void usage(const char* name)
+{
+	cout << "Usage: " << name << " [options]\n"
+		 << "  --filter <str>      only run benchmarks whose name contains str\n"
+		 << "  --micro             run the micro benchmarks (default: micro and macro)\n"
+		 << "  --macro             run the macro benchmarks (default: micro and macro)\n"
+		 << "  --quick             10x fewer particles and turns, shorter repeats\n"
+		 << "  --scale <x>         scale particle numbers and turns by x\n"
+		 << "  --min-time <s>      minimum time to repeat each micro benchmark\n"
+		 << "  --seed <n>          random seed (default 1)\n"
+		 << "  --data-dir <dir>    MerlinTests data directory\n"
+		 << "  --lhc <file.tfs>    LHC optics for the macro/lhc benchmarks\n"
+		 << "  --csv <file>        write results as CSV\n"
+		 << "  --json <file>       write results as JSON\n"
+		 << "  --baseline <file>   compare with the CSV output of an earlier run\n"
+		 << "  --tolerance <x>     allowed fractional slow down (default 0.1)\n";
+}
+
+int main(int argc, char* argv[])
+{
+	BenchOptions options;
+	options.data_dir = MERLIN_BENCH_DATA_DIR;
+	string csv_file, json_file, baseline_file;
+	double tolerance = 0.1;
+	bool micro = false, macro = false;
+
+	for(int i = 1; i < argc; i++)
+	{
+		string arg = argv[i];
+		bool has_value = i + 1 < argc;
+		if(arg == "--help" || arg == "-h")
+		{
+			usage(argv[0]);
+			return 0;
+		}
+		else if(arg == "--micro")
+		{
+			micro = true;
+		}
+		else if(arg == "--macro")
+		{
+			macro = true;
+		}
+		else if(arg == "--quick")
+		{
+			options.scale = 0.1;
+			options.min_time = 0.1;
+		}
+		else if(arg == "--filter" && has_value)
+		{
+			options.filter = argv[++i];
+		}
+		else if(arg == "--scale" && has_value)
+		{
+			options.scale = atof(argv[++i]);
+		}
+		else if(arg == "--min-time" && has_value)
+		{
+			options.min_time = atof(argv[++i]);
+		}
+		else if(arg == "--seed" && has_value)
+		{
+			options.seed = atoi(argv[++i]);
+		}
+		else if(arg == "--data-dir" && has_value)
+		{
+			options.data_dir = string(argv[++i]) + "/";
+		}
+		else if(arg == "--lhc" && has_value)
+		{
+			options.lhc_tfs = argv[++i];
+		}
+		else if(arg == "--csv" && has_value)
+		{
+			csv_file = argv[++i];
+		}
+		else if(arg == "--json" && has_value)
+		{
+			json_file = argv[++i];
+		}
+		else if(arg == "--baseline" && has_value)
+		{
+			baseline_file = argv[++i];
+		}
+		else if(arg == "--tolerance" && has_value)
+		{
+			tolerance = atof(argv[++i]);
+		}
+		else
+		{
+			cerr << "Unknown or incomplete option: " << arg << endl;
+			usage(argv[0]);
+			return 2;
+		}
+	}
+
+	// --micro and --macro each select a set; with neither, both run
+	if(micro || macro)
+	{
+		options.micro = micro;
+		options.macro = macro;
+	}
+
+	// read the baseline first, so that a bad file fails before the benchmarks run
+	map<string, BenchResult> baseline;
+	if(!baseline_file.empty() && !ReadBaselineCSV(baseline_file, baseline))
+	{
+		cerr << "Could not read any results from baseline file " << baseline_file << endl;
+		return 1;
+	}
+
+	RandomNG::init(options.seed);
+	BenchRunner runner(options);
+
+	if(options.micro)
+	{
+		RunMicroBenchmarks(runner);
+	}
+	if(options.macro)
+	{
+		RunMacroBenchmarks(runner);
+	}
+
+	if(!csv_file.empty())
+	{
+		ofstream out(csv_file);
+		runner.WriteCSV(out);
+	}
+	if(!json_file.empty())
+	{
+		ofstream out(json_file);
+		runner.WriteJSON(out);
+	}
+
+	if(!baseline_file.empty())
+	{
+		size_t missing = 0;
+		size_t slower = CompareToBaseline(runner.Results(), baseline, tolerance, cout, missing);
+		if(slower)
+		{
+			cout << slower << " benchmark(s) slower than baseline by more than " << 100 * tolerance << "%" << endl;
+		}
+		if(missing)
+		{
+			cout << missing << " benchmark(s) not in the baseline" << endl;
+		}
+		if(slower || missing)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,381 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "bench_runner.h"
+
+#include "AcceleratorModelConstructor.h"
+#include "BeamData.h"
+#include "Aperture.h"
+#include "CollimateProtonProcess.h"
+#include "CollimatorAperture.h"
+#include "Components.h"
+#include "DataTableTFS.h"
+#include "InterpolatedApertures.h"
+#include "MaterialDatabase.h"
+#include "ParticleBunchTypes.h"
+#include "ParticleBunchUtilities.h"
+#include "ParticleDistributionGenerator.h"
+#include "ParticleTracker.h"
+#include "PhysicalUnits.h"
+#include "RandomNG.h"
+#include "ScatteringModelsMerlin.h"
+#include "StdIntegrators.h"
+#include "SymplecticIntegrators.h"
+#include "WakeFieldProcess.h"
+#include "WakePotentials.h"
+
+/*
+ * Micro benchmarks: single elements, apertures, scattering, random numbers,
+ * TFS parsing and bunch binning, each timed in isolation.
+ */
+
+using namespace std;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+namespace
+{
+
+const double beam_energy = 7000.0;
+
+/// Magnetic rigidity in T.m for a momentum in GeV/c
+double BRho(double p0)
+{
+	return p0 / 0.299792458;
+}
+
+/// A bunch with roughly LHC-like transverse and longitudinal sizes
+void MakeBunch(ProtonBunch& bunch, size_t np)
+{
+	BeamData beam;
+	beam.p0 = beam_energy;
+	beam.beta_x = beam.beta_y = 100 * meter;
+	beam.emit_x = beam.emit_y = 5e-10 * meter;
+	beam.sig_z = 75 * millimeter;
+	beam.sig_dp = 1e-4;
+	beam.charge = 1.1e11 / np;
+
+	ProtonBunch tmp(np, NormalParticleDistributionGenerator(), beam);
+	bunch.GetParticles() = tmp.GetParticles();
+	bunch.SetMacroParticleCharge(beam.charge);
+}
+
+struct NamedISet
+{
+	string name;
+	const ParticleTracker::integrator_set_base* iset;
+};
+
+vector<NamedISet> IntegratorSets()
+{
+	static TRANSPORT::StdISet transport;
+	static SYMPLECTIC::StdISet symplectic;
+	static THIN_LENS::StdISet thin_lens;
+	return {{"transport", &transport}, {"symplectic", &symplectic}, {"thinlens", &thin_lens}};
+}
+
+/// Track a bunch through one element under each integrator set
+void ElementBenchmarks(BenchRunner& runner)
+{
+	const size_t np = runner.Scaled(100000);
+	const double brho = BRho(beam_energy);
+
+	vector<AcceleratorComponent*> elements;
+	elements.push_back(new Drift("D", 1 * meter));
+	elements.push_back(new Quadrupole("Q", 3 * meter, 0.01 * brho));
+	elements.push_back(new Sextupole("S", 0.4 * meter, 0.1 * brho));
+	elements.push_back(new SectorBend("B", 14.3 * meter, 5e-4, 5e-4 * brho));
+	elements.push_back(new Solenoid("SOL", 1 * meter, 2.0));
+
+	ProtonBunch master(beam_energy, 1);
+	MakeBunch(master, np);
+	ProtonBunch bunch(beam_energy, 1);
+
+	for(auto element : elements)
+	{
+		AcceleratorModelConstructor ctor;
+		ctor.NewModel();
+		ctor.AppendComponent(element);
+		unique_ptr<AcceleratorModel> model(ctor.GetModel());
+		AcceleratorModel::Beamline beamline = model->GetBeamline();
+
+		for(auto& iset : IntegratorSets())
+		{
+			string name = "element/" + element->GetType() + "/" + iset.name;
+			if(!runner.Selected(name))
+			{
+				continue;
+			}
+			ParticleTracker tracker(beamline, &bunch, false);
+			tracker.SetIntegratorSet(iset.iset);
+			runner.Measure(name, np, [&]() {
+				tracker.Track(&bunch);
+			}, [&]() {
+				bunch.GetParticles() = master.GetParticles();
+			});
+		}
+	}
+}
+
+/// Aperture::CheckWithinApertureBoundaries() for every aperture type
+void ApertureBenchmarks(BenchRunner& runner)
+{
+	const size_t np = runner.Scaled(1000000);
+
+	ApertureFactory factory;
+	vector<pair<string, Aperture*> > apertures;
+	for(string type : {"CIRCLE", "RECTANGLE", "ELLIPSE", "RECTELLIPSE", "OCTAGON"})
+	{
+		apertures.push_back({type, factory.getInstance(type, 0, 0.02, 0.018, 0.022, 0.018)});
+	}
+
+	vector<Aperture*> interp_points;
+	for(int i = 0; i < 4; i++)
+	{
+		interp_points.push_back(factory.getInstance("RECTELLIPSE", i * 5.0, 0.02 + 0.001 * i, 0.018, 0.022, 0.018));
+	}
+	apertures.push_back({"INTERPOLATED_RECTELLIPSE", new InterpolatedRectEllipseAperture(interp_points)});
+	apertures.push_back({"COLLIMATOR", new CollimatorAperture(0.004, 0.1, 0.3, 1.0, 0.0001, 0)});
+	apertures.push_back({"COLLIMATOR_UNALIGNED", new UnalignedCollimatorAperture(0.004, 0.1, 0.3, 1.0, 0.0001, 0)});
+	apertures.push_back({"COLLIMATOR_ERRORS", new CollimatorApertureWithErrors(0.004, 0.1, 0.3, 1.0, 0.0001, 0, 1e-5)});
+	apertures.push_back({"COLLIMATOR_UNALIGNED_ERRORS", new UnalignedCollimatorApertureWithErrors(0.004, 0.1, 0.3, 1.0,
+		0.0001, 0, 1e-5)});
+	apertures.push_back({"COLLIMATOR_ONE_SIDED", new OneSidedUnalignedCollimatorAperture(0.004, 0.1, 0.3, 1.0, 0.0001,
+		0)});
+
+	// points spread across the aperture edges
+	RandomNG::reset(runner.Options().seed);
+	vector<double> x(np), y(np), z(np);
+	for(size_t i = 0; i < np; i++)
+	{
+		x[i] = RandomNG::uniform(-0.025, 0.025);
+		y[i] = RandomNG::uniform(-0.025, 0.025);
+		z[i] = RandomNG::uniform(0, 1.0);
+	}
+
+	for(auto& ap : apertures)
+	{
+		runner.Measure("aperture/" + ap.first, np, [&]() {
+			size_t inside = 0;
+			for(size_t i = 0; i < np; i++)
+			{
+				inside += ap.second->CheckWithinApertureBoundaries(x[i], y[i], z[i]);
+			}
+			volatile size_t sink = inside;
+			(void) sink;
+		});
+	}
+
+	for(auto& ap : apertures)
+	{
+		delete ap.second;
+	}
+	for(auto ap : interp_points)
+	{
+		delete ap;
+	}
+}
+
+/// Protons hitting a 10cm collimator jaw, for each material
+void ScatteringBenchmarks(BenchRunner& runner)
+{
+	const size_t np = runner.Scaled(2000);
+	const double length = 0.1 * meter;
+	const double half_gap = 1 * millimeter;
+
+	MaterialDatabase materials;
+	for(string symbol : {"Be", "C", "Al", "Cu", "Mo", "W", "Pb"})
+	{
+		string name = "scatter/" + symbol;
+		Material* material = materials.FindMaterial(symbol);
+		if(!runner.Selected(name))
+		{
+			continue;
+		}
+		if(!material)
+		{
+			runner.Skip(name, "material not in database");
+			continue;
+		}
+
+		AcceleratorModelConstructor ctor;
+		ctor.NewModel();
+		Collimator* col = new Collimator("TCP", length);
+		col->SetMaterial(material);
+		unique_ptr<CollimatorAperture> aperture(new CollimatorAperture(2 * half_gap, 2 * half_gap, 0, length, 0, 0));
+		col->SetAperture(aperture.get());
+		ctor.AppendComponent(col);
+		unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+		ProtonBunch bunch(beam_energy, 1);
+		AcceleratorModel::Beamline beamline = model->GetBeamline();
+		ParticleTracker tracker(beamline, &bunch, false);
+
+		CollimateProtonProcess* collimation = new CollimateProtonProcess(2, 4);
+		collimation->SetScatteringModel(new ScatteringModelMerlin);
+		collimation->ScatterAtCollimator(true);
+		collimation->SetLossThreshold(101.0);
+		collimation->SetLogStream(nullptr);
+		collimation->SetOutputBinSize(length);
+		tracker.AddProcess(collimation);
+
+		runner.Measure(name, np, [&]() {
+			tracker.Track(&bunch);
+		}, [&]() {
+			bunch.clear();
+			Particle p(0);
+			p.x() = half_gap + 1 * micrometer;
+			for(size_t i = 0; i < np; i++)
+			{
+				bunch.AddParticle(p);
+			}
+		});
+	}
+}
+
+/// RandomNG distributions
+void RandomBenchmarks(BenchRunner& runner)
+{
+	const size_t n = runner.Scaled(1000000);
+
+	auto draw = [&](const string& name, const function<double()>& f) {
+		runner.Measure("random/" + name, n, [&]() {
+			double sum = 0;
+			for(size_t i = 0; i < n; i++)
+			{
+				sum += f();
+			}
+			volatile double sink = sum;
+			(void) sink;
+		});
+	};
+
+	draw("normal", []() {
+		return RandomNG::normal(0, 1);
+	});
+	draw("normal_cut3", []() {
+		return RandomNG::normal(0, 1, 3);
+	});
+	draw("uniform", []() {
+		return RandomNG::uniform(-1, 1);
+	});
+	draw("poisson", []() {
+		return RandomNG::poisson(5);
+	});
+	draw("landau", []() {
+		return RandomNG::landau();
+	});
+	draw("normal_tail5", []() {
+		return RandomNG::normalTail(RandomNG::getGenerator(), 5);
+	});
+}
+
+/// Parse the LHC aperture TFS file
+void TFSBenchmarks(BenchRunner& runner)
+{
+	const string filename = runner.Options().data_dir + "Aperture_B1_6p5TeV_2016.tfs";
+	const string name = "tfs/read_aperture";
+	if(!runner.Selected(name))
+	{
+		return;
+	}
+
+	size_t rows = 0;
+	try
+	{
+		auto table = DataTableReaderTFS(filename).Read();
+		for(auto it = table->begin(); it != table->end(); ++it)
+		{
+			rows++;
+		}
+	}
+	catch(exception& e)
+	{
+		runner.Skip(name, e.what());
+		return;
+	}
+
+	runner.Measure(name, rows, [&]() {
+		auto table = DataTableReaderTFS(filename).Read();
+	});
+}
+
+/// Simple wake potential, so the benchmark does not depend on a wake table
+class ResistiveWallBenchWake: public WakePotentials
+{
+public:
+	double Wlong(double z) const
+	{
+		return z > 0 ? 1e12 * exp(-z / 0.01) : 0;
+	}
+	double Wtrans(double z) const
+	{
+		return z > 0 ? 1e14 * sqrt(z) : 0;
+	}
+};
+
+/// Longitudinal binning and a wakefield kick
+void CollectiveBenchmarks(BenchRunner& runner)
+{
+	const size_t np = runner.Scaled(100000);
+	const size_t nbins = 100;
+
+	ProtonBunch master(beam_energy, 1);
+	MakeBunch(master, np);
+	ProtonBunch bunch(beam_energy, 1);
+	auto reset = [&]() {
+		bunch.GetParticles() = master.GetParticles();
+	};
+
+	double zmin = -3 * 75 * millimeter;
+	double zmax = 3 * 75 * millimeter;
+	runner.Measure("collective/bin_list", np, [&]() {
+		vector<ParticleBunch::iterator> pbins;
+		vector<double> hd, hdp;
+		ParticleBinList(bunch, zmin, zmax, nbins, pbins, hd, hdp);
+	}, reset);
+
+	if(!runner.Selected("collective/wakefield"))
+	{
+		return;
+	}
+
+	ResistiveWallBenchWake wake;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	Drift* d = new Drift("WAKE", 1 * meter);
+	d->SetWakePotentials(&wake);
+	ctor.AppendComponent(d);
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+	AcceleratorModel::Beamline beamline = model->GetBeamline();
+	ParticleTracker tracker(beamline, &bunch, false);
+	tracker.AddProcess(new WakeFieldProcess(1, nbins));
+
+	runner.Measure("collective/wakefield", np, [&]() {
+		tracker.Track(&bunch);
+	}, reset);
+	d->SetWakePotentials(nullptr);
+}
+
+} // end of anonymous namespace
+
+void RunMicroBenchmarks(BenchRunner& runner)
+{
+	ElementBenchmarks(runner);
+	ApertureBenchmarks(runner);
+	ScatteringBenchmarks(runner);
+	RandomBenchmarks(runner);
+	TFSBenchmarks(runner);
+	CollectiveBenchmarks(runner);
+}
@@ -48,6 +48,52 @@ void testCollimatorAperture()
 	assert(appp->GetJawSide() == 0);
 }
 
+/*
+ * The jaws of the apertures with errors bow in towards x and y by error * (z^2 / length - z). With no error they
+ * give the same hits and misses as the apertures without errors, which is also what the with-errors checks gave
+ * before they applied the error.
+ */
+void testCollimatorApertureWithErrors()
+{
+	const double w = 0.004;
+	const double h = 0.1;
+	const double length = 1;
+	const double error = 0.004; // moves the jaws by 1 mm at the centre
+
+	CollimatorAperture aligned(w, h, 0, length);
+	aligned.SetExitWidth(w);
+	aligned.SetExitHeight(h);
+	UnalignedCollimatorAperture unaligned(w, h, 0, length);
+
+	for(double e : {0.0, error})
+	{
+		CollimatorApertureWithErrors aligned_err(w, h, 0, length, 0, 0, e);
+		aligned_err.SetExitWidth(w);
+		aligned_err.SetExitHeight(h);
+		UnalignedCollimatorApertureWithErrors unaligned_err(w, h, 0, length, 0, 0, e);
+
+		vector<pair<Aperture*, Aperture*> > pairs {{&aligned, &aligned_err}, {&unaligned, &unaligned_err}};
+		for(auto& ap : pairs)
+		{
+			for(double x : {-0.0025, -0.0015, 0.0, 0.0015, 0.0025})
+			{
+				// no change at the ends of the jaws
+				assert(ap.first->CheckWithinApertureBoundaries(x, 0, 0) == ap.second->CheckWithinApertureBoundaries(x, 0,
+					0));
+				assert(ap.first->CheckWithinApertureBoundaries(x, 0, length) == ap.second->CheckWithinApertureBoundaries(x,
+					0, length));
+			}
+
+			// at the centre, the error turns a hit near one jaw into a miss, and a miss beyond the other into a hit
+			assert(ap.first->CheckWithinApertureBoundaries(-0.0015, 0, length / 2) == true);
+			assert(ap.first->CheckWithinApertureBoundaries(0.0025, 0, length / 2) == false);
+			assert(ap.second->CheckWithinApertureBoundaries(-0.0015, 0, length / 2) == (e == 0));
+			assert(ap.second->CheckWithinApertureBoundaries(0.0025, 0, length / 2) == (e != 0));
+			assert(ap.second->CheckWithinApertureBoundaries(0.0, 0, length / 2) == true);
+		}
+	}
+}
+
 void testApertureFactory()
 {
 	ApertureFactory factory;
@@ -101,5 +147,6 @@ int main(int argc, char* argv[])
 	testApertureFactory();
 	testInterpolatedApertureFactory();
 	testCollimatorAperture();
+	testCollimatorApertureWithErrors();
 	cout << "all aperture tests successful" << endl;
 }
@@ -0,0 +1,200 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+
+#include "AcceleratorModelConstructor.h"
+#include "AsyncOutput.h"
+#include "Components.h"
+#include "MerlinException.h"
+#include "MonitorProcess.h"
+#include "ParticleBunch.h"
+#include "TrackingOutputAV.h"
+
+/*
+ * Check that AsyncOutput writes snapshots in order while limiting the
+ * number waiting, and passes on errors, and that MonitorProcess and
+ * TrackingOutputAV write the same files with asynchronous output as
+ * without, when the bunch changes straight after each snapshot.
+ */
+
+using namespace std;
+using namespace ParticleTracking;
+
+string read_file(const string& name)
+{
+	ifstream in(name);
+	assert(in.good());
+	stringstream ss;
+	ss << in.rdbuf();
+	return ss.str();
+}
+
+void fill_bunch(ParticleBunch& bunch)
+{
+	for(int n = 0; n < 200; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		p.x() = 1e-3 * n;
+		p.xp() = -2e-6 * n;
+		p.y() = 3e-4 * (n % 7);
+		p.dp() = 1e-5 * (n % 3);
+		p.type() = n % 4 == 0 ? -1 : 1;
+		bunch.push_back(p);
+	}
+}
+
+void change_bunch(ParticleBunch& bunch)
+{
+	for(Particle& p : bunch)
+	{
+		p.x() += 1e-4;
+		p.yp() -= 1e-6;
+	}
+}
+
+// dump at M1 on each of 5 turns, changing the bunch after each
+void monitor(const string& prefix, size_t nbuffers)
+{
+	ParticleBunch bunch(450.0, 1e11);
+	fill_bunch(bunch);
+	Marker m("M1");
+
+	MonitorProcess mon("MONITOR", 0, prefix);
+	mon.SetAsync(nbuffers);
+	mon.AddElement("M1");
+	mon.InitialiseProcess(bunch);
+	for(int turn = 0; turn < 5; turn++)
+	{
+		mon.SetCurrentComponent(m);
+		assert(mon.IsActive());
+		mon.DoProcess(0);
+		change_bunch(bunch);
+	}
+}
+
+// record a bunch at every element of a beamline on 3 turns
+void tracking_output(const string& filename, size_t nbuffers)
+{
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new Drift("D1", 1.0));
+	ctor.AppendComponent(new Quadrupole("Q1", 0.5, 0.1));
+	ctor.AppendComponent(new Drift("D2", 2.0));
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+	ParticleBunch bunch(450.0, 1e11);
+	fill_bunch(bunch);
+	{
+		TrackingOutputAV out(filename);
+		out.SetAsync(nbuffers);
+		for(int turn = 0; turn < 3; turn++)
+		{
+			AcceleratorModel::Beamline bline = model->GetBeamline();
+			for(AcceleratorModel::BeamlineIterator f = bline.begin(); f != bline.end(); f++)
+			{
+				out.DoRecord(*f, &bunch);
+				change_bunch(bunch);
+			}
+		}
+	}
+}
+
+int main()
+{
+	// snapshots are written in order, with at most two waiting
+	ostringstream os;
+	{
+		AsyncOutput writer(2);
+		assert(writer.GetNumberOfBuffers() == 2);
+		for(int n = 0; n < 20; n++)
+		{
+			AsyncOutput::Buffer& b = writer.Acquire();
+			b.turn = n;
+			b.particles.assign(n % 5 + 1, PSvector(n));
+			b.write = [&os](const AsyncOutput::Buffer& b)
+			{
+				this_thread::sleep_for(chrono::milliseconds(1));
+				os << b.turn << " " << b.particles.size() << " " << b.particles.back().x() << "\n";
+			};
+			writer.Submit(b);
+		}
+		writer.Flush();
+	}
+	ostringstream expected;
+	for(int n = 0; n < 20; n++)
+	{
+		expected << n << " " << n % 5 + 1 << " " << n << "\n";
+	}
+	assert(os.str() == expected.str());
+
+	// errors in the writer are passed on
+	AsyncOutput failing(1);
+	AsyncOutput::Buffer& b = failing.Acquire();
+	b.write = [](const AsyncOutput::Buffer&)
+	{
+		throw runtime_error("write failed");
+	};
+	failing.Submit(b);
+	bool caught = false;
+	try
+	{
+		failing.Flush();
+	}
+	catch(runtime_error&)
+	{
+		caught = true;
+	}
+	assert(caught);
+
+	// monitor files are the same written either way
+	monitor("async_output_test_sync_", 0);
+	monitor("async_output_test_async_", 2);
+	for(int n = 1; n <= 5; n++)
+	{
+		const string sync_name = "async_output_test_sync_M1_" + to_string(n);
+		const string async_name = "async_output_test_async_M1_" + to_string(n);
+		const string s = read_file(sync_name);
+		assert(s.size() > 200 * 8 * 35);
+		assert(read_file(async_name) == s);
+		remove(sync_name.c_str());
+		remove(async_name.c_str());
+	}
+
+	// a monitor file that cannot be opened in the background is reported by Flush()
+	{
+		ParticleBunch bunch(450.0, 1e11);
+		fill_bunch(bunch);
+		Marker m("M1");
+		MonitorProcess mon("MONITOR", 0, "no_such_directory/async_output_test_");
+		mon.SetAsync(2);
+		mon.AddElement("M1");
+		mon.InitialiseProcess(bunch);
+		mon.SetCurrentComponent(m);
+		mon.DoProcess(0);
+		assert_throws(mon.Flush(), MerlinException);
+	}
+
+	// as are the tracking outputs
+	tracking_output("async_output_test_sync.dat", 0);
+	tracking_output("async_output_test_async.dat", 3);
+	const string s = read_file("async_output_test_sync.dat");
+	assert(s.size() > 50 * 9 * 60);
+	assert(read_file("async_output_test_async.dat") == s);
+	remove("async_output_test_sync.dat");
+	remove("async_output_test_async.dat");
+
+	return 0;
+}
@@ -0,0 +1,201 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include "AcceleratorModelConstructor.h"
+#include "BunchTrainTracker.h"
+#include "Components.h"
+#include "LongRangeWakePotentials.h"
+#include "MerlinException.h"
+#include "ParticleTracker.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+
+/*
+ * Track a train of bunches through cavities with long-range dipole modes
+ * using BunchTrainTracker, and compare with tracking each bunch through
+ * one element at a time and summing the wakes of all the bunches ahead
+ * directly. Without the long-range wakes every bunch must track as if it
+ * were alone.
+ */
+
+using namespace std;
+using namespace ParticleTracking;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+const int nbunches = 40;
+const int nparticles = 5;
+const double p0 = 5.0;
+const double spacing = 3.08e-9;
+
+// bunch n of the train, with a few particles about a centroid that varies along the train
+void fill_bunch(ParticleBunch& bunch, int n)
+{
+	bunch.GetParticles().clear();
+	for(int i = 0; i < nparticles; i++)
+	{
+		Particle p(0);
+		p.x() = 1e-3 * sin(1.7 * n) + 1e-5 * i;
+		p.xp() = 2e-6 * cos(0.3 * n + i);
+		p.y() = 5e-4 * cos(0.9 * n) - 2e-5 * i;
+		p.yp() = -1e-6 * sin(0.7 * n + i);
+		p.ct() = 1e-4 * (i - 2);
+		bunch.push_back(p);
+	}
+}
+
+ParticleBunch* make_bunch(int n)
+{
+	ParticleBunch* bunch = new ParticleBunch(p0, 4e9 * (1 + 0.1 * (n % 3)));
+	fill_bunch(*bunch, n);
+	return bunch;
+}
+
+double difference(const ParticleBunch& a, const ParticleBunch& b)
+{
+	assert(a.size() == b.size());
+	double d = 0;
+	for(size_t i = 0; i < a.size(); i++)
+	{
+		for(int k = 0; k < 6; k++)
+		{
+			d = max(d, fabs(a.GetParticles()[i][k] - b.GetParticles()[i][k]));
+		}
+	}
+	return d;
+}
+
+int main()
+{
+	LongRangeWakePotentials wake;
+	wake.AddMode(1.70e9, 5e4, 2e14);
+	wake.AddMode(1.87e9, 1e4, 8e13);
+	wake.AddMode(2.45e9, 2e5, 3e13);
+
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new Drift("D1", 1.0));
+	Drift* c1 = new Drift("C1", 1.0);
+	c1->SetWakePotentials(&wake);
+	ctor.AppendComponent(c1);
+	ctor.AppendComponent(new Quadrupole("Q1", 0.5, 0.3 * p0 / eV / SpeedOfLight));
+	Drift* c2 = new Drift("C2", 1.2);
+	c2->SetWakePotentials(&wake);
+	ctor.AppendComponent(c2);
+	ctor.AppendComponent(new Drift("D2", 2.0));
+	ctor.AppendComponent(new Quadrupole("Q2", 0.5, -0.3 * p0 / eV / SpeedOfLight));
+	Drift* c3 = new Drift("C3", 0.8);
+	c3->SetWakePotentials(&wake);
+	ctor.AppendComponent(c3);
+	ctor.AppendComponent(new Marker("END"));
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+	const AcceleratorModel::Beamline bline = model->GetBeamline();
+
+	// the train, with and without long-range wakes
+	vector<unique_ptr<ParticleBunch> > train, alone;
+	BunchTrainTracker tracker(bline);
+	BunchTrainTracker free_tracker(bline);
+	for(int n = 0; n < nbunches; n++)
+	{
+		train.emplace_back(make_bunch(n));
+		alone.emplace_back(make_bunch(n));
+		assert(tracker.AddBunch(train.back().get(), n * spacing) == size_t(n));
+		free_tracker.AddBunch(alone.back().get(), n * spacing);
+	}
+	tracker.IncludeLongRangeWakes();
+	tracker.Track();
+	free_tracker.Track();
+
+	// each bunch tracked one element at a time, with the wakes of the bunches
+	// ahead summed directly at the exit of each cavity
+	vector<unique_ptr<ParticleTracker> > expected;
+	for(int n = 0; n < nbunches; n++)
+	{
+		expected.emplace_back(new ParticleTracker(bline));
+		expected.back()->InitStepper(make_bunch(n));
+	}
+	for(AcceleratorModel::ConstBeamlineIterator f = bline.begin(); f != bline.end(); f++)
+	{
+		const AcceleratorComponent& component = (*f)->GetComponent();
+		vector<double> q, x, y;
+		for(int n = 0; n < nbunches; n++)
+		{
+			expected[n]->StepComponent();
+			if(component.GetWakePotentials() == &wake)
+			{
+				ParticleBunch& bunch = expected[n]->GetTrackedBunch();
+				PSvector c;
+				bunch.GetCentroid(c);
+				double wx = 0, wy = 0;
+				for(int j = 0; j < n; j++)
+				{
+					const double w = wake.Wtrans((n - j) * spacing * SpeedOfLight);
+					wx += q[j] * x[j] * w;
+					wy += q[j] * y[j] * w;
+				}
+				q.push_back(bunch.GetTotalCharge() * ElectronCharge);
+				x.push_back(c.x());
+				y.push_back(c.y());
+				for(Particle& p : bunch)
+				{
+					p.xp() += component.GetLength() * wx * Volt / p0;
+					p.yp() += component.GetLength() * wy * Volt / p0;
+				}
+			}
+		}
+	}
+
+	double max_diff = 0, max_wake = 0;
+	for(int n = 0; n < nbunches; n++)
+	{
+		ParticleTracker single(bline);
+		ParticleBunch* bunch = make_bunch(n);
+		single.Track(bunch);
+		assert(difference(*alone[n], *bunch) == 0);
+		delete bunch;
+
+		max_diff = max(max_diff, difference(*train[n], expected[n]->GetTrackedBunch()));
+		max_wake = max(max_wake, difference(*train[n], *alone[n]));
+	}
+	cout << "largest wake effect " << max_wake << " difference " << max_diff << endl;
+	assert(max_wake > 1e-6);
+	assert(max_diff <= 1e-10 * max_wake);
+
+	// tracking again starts from empty cavities
+	unique_ptr<ParticleBunch> a(make_bunch(0)), b(make_bunch(1));
+	BunchTrainTracker two(bline);
+	two.AddBunch(a.get(), 0);
+	two.AddBunch(b.get(), spacing);
+	two.IncludeLongRangeWakes();
+	two.Track();
+	const ParticleBunch first_pass(*b);
+	fill_bunch(*a, 0);
+	fill_bunch(*b, 1);
+	two.Track();
+	assert(difference(*b, first_pass) == 0);
+	assert(difference(*b, *train[1]) == 0);
+
+	// the bunches of a train arrive in order
+	bool thrown = false;
+	try
+	{
+		two.AddBunch(a.get(), 0.5 * spacing);
+	}
+	catch(MerlinException& e)
+	{
+		thrown = true;
+	}
+	assert(thrown);
+
+	return 0;
+}
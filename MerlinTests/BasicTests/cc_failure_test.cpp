@@ -0,0 +1,241 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "CCFailureProcess.h"
+#include "Components.h"
+#include "CrabMarker.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+
+/*
+ * Check the crab cavity kicks of CCFailureProcess, found from the
+ * optics cached when the process is first used, against the voltages
+ * found directly from the lattice functions, for a voltage failure of
+ * the ATLAS cavities, a phase failure of the downstream ATLAS cavities
+ * about a nonzero crab phase and a voltage failure of the CMS cavities
+ * alone. The cavities and IPs are placed at the positions the
+ * process expects in the LHC, on a ring of FODO cells.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+const double beam_energy = 7000.0;
+const double omega = 400.79E6 * 2 * pi;
+const double crossing = 590e-6 / 2;
+const int non_fail_turns = 2;
+const int fail_turns = 3;
+
+struct Cavity
+{
+	CrabMarker* marker;
+	bool atlas;
+	bool upstream;
+	int slot;
+	double V;
+};
+
+vector<Cavity> cavities;
+
+void append(AcceleratorModelConstructor& ctor, AcceleratorComponent* c, double s)
+{
+	c->SetComponentLatticePosition(s);
+	ctor.AppendComponent(c);
+}
+
+void append_crabs(AcceleratorModelConstructor& ctor, const string& name, bool atlas, bool upstream, double s)
+{
+	for(int k = 0; k < 4; k++)
+	{
+		CrabMarker* c = new CrabMarker(name + to_string(k), 0);
+		append(ctor, c, s + 10 * k);
+		cavities.push_back({c, atlas, upstream, k, 0});
+	}
+}
+
+// IP1 at the start, then the downstream ATLAS cavities, the CMS cavities about IP5, and the upstream ATLAS cavities,
+// with FODO cells between the sets
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	append(ctor, new Marker("IP1.L1"), 0);
+	append_crabs(ctor, "CC.ATLAS.D", true, false, 100);
+	ring.AppendCells(ctor, 0, 2, 1000);
+	append_crabs(ctor, "CC.CMS.U", false, true, 10000);
+	ring.AppendCells(ctor, 2, 2, 11000);
+	append(ctor, new Marker("IP5"), 13250);
+	append_crabs(ctor, "CC.CMS.D", false, false, 13300);
+	ring.AppendCells(ctor, 4, 4, 16000);
+	append_crabs(ctor, "CC.ATLAS.U", true, true, 20000);
+	return ctor.GetModel();
+}
+
+// the voltages of the ATLAS (vertical) or CMS (horizontal) cavities, found directly from the lattice functions
+void find_voltages(AcceleratorModel* model, CCFailureProcess& proc, bool atlas)
+{
+	const bool horizontal = !atlas;
+	const int ip = atlas ? model->FindElementLatticePosition("IP1.L1") : model->FindElementLatticePosition("IP5") + 1;
+	int n_up[4];
+	double V1[4], mu_up[4];
+	for(Cavity& c : cavities)
+	{
+		if(c.atlas == atlas && c.upstream)
+		{
+			const int n1 = model->FindElementLatticePosition(c.marker->GetName());
+			const pair<double, double> dmu = proc.CalcDeltaMu(n1, ip);
+			n_up[c.slot] = n1;
+			mu_up[c.slot] = fabs(horizontal ? dmu.first : dmu.second) * 2 * pi;
+			c.V = V1[c.slot] = proc.CalcV1(proc.CalcM_12(n1, ip, horizontal));
+		}
+	}
+	for(Cavity& c : cavities)
+	{
+		if(c.atlas == atlas && !c.upstream)
+		{
+			const int n1 = model->FindElementLatticePosition(c.marker->GetName());
+			const pair<double, double> dmu = atlas ? proc.CalcMu(n1) : proc.CalcDeltaMu(n1, ip);
+			const double mu = fabs(horizontal ? dmu.first : dmu.second) * 2 * pi + mu_up[c.slot];
+			c.V = proc.CalcV2(V1[c.slot], proc.CalcM_22(n_up[c.slot], n1, mu, horizontal));
+		}
+	}
+}
+
+// passes the bunch through the cavities for 7 turns, starting before the upstream CMS cavities
+void track(CCFailureProcess& proc, ParticleBunch& bunch, bool atlas, bool phase_failure, double phi_s)
+{
+	size_t first = 0;
+	while(!(!cavities[first].atlas && cavities[first].upstream))
+	{
+		first++;
+	}
+
+	int kicked = 0;
+	double crab_phase = phi_s;
+	for(int turn = 1; turn <= 7; turn++)
+	{
+		for(size_t k = 0; k < cavities.size(); k++)
+		{
+			const Cavity& c = cavities[(first + k) % cavities.size()];
+			proc.SetCurrentComponent(*c.marker);
+			assert(proc.IsActive());
+
+			const PSvectorArray before = bunch.GetParticles();
+			proc.DoProcess(0);
+			assert(bunch.size() == before.size());
+
+			double V = 0;
+			double phase = phi_s;
+			if(c.atlas == atlas && turn < non_fail_turns + fail_turns)
+			{
+				V = c.V;
+				if(turn >= non_fail_turns && !phase_failure && c.upstream)
+				{
+					V *= 1 - double(turn + 1 - non_fail_turns) / fail_turns;
+				}
+				if(phase_failure)
+				{
+					// the failure phase replaces the crab phase, which is zero after the first cavity
+					phase = crab_phase;
+					if(turn >= non_fail_turns && !c.upstream)
+					{
+						phase = double(turn - (non_fail_turns - 1)) / fail_turns * pi / 2;
+					}
+					crab_phase = 0;
+				}
+			}
+
+			for(size_t n = 0; n < bunch.size(); n++)
+			{
+				const PSvector& p = bunch.GetParticles()[n];
+				const PSvector& p0 = before[n];
+				const double kick = V * sin(phase + p0.ct() * omega / SpeedOfLight) / 7E12;
+				const double tol = 1e-12 * fabs(V / 7E12);
+				assert(p.x() == p0.x() && p.y() == p0.y() && p.ct() == p0.ct());
+				if(atlas)
+				{
+					assert(p.xp() == p0.xp() && fabs(p.yp() - (p0.yp() - kick)) <= tol);
+				}
+				else
+				{
+					assert(p.yp() == p0.yp() && fabs(p.xp() - (p0.xp() - kick)) <= tol);
+				}
+				kicked += kick != 0;
+			}
+		}
+	}
+	assert(kicked > 0);
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+	LatticeFunctionTable twiss(model.get(), beam_energy);
+	twiss.Calculate();
+
+	ParticleBunch bunch(beam_energy, 1);
+	for(int n = 0; n < 50; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		p.ct() = (n - 25) * 0.01;
+		p.yp() = 1e-6 * n;
+		bunch.push_back(p);
+	}
+
+	// voltage failure of the ATLAS cavities
+	CCFailureProcess proc(1, 0, model.get(), &twiss, omega, crossing, 0.0, non_fail_turns, fail_turns);
+	find_voltages(model.get(), proc, true);
+	find_voltages(model.get(), proc, false);
+	for(const Cavity& c : cavities)
+	{
+		cout << c.marker->GetName() << " V = " << c.V << endl;
+		assert(std::isfinite(c.V) && c.V != 0);
+	}
+	proc.InitialiseProcess(bunch);
+	track(proc, bunch, true, false, 0.0);
+
+	// phase failure of the downstream ATLAS cavities, with a nonzero crab phase
+	const double phi_s = 0.1;
+	CCFailureProcess phase_proc(1, 0, model.get(), &twiss, omega, crossing, phi_s, non_fail_turns, fail_turns);
+	phase_proc.SetFailurePlanes(true, false);
+	phase_proc.InitialiseProcess(bunch);
+	track(phase_proc, bunch, true, true, phi_s);
+
+	// voltage failure of the CMS cavities alone
+	CCFailureProcess cms_proc(1, 0, model.get(), &twiss, omega, crossing, 0.0, non_fail_turns, fail_turns);
+	cms_proc.SetFailurePlanes(false, true);
+	cms_proc.InitialiseProcess(bunch);
+	track(cms_proc, bunch, false, false, 0.0);
+
+	// particles with invalid coordinates are removed
+	CCFailureProcess cull(1, 0, model.get(), &twiss, omega, crossing, 0.0, non_fail_turns, fail_turns);
+	cull.InitialiseProcess(bunch);
+	bunch.GetParticles()[7].x() = numeric_limits<double>::quiet_NaN();
+	cull.SetCurrentComponent(*cavities[0].marker);
+	cull.DoProcess(0);
+	assert(bunch.size() == 49);
+	for(const PSvector& p : bunch)
+	{
+		assert(p.id() != 7);
+	}
+
+	return 0;
+}
@@ -0,0 +1,211 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "Components.h"
+#include "CollimatorWakeProcess.h"
+#include "ParticleBunch.h"
+#include "ParticleBunchUtilities.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "NumericalConstants.h"
+#include "TaperedCollimatorPotentials.h"
+
+/*
+ * Apply the modal wake of a tapered collimator with CollimatorWakeProcess,
+ * and compare the kicks with a direct calculation of the modal moments
+ * and wakes, mode by mode, from r and theta. A second pass with the same
+ * binning, or with a slightly longer bunch, must reuse the tabulated wake
+ * potentials, but new potentials must not, even at the address of deleted
+ * ones.
+ */
+
+using namespace std;
+using namespace ParticleTracking;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+const int nmodes = 4;
+const size_t nbins = 60;
+const double nsig = 3.0;
+
+// the slice width as CollimatorWakeProcess rounds it, to 64 steps in each factor of two
+double slice_width(double sigz)
+{
+	const double dz = 2 * nsig * sigz / nbins;
+	return pow(2.0, ceil(log2(dz) * 64) / 64);
+}
+
+class CountingPotentials: public TaperedCollimatorPotentials
+{
+public:
+	CountingPotentials(int m, double a, double b) :
+		TaperedCollimatorPotentials(m, a, b), ncalls(0)
+	{
+	}
+	double Wtrans(double z, int m) const
+	{
+		ncalls++;
+		return TaperedCollimatorPotentials::Wtrans(z, m);
+	}
+	mutable int ncalls;
+};
+
+// the modal wake kicks as CollimatorWakeProcess calculated them before it used powers of x + iy
+void reference_wake(ParticleBunch& bunch, const CollimatorWakePotentials& wake)
+{
+	bunch.SortByCT();
+	pair<double, double> v = bunch.GetMoments(ps_CT);
+	const double dz = slice_width(v.second);
+	const double zmin = v.first - 0.5 * nbins * dz;
+	const double zmax = v.first + 0.5 * nbins * dz;
+	vector<ParticleBunch::iterator> slices;
+	vector<double> Qd, Qdp;
+	const size_t lost = ParticleBinList(bunch, zmin, zmax, nbins, slices, Qd, Qdp);
+	assert(lost == 0);
+
+	vector<vector<double> > Cm(nmodes + 1, vector<double>(nbins, 0)), Sm = Cm;
+	for(int m = 1; m <= nmodes; m++)
+	{
+		for(size_t n = 0; n < nbins; n++)
+		{
+			for(ParticleBunch::iterator p = slices[n]; p != slices[n + 1]; p++)
+			{
+				const double r = sqrt(p->x() * p->x() + p->y() * p->y());
+				const double theta = atan2(p->y(), p->x());
+				Cm[m][n] += pow(r, m) * cos(m * theta);
+				Sm[m][n] += pow(r, m) * sin(m * theta);
+			}
+		}
+	}
+
+	const double a0 = bunch.GetTotalCharge() / bunch.size() * ElectronCharge * Volt / (4 * pi * FreeSpacePermittivity);
+	const double p0 = bunch.GetReferenceMomentum();
+	for(int m = 1; m <= nmodes; m++)
+	{
+		vector<double> wct(nbins, 0), wst(nbins, 0), wcl(nbins, 0), wsl(nbins, 0);
+		for(size_t i = 0; i < nbins; i++)
+		{
+			for(size_t j = i; j < nbins; j++)
+			{
+				wct[i] += wake.Wtrans((j - i) * dz, m) * Cm[m][j];
+				wst[i] += wake.Wtrans((j - i) * dz, m) * Sm[m][j];
+				wcl[i] += wake.Wlong((j - i) * dz, m) * Cm[m][j];
+				wsl[i] += wake.Wlong((j - i) * dz, m) * Sm[m][j];
+			}
+		}
+		for(size_t n = 0; n < nbins; n++)
+		{
+			for(ParticleBunch::iterator p = slices[n]; p != slices[n + 1]; p++)
+			{
+				const double r = sqrt(p->x() * p->x() + p->y() * p->y());
+				const double theta = atan2(p->y(), p->x());
+				const double c = cos((m - 1) * theta), s = sin((m - 1) * theta);
+				const double wake_x = a0 * m * pow(r, m - 1) * (c * wct[n] + s * wst[n]);
+				const double wake_y = a0 * m * pow(r, m - 1) * (c * wst[n] - s * wct[n]);
+				const double wake_z = a0 * pow(r, m) * (cos(m * theta) * wcl[n] - sin(m * theta) * wsl[n]);
+				const double ddp = -wake_z / p0;
+				p->dp() += ddp;
+				p->xp() = (p->xp() + wake_x / p0) / (1 + ddp);
+				p->yp() = (p->yp() + wake_y / p0) / (1 + ddp);
+			}
+		}
+	}
+}
+
+int main()
+{
+	// bounded in ct, so that no particle lies outside the binning
+	ParticleBunch bunch(450.0, 1.15e11);
+	const int np = 20000;
+	for(int i = 0; i < np; i++)
+	{
+		Particle p(0);
+		p.id() = i;
+		p.x() = 1e-3 * sin(12.9898 * i);
+		p.y() = 8e-4 * cos(78.233 * i);
+		p.xp() = 1e-6 * sin(0.1 * i);
+		p.ct() = 0.15 * sin(4.1 * i);
+		bunch.push_back(p);
+	}
+	ParticleBunch expected(bunch);
+	ParticleBunch initial(bunch);
+
+	CollimatorWakeProcess proc(nmodes, 0, nbins, nsig);
+	CountingPotentials wake(nmodes, 2e-3, 20e-3);
+	wake.SetExpectedProcess(&proc);
+	Drift collimator("C1", 1.0);
+	collimator.SetWakePotentials(&wake);
+
+	proc.InitialiseProcess(bunch);
+	proc.SetCurrentComponent(collimator);
+	assert(proc.IsActive());
+	proc.DoProcess(1.0);
+	const int ncalls = wake.ncalls;
+	assert(ncalls == int(nmodes * nbins));
+
+	reference_wake(expected, TaperedCollimatorPotentials(nmodes, 2e-3, 20e-3));
+	assert(bunch.size() == expected.size());
+
+	// compare the kicks given to each particle
+	double max_kick = 0, max_diff = 0;
+	for(size_t i = 0; i < bunch.size(); i++)
+	{
+		const Particle& p = bunch.GetParticles()[i];
+		const Particle& e = expected.GetParticles()[i];
+		assert(p.id() == e.id());
+		const Particle& p0 = initial.GetParticles()[int(p.id())];
+		for(int k : {1, 3, 5})
+		{
+			max_kick = max(max_kick, fabs(e[k] - p0[k]));
+			max_diff = max(max_diff, fabs(p[k] - e[k]));
+		}
+	}
+	cout << "largest kick " << max_kick << " difference " << max_diff << endl;
+	assert(max_kick > 0);
+	assert(max_diff <= 1e-9 * max_kick);
+
+	// the same binning again uses the same wake table
+	proc.SetCurrentComponent(collimator);
+	assert(proc.IsActive());
+	proc.DoProcess(1.0);
+	assert(wake.ncalls == ncalls);
+
+	// and so does a bunch stretched by less than the rounding of the slice width
+	const double sigz = bunch.GetMoments(ps_CT).second;
+	const double stretch = 1 + 0.5 * (slice_width(sigz) / (2 * nsig * sigz / nbins) - 1);
+	assert(stretch > 1);
+	for(Particle& p : bunch)
+	{
+		p.ct() *= stretch;
+	}
+	proc.SetCurrentComponent(collimator);
+	assert(proc.IsActive());
+	proc.DoProcess(1.0);
+	assert(wake.ncalls == ncalls);
+
+	// potentials made at the address of deleted ones have a table of their own
+	alignas(CountingPotentials) unsigned char storage[sizeof(CountingPotentials)];
+	for(double a : {2e-3, 3e-3})
+	{
+		CountingPotentials* w = new(storage) CountingPotentials(nmodes, a, 20e-3);
+		w->SetExpectedProcess(&proc);
+		collimator.SetWakePotentials(w);
+		proc.SetCurrentComponent(collimator);
+		assert(proc.IsActive());
+		proc.DoProcess(1.0);
+		assert(w->ncalls == ncalls);
+		w->~CountingPotentials();
+	}
+
+	return 0;
+}
@@ -0,0 +1,125 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "ClosedOrbit.h"
+#include "Components.h"
+#include "DynamicAperture.h"
+#include "NumericalConstants.h"
+#include "ParticleBunch.h"
+#include "ParticleTracker.h"
+
+/*
+ * Scan the dynamic aperture of a FODO ring with sextupoles, and check
+ * that each boundary lies between a surviving and a lost particle
+ * within the tolerance, and that a particle at the boundary tracked
+ * on its own survives.
+ */
+
+using namespace std;
+
+const double beam_energy = 450.0;
+const int ncells = 8;
+const int nturns = 100;
+const double loss_radius = 0.1;
+
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.sextupoles = 2;
+	ring.k2f = 2.0;
+	ring.k2d = -2.0;
+	return ring.Build();
+}
+
+bool survives(AcceleratorModel* model, const DynamicAperture::Boundary& b)
+{
+	PSvector p(0);
+	p.dp() = b.dp;
+	ClosedOrbit co(model, beam_energy);
+	co.TransverseOnly(true);
+	co.FindClosedOrbit(p);
+	p.x() += b.amplitude * cos(b.angle);
+	p.y() += b.amplitude * sin(b.angle);
+
+	ParticleBunch bunch(beam_energy, 1.0);
+	bunch.push_back(p);
+	ParticleTracker tracker(model->GetRing(), &bunch, false);
+	for(int turn = 0; turn < nturns; turn++)
+	{
+		tracker.Track(&bunch);
+		const Particle& q = bunch.FirstParticle();
+		if(!(fabs(q.x()) <= loss_radius && fabs(q.y()) <= loss_radius))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+
+	const double tol = 1e-4;
+	DynamicAperture da(model.get(), beam_energy);
+	da.SetTurns(nturns);
+	da.SetLossRadius(loss_radius);
+	da.SetAmplitudeRange(0, 0.05);
+	da.SetTolerance(tol);
+	da.Scan({0.2, 0.8, 1.4}, {0, 1e-3});
+	da.OutputBoundary(cout);
+
+	const vector<DynamicAperture::Boundary>& boundary = da.GetBoundary();
+	const vector<DynamicAperture::Trial>& trials = da.GetTrials();
+	assert(boundary.size() == 6);
+
+	for(const DynamicAperture::Boundary& b : boundary)
+	{
+		assert(b.amplitude > 0 && b.amplitude < 0.05);
+		bool inside = false;
+		bool outside = false;
+		for(const DynamicAperture::Trial& t : trials)
+		{
+			if(t.angle != b.angle || t.dp != b.dp)
+			{
+				continue;
+			}
+			if(t.amplitude == b.amplitude)
+			{
+				inside = t.turns == nturns;
+			}
+			if(t.amplitude > b.amplitude && t.amplitude <= b.amplitude + tol)
+			{
+				outside = t.turns < nturns;
+			}
+		}
+		assert(inside && outside);
+	}
+	assert(survives(model.get(), boundary[1]));
+
+	// lost particles are retired early
+	int lost = 0;
+	for(const DynamicAperture::Trial& t : trials)
+	{
+		if(t.turns < nturns / 2)
+		{
+			lost++;
+		}
+	}
+	assert(lost > 0);
+
+	cout << "dynamic_aperture_test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,115 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <complex>
+#include <iostream>
+#include <memory>
+
+#include "Components.h"
+#include "FrequencyMap.h"
+#include "NumericalConstants.h"
+#include "TransferMatrix.h"
+
+/*
+ * Check the frequency analysis on a synthetic signal, then find the
+ * tunes of a grid of particles in a FODO ring: without sextupoles
+ * the tunes are the linear ones, and with sextupoles the tune changes
+ * with amplitude and large amplitudes are lost.
+ */
+
+using namespace std;
+
+const double beam_energy = 450.0;
+const int ncells = 8;
+
+AcceleratorModel* build_ring(double k2)
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.sextupoles = 2;
+	ring.k2f = k2;
+	ring.k2d = -k2;
+	return ring.Build();
+}
+
+double linear_tune(const RealMatrix& R, int i)
+{
+	double q = acos((R(i, i) + R(i + 1, i + 1)) / 2) / twoPi;
+	return R(i, i + 1) < 0 ? 1 - q : q;
+}
+
+PSvectorArray make_grid(double step)
+{
+	PSvectorArray grid;
+	for(int i = 1; i <= 4; i++)
+	{
+		for(int j = 1; j <= 4; j++)
+		{
+			PSvector p(0);
+			p.x() = i * step;
+			p.y() = j * step;
+			grid.push_back(p);
+		}
+	}
+	return grid;
+}
+
+int main()
+{
+	// a main line and a weaker harmonic
+	const int n = 300;
+	vector<complex<double>> z(n);
+	for(int t = 0; t < n; t++)
+	{
+		z[t] = polar(1.0, twoPi * 0.31234567 * t) + 0.1 * polar(1.0, twoPi * 0.62469134 * t);
+	}
+	cout << "synthetic tune " << FrequencyMap::FindTune(&z[0], n) << endl;
+	assert_close(FrequencyMap::FindTune(&z[0], n), 0.31234567, 1e-8);
+
+	// linear ring
+	unique_ptr<AcceleratorModel> linear(build_ring(0));
+	RealMatrix R(6, 6);
+	TransferMatrix tm(linear.get(), beam_energy);
+	tm.FindTM(R);
+	const double Qx = linear_tune(R, 0);
+	const double Qy = linear_tune(R, 2);
+
+	FrequencyMap fma(linear.get(), beam_energy);
+	fma.Track(make_grid(1e-5), 128);
+	for(const FrequencyMap::Point& pt : fma.GetPoints())
+	{
+		assert(pt.stable);
+		assert_close(pt.Qx, Qx, 1e-6);
+		assert_close(pt.Qy, Qy, 1e-6);
+		assert(pt.diffusion < -6 && pt.diffusion >= -16);
+	}
+
+	// nonlinear ring: detuning with amplitude, and losses
+	unique_ptr<AcceleratorModel> ring(build_ring(2.0));
+	PSvectorArray grid = make_grid(1e-3);
+	PSvector lost(0);
+	lost.x() = 0.2;
+	grid.push_back(lost);
+
+	FrequencyMap fma2(ring.get(), beam_energy);
+	fma2.Track(grid, 128);
+	fma2.Output(cout);
+	const vector<FrequencyMap::Point>& pts = fma2.GetPoints();
+	assert(pts.size() == grid.size());
+	assert(pts[0].stable);
+	assert_close(pts[0].Qx, Qx, 1e-3);
+	assert(fabs(pts[12].Qx - pts[0].Qx) > 1e-4);
+	assert(!pts.back().stable);
+	assert(pts.back().turns < 256);
+
+	cout << "frequency_map_test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,133 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+
+#include "HollowElectronLens.h"
+#include "HollowELensProcess.h"
+#include "NumericalConstants.h"
+#include "ParticleBunchTypes.h"
+#include "PhysicalUnits.h"
+
+/*
+ * Check the kick table of HollowELensProcess against the direct
+ * evaluation of each radial profile, that the table follows changes
+ * of the lens settings, and that the kicks applied to a bunch in the
+ * DC and AC modes are those of the profile along the direction of
+ * each particle.
+ */
+
+using namespace std;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+const double beam_energy = 7000.0;
+
+// largest difference of the table from the profile, relative to the largest kick
+double compare_profile(HollowELensProcess& proc, bool simple)
+{
+	double d = 0;
+	double scale = 0;
+	for(int i = 0; i <= 2000; i++)
+	{
+		const double R = i * 5e-6;
+		const double k = simple ? proc.CalcKickSimple(R) : proc.CalcKickRadial(R);
+		d = max(d, fabs(proc.CalcKick(R) - k));
+		scale = max(scale, fabs(k));
+	}
+	assert(scale > 0);
+	return d / scale;
+}
+
+int main()
+{
+	ProtonBunch bunch(beam_energy, 1);
+	for(int i = -40; i <= 40; i++)
+	{
+		for(int j = -3; j <= 3; j++)
+		{
+			Particle p(0);
+			p.x() = i * 0.15 * millimeter;
+			p.y() = j * i * 0.05 * millimeter;
+			p.xp() = 1e-6 * j;
+			bunch.push_back(p);
+		}
+	}
+
+	HollowElectronLens hel("hel1", 0, 0, 5, 0.195, 2.334948339E4, 3.0);
+	hel.SetRadii(2 * millimeter, 5 * millimeter);
+
+	HollowELensProcess proc(3);
+	proc.InitialiseProcess(bunch);
+	proc.SetCurrentComponent(hel);
+	assert(proc.IsActive());
+
+	// each profile, with each electron direction
+	for(int dir = 0; dir < 2; dir++)
+	{
+		hel.ElectronDirection = dir;
+		hel.SetPerfectProfile();
+		assert(compare_profile(proc, true) < 1e-13);
+
+		hel.SetRadialProfile();
+		hel.LHC_Radial = 0;
+		assert(compare_profile(proc, false) < 1e-13);
+
+		hel.SetLHCRadialProfile();
+		assert(compare_profile(proc, false) < 1e-13);
+	}
+
+	// changed settings
+	hel.SetRadii(3 * millimeter, 6 * millimeter);
+	hel.Current = 2;
+	assert(compare_profile(proc, false) < 1e-13);
+	hel.SetPerfectProfile();
+	assert(compare_profile(proc, true) < 1e-13);
+	assert(proc.CalcKick(3 * millimeter) == 0 && proc.CalcKick(0) == 0);
+
+	// DC kicks on a bunch, with the lens offset from the axis
+	hel.XOffset = 0.2 * millimeter;
+	hel.YOffset = -0.1 * millimeter;
+	const PSvectorArray before = bunch.GetParticles();
+	proc.DoProcess(0);
+	assert(bunch.size() == before.size());
+
+	int kicked = 0;
+	for(size_t n = 0; n < bunch.size(); n++)
+	{
+		const Particle& p = bunch.GetParticles()[n];
+		Particle p0 = before[n];
+		const double theta = proc.CalcKickSimple(p0);
+		const double angle = atan2(p0.y(), p0.x());
+		assert(p.x() == p0.x() && p.y() == p0.y());
+		assert(fabs(p.xp() - p0.xp() - theta * cos(angle)) < 1e-20);
+		assert(fabs(p.yp() - p0.yp() - theta * sin(angle)) < 1e-20);
+		kicked += theta != 0;
+	}
+	assert(kicked > 100);
+
+	// AC kicks are scaled by the modulation of the turn
+	hel.SetAC(0.31, .002, 5E-5, 1E3, 2.);
+	const PSvectorArray before_ac = bunch.GetParticles();
+	proc.DoProcess(0);
+	const double OpTune = hel.MinTune + fmod(floor(hel.Turn / hel.TurnsPerStep), hel.Nstep) * hel.TuneVarPerStep;
+	const double factor = 0.5 * (1 + cos(hel.Multiplier * (hel.Turn * OpTune * 2 * pi)));
+	assert(factor > 0.1);
+	for(size_t n = 0; n < bunch.size(); n++)
+	{
+		const Particle& p = bunch.GetParticles()[n];
+		Particle p0 = before_ac[n];
+		const double theta = proc.CalcKickSimple(p0) * factor;
+		const double angle = atan2(p0.y(), p0.x());
+		assert(fabs(p.xp() - p0.xp() - theta * cos(angle)) < 1e-20);
+		assert(fabs(p.yp() - p0.yp() - theta * sin(angle)) < 1e-20);
+	}
+
+	return 0;
+}
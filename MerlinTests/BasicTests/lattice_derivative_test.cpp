@@ -0,0 +1,126 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "LatticeFunctions.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "StdIntegrators.h"
+#include "SymplecticIntegrators.h"
+
+/*
+ * Find the energy derivatives of the closed orbit of a ring with an
+ * RF cavity with LatticeFunctionTable::CalculateEnergyDerivative(),
+ * and check them against separate tables at the positive and
+ * negative bend path length scales, with the default TRANSPORT
+ * integrators and with the symplectic ones, which the two offset
+ * calculations cannot share at the same time. Check that the
+ * transfer matrix file is only written when asked for.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+const double beam_energy = 450.0;
+const int ncells = 8;
+
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.kq = 0.04;
+	ring.sextupoles = 1;
+	ring.k2f = 0.2;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ring.AppendCells(ctor);
+	ctor.AppendComponent(new SWRFStructure("RF", 2, 400e6, 2e5, M_PI / 2));
+	return ctor.GetModel();
+}
+
+bool exists(const char* filename)
+{
+	ifstream f(filename);
+	return f.good();
+}
+
+// check the energy derivative of the orbit against separate tables at each bend path length scale
+void check_derivative(AcceleratorModel* model)
+{
+	LatticeFunctionTable table(model, beam_energy);
+	table.UseOrbitFunctions();
+	table.ScaleBendPathLength(1e-6);
+	table.CalculateEnergyDerivative();
+
+	LatticeFunctionTable tableP(model, beam_energy);
+	LatticeFunctionTable tableM(model, beam_energy);
+	tableP.UseOrbitFunctions();
+	tableM.UseOrbitFunctions();
+	tableP.AddFunction(6, 0, 0);
+	tableM.AddFunction(6, 0, 0);
+	tableP.ScaleBendPathLength(1e-6);
+	tableM.ScaleBendPathLength(-1e-6);
+	tableP.Calculate();
+	tableM.Calculate();
+
+	const double dp = tableP.Value(6, 0, 0, 0) - tableM.Value(6, 0, 0, 0);
+	assert(fabs(dp) > 1e-7);
+	assert(table.NumberOfRows() == tableP.NumberOfRows());
+
+	double dmax = 0;
+	double diff = 0;
+	for(int n = 0; n < table.NumberOfRows(); n++)
+	{
+		assert(table.Value(0, 0, 0, n) == tableM.Value(0, 0, 0, n));
+		for(int i = 1; i <= 4; i++)
+		{
+			const double d = (tableP.Value(i, 0, 0, n) - tableM.Value(i, 0, 0, n)) / dp;
+			dmax = max(dmax, fabs(d));
+			diff = max(diff, fabs(table.Value(i, 0, 0, n) - d));
+		}
+	}
+	cout << "derivative: max " << dmax << ", difference " << diff << endl;
+	assert(dmax > 1);
+	assert(diff < 1e-9 * dmax);
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+	remove("TransferMatrix.dat");
+
+	check_derivative(model.get());
+	assert(!exists("TransferMatrix.dat"));
+
+	ParticleComponentTracker::SetDefaultIntegratorSet(new SYMPLECTIC::StdISet());
+	check_derivative(model.get());
+	ParticleComponentTracker::SetDefaultIntegratorSet(new TRANSPORT::StdISet());
+
+	// the matrices are written only when asked for
+	LatticeFunctionTable optics(model.get(), beam_energy);
+	optics.Calculate();
+	assert(!exists("TransferMatrix.dat"));
+	optics.WriteMatrices(true);
+	optics.Calculate();
+	assert(exists("TransferMatrix.dat"));
+	remove("TransferMatrix.dat");
+
+	return 0;
+}
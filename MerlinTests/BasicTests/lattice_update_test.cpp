@@ -0,0 +1,141 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "CorrectorDipoles.h"
+#include "LatticeFunctions.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+
+/*
+ * Change a quadrupole, a corrector and the alignment of an element
+ * in a ring with sextupoles, and check that the lattice functions
+ * found by LatticeFunctionTable::Update() agree with those of a new
+ * table, and that only the changed elements are tracked again.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+const double beam_energy = 450.0;
+const double brho = beam_energy / eV / SpeedOfLight;
+const int ncells = 8;
+
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.sextupoles = 1;
+	ring.k2f = 0.2;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new XCor("MCH", 0.5));
+	ring.AppendCells(ctor);
+	return ctor.GetModel();
+}
+
+// largest difference between the updated table and a new one
+double compare(LatticeFunctionTable& table, AcceleratorModel* model, bool orbitonly)
+{
+	LatticeFunctionTable fresh(model, beam_energy);
+	if(orbitonly)
+	{
+		fresh.UseOrbitFunctions();
+	}
+	fresh.Calculate();
+	assert(fresh.NumberOfRows() == table.NumberOfRows());
+
+	const int cols[][3] = {{0, 0, 0}, {1, 0, 0}, {2, 0, 0}, {3, 0, 0}, {4, 0, 0}, {1, 1, 1}, {1, 2, 1}, {3, 3, 2}};
+	const int ncols = orbitonly ? 5 : 8;
+	double d = 0;
+	for(int n = 0; n < table.NumberOfRows(); n++)
+	{
+		for(int c = 0; c < ncols; c++)
+		{
+			const double v = fresh.Value(cols[c][0], cols[c][1], cols[c][2], n);
+			const double u = table.Value(cols[c][0], cols[c][1], cols[c][2], n);
+			d = max(d, fabs(u - v) / (1e-3 + fabs(v)));
+		}
+	}
+	return d;
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+	const int nelm = 1 + 5 * ncells;
+
+	LatticeFunctionTable table(model.get(), beam_energy);
+	table.Calculate();
+	assert(table.NumberOfRows() == nelm + 1);
+	assert(table.NumberOfUpdatedElements() == nelm);
+
+	LatticeFunctionTable orbit(model.get(), beam_energy);
+	orbit.UseOrbitFunctions();
+	orbit.Calculate();
+
+	// nothing to do
+	table.Update();
+	assert(table.NumberOfUpdatedElements() == 0);
+
+	// one quadrupole on the closed orbit
+	vector<Quadrupole*> qf;
+	model->ExtractTypedElements(qf, "QF.3");
+	qf[0]->SetFieldStrength(qf[0]->GetFieldStrength() * 1.02);
+	const double beta0 = table.Value(1, 1, 1, 0);
+	table.Update();
+	cout << "quadrupole: " << table.NumberOfUpdatedElements() << " elements, " << compare(table, model.get(), false)
+		 << endl;
+	assert(table.NumberOfUpdatedElements() == 1);
+	assert(table.Value(1, 1, 1, 0) != beta0);
+	assert(compare(table, model.get(), false) < 1e-6);
+
+	// the corrector moves the orbit through the sextupoles
+	vector<XCor*> xcor;
+	model->ExtractTypedElements(xcor, "MCH");
+	xcor[0]->SetFieldStrength(1e-4 * brho / 0.5);
+	table.Update();
+	cout << "corrector: " << table.NumberOfUpdatedElements() << " elements, " << compare(table, model.get(), false)
+		 << endl;
+	assert(fabs(table.Value(1, 0, 0, 10)) > 1e-5);
+	assert(compare(table, model.get(), false) < 1e-6);
+
+	orbit.Update();
+	cout << "orbit only: " << orbit.NumberOfUpdatedElements() << " elements, " << compare(orbit, model.get(), true)
+		 << endl;
+	assert(compare(orbit, model.get(), true) < 1e-6);
+
+	// a misaligned quadrupole, with a coarse tolerance to re-track only that element
+	model->ExtractTypedElements(qf, "QD.5");
+	AcceleratorModel::Beamline bl = model->GetBeamline();
+	for(auto f = bl.begin(); f != bl.end(); f++)
+	{
+		if(&(*f)->GetComponent() == qf[1])
+		{
+			(*f)->Translate(0, 1e-5, 0);
+		}
+	}
+	table.SetUpdateTolerance(1e-3);
+	table.Update();
+	cout << "alignment: " << table.NumberOfUpdatedElements() << " elements, " << compare(table, model.get(), false)
+		 << endl;
+	assert(table.NumberOfUpdatedElements() == 1);
+	assert(compare(table, model.get(), false) < 1e-6);
+
+	cout << "lattice_update_test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,165 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "ClosedOrbit.h"
+#include "Components.h"
+#include "CorrectorDipoles.h"
+#include "LinearMapTracker.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "TransferMatrix.h"
+
+/*
+ * Compare the transfer matrix and closed orbit found by linear map
+ * concatenation, and the closed orbit found by the quasi-Newton
+ * search, with those found by finite difference tracking, on a small
+ * ring with skew, nonlinear and tilted elements, an orbit offset, an
+ * RF cavity and a misaligned quadrupole.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+const double beam_energy = 7000.0;
+const double brho = beam_energy / eV / SpeedOfLight;
+
+AcceleratorModel* build_ring()
+{
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+
+	ctor.AppendComponent(new XCor("HCOR", 0, 2e-4 * brho));
+	for(int n = 0; n < 4; n++)
+	{
+		ctor.AppendComponent(new Quadrupole("MQF." + to_string(n), 3.0, 200.0));
+		ctor.AppendComponent(new Drift("D1." + to_string(n), 2.0));
+		ctor.AppendComponent(new Sextupole("MS." + to_string(n), 0.5, n % 2 ? -2000.0 : 3000.0));
+		SectorBend* mb = new SectorBend("MB." + to_string(n), 14.0, 0.004, 0.004 * brho);
+		if(n == 1)
+		{
+			mb->SetPoleFaceInfo(new SectorBend::PoleFace(0.02, 0.5, 0.04));
+		}
+		if(n == 2)
+		{
+			mb->GetGeometry().SetTilt(0.01);
+		}
+		ctor.AppendComponent(mb);
+		ctor.AppendComponent(new Quadrupole("MQD." + to_string(n), 3.0, -200.0));
+		ctor.AppendComponent(new SkewQuadrupole("MSQ." + to_string(n), 0.3, 5.0));
+		ctor.AppendComponent(new Drift("D2." + to_string(n), 2.0));
+		ctor.AppendComponent(new BPM("BPM." + to_string(n), 0));
+	}
+	ctor.AppendComponent(new SWRFStructure("RF", 2, 400e6, 2e5, M_PI / 2));
+	ctor.AppendComponent(new Marker("END"));
+	return ctor.GetModel();
+}
+
+int main()
+{
+	const double p0 = beam_energy;
+	unique_ptr<AcceleratorModel> model(build_ring());
+
+	// misalign one quadrupole
+	AcceleratorModel::Beamline bl = model->GetBeamline();
+	(*(bl.begin() + 5))->Translate(1e-4, -2e-4, 0);
+
+	PSvector orbit(0);
+	orbit.x() = 1e-3;
+	orbit.yp() = -2e-5;
+	orbit.dp() = 1e-4;
+
+	// one pass: the RF cavity and the misaligned quadrupole are found numerically
+	LinearMapTracker lmt(p0);
+	RealMatrix M(6, 6);
+	PSvector out = orbit;
+	int frames = 0;
+	lmt.SetObserver([&](ComponentFrame*, const PSvector&, const RealMatrix&) {
+		frames++;
+	});
+	lmt.Track(model->GetRing(), out, M);
+	assert(lmt.GetNumericalCount() == 2);
+	assert(frames == std::distance(bl.begin(), bl.end()));
+
+	TransferMatrix tm(model.get(), p0);
+	tm.SetDelta(1e-9);
+	RealMatrix Mtrack(6, 6);
+	tm.UseMapConcatenation(false);
+	tm.FindTM(Mtrack, orbit);
+	RealMatrix Mmap(6, 6);
+	tm.UseMapConcatenation(true);
+	tm.FindTM(Mmap, orbit);
+	cout << "ring map difference " << max_rel_diff(Mmap, Mtrack) << endl;
+	assert(max_rel_diff(Mmap, Mtrack) < 1e-5);
+	assert(max_rel_diff(Mmap, M) == 0);
+
+	// a section of the lattice, with the orbit offset by the corrector
+	tm.UseMapConcatenation(false);
+	tm.FindTM(Mtrack, orbit, 3, 20);
+	tm.UseMapConcatenation(true);
+	tm.FindTM(Mmap, orbit, 3, 20);
+	cout << "beamline map difference " << max_rel_diff(Mmap, Mtrack) << endl;
+	assert(max_rel_diff(Mmap, Mtrack) < 1e-5);
+
+	// the closed orbit agrees with the one found by tracking
+	PSvector co_track(0), co_map(0);
+	ClosedOrbit co(model.get(), p0);
+	co.FindClosedOrbit(co_track);
+	assert(co.w < 1e-20);
+	ClosedOrbit co1(model.get(), p0);
+	co1.UseMapConcatenation(true);
+	co1.FindClosedOrbit(co_map);
+	assert(co1.w < 1e-20);
+	cout << "closed orbit " << co_map;
+	assert(fabs(co_map.x()) > 1e-5);
+	for(int k = 0; k < 6; k++)
+	{
+		assert(fabs(co_map[k] - co_track[k]) < 1e-10);
+	}
+
+	// quasi-Newton search by tracking, and again from the kept Jacobian after a change to the corrector
+	ClosedOrbit qn(model.get(), p0);
+	qn.UseQuasiNewton(true);
+	PSvector co_qn(0);
+	qn.FindClosedOrbit(co_qn);
+	cout << "quasi-Newton iterations " << qn.iter << endl;
+	assert(qn.w < 1e-20);
+	for(int k = 0; k < 6; k++)
+	{
+		assert(fabs(co_qn[k] - co_track[k]) < 1e-10);
+	}
+
+	vector<XCor*> hcor;
+	model->ExtractTypedElements(hcor, "HCOR");
+	hcor[0]->SetFieldStrength(hcor[0]->GetFieldStrength() * 1.1);
+	co_qn = PSvector(0);
+	qn.FindClosedOrbit(co_qn);
+	cout << "quasi-Newton iterations " << qn.iter << ", particles tracked " << qn.tracked << endl;
+	assert(qn.w < 1e-20);
+	co_track = PSvector(0);
+	co.FindClosedOrbit(co_track);
+	cout << "Newton iterations " << co.iter << ", particles tracked " << co.tracked << endl;
+
+	// the warm restart tracks one particle per iteration rather than seven, so it
+	// tracks far fewer particles than a cold Newton search
+	assert(qn.tracked * 2 < co.tracked);
+	for(int k = 0; k < 6; k++)
+	{
+		assert(fabs(co_qn[k] - co_track[k]) < 1e-10);
+	}
+
+	cout << "linear_map_test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,141 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <iostream>
+#include <memory>
+#include <thread>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "TComponentFrame.h"
+
+/*
+ * Check the AcceleratorModel name and type queries, which use an index,
+ * against a plain scan of the lattice.
+ */
+
+using namespace std;
+
+/// Lattice indices of components whose qualified name matches pat
+vector<size_t> scan_indexes(AcceleratorModel* model, const string& pat)
+{
+	StringPattern p(pat);
+	vector<size_t> result;
+	AcceleratorModel::Beamline bl = model->GetBeamline();
+	size_t n = 0;
+	for(auto i = bl.begin(); i != bl.end(); i++, n++)
+	{
+		if(p((*i)->GetComponent().GetQualifiedName()))
+		{
+			result.push_back(n);
+		}
+	}
+	return result;
+}
+
+int main()
+{
+	const size_t ncells = 20;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	double z = 0;
+	auto append = [&](AcceleratorComponent* c) {
+		ctor.AppendComponent(c);
+		c->SetComponentLatticePosition(z);
+		z += c->GetLength();
+	};
+	for(size_t n = 0; n < ncells; n++)
+	{
+		string cell = to_string(n);
+		append(new Quadrupole("MQF." + cell, 1.0, 0.1));
+		append(new Drift("D1." + cell, 2.0));
+		append(new Quadrupole("MQD." + cell, 1.0, -0.1));
+		append(new Drift("D2." + cell, 2.0));
+		append(new Marker("M." + cell));
+	}
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+	for(string pat : {"*", "Quadrupole.MQF.1", "Quadrupole.MQF.1*", "Quadrupole.*", "*.D1.*", "Drift.D2.1*|Marker.*",
+			"Quadrupole.MQ*.1?", "Nothing.*", "Quadrupole.MQF."})
+	{
+		vector<size_t> expected = scan_indexes(model.get(), pat);
+		assert(model->GetIndexes(pat) == expected);
+
+		vector<ComponentFrame*> frames;
+		model->ExtractComponents(pat, frames);
+		assert(frames.size() == expected.size());
+	}
+
+	// sub-beamline
+	AcceleratorModel::Beamline bl = model->GetBeamline(10, 30);
+	vector<size_t> idx;
+	model->GetIndexes(bl, "Quadrupole.*", idx);
+	assert(idx.size() == 9 && idx.front() == 10 && idx.back() == 30);
+
+	// beamline between named elements, including the n-th occurrence
+	bl = model->GetBeamline("Quadrupole.MQF.2", "Marker.M.4");
+	assert(bl.first_index() == 10 && bl.last_index() == 24);
+	bl = model->GetBeamline("Quadrupole.MQ*", "Quadrupole.MQ*", 2, 3);
+	assert(bl.first_index() == 2 && bl.last_index() == 10);
+	assert_throws(model->GetBeamline("Quadrupole.MQF.1", "Marker.X"), AcceleratorModel::BadRange);
+
+	// typed elements
+	vector<Quadrupole*> quads;
+	model->ExtractTypedElements(quads);
+	assert(quads.size() == 2 * ncells);
+	quads.clear();
+	model->ExtractTypedElements(quads, "MQF.1*");
+	assert(quads.size() == 11);
+	quads.clear();
+	model->ExtractTypedElements(quads, "MQD.3");
+	assert(quads.size() == 1 && quads[0]->GetName() == "MQD.3");
+	vector<Drift*> drifts;
+	model->ExtractTypedElements(drifts, "MQD.3");
+	assert(drifts.empty());
+	vector<AcceleratorComponent*> components;
+	model->ExtractTypedElements(components);
+	assert(components.size() == 5 * ncells);
+
+	// position in the lattice ordered list of components
+	assert(model->FindElementLatticePosition("MQF.0") == 0);
+	assert(model->FindElementLatticePosition("MQD.1") == 7);
+	assert(model->FindElementLatticePosition("none") == 0);
+
+	// the index is rebuilt safely when first queried from several threads at once
+	model->InvalidateIndex();
+	vector<size_t> nquads(4), nmarkers(4);
+	vector<int> positions(4);
+	vector<thread> threads;
+	for(size_t t = 0; t < 4; t++)
+	{
+		threads.emplace_back([&, t]()
+		{
+			vector<Marker*> markers;
+			nquads[t] = model->GetIndexes("Quadrupole.MQF.*").size();
+			nmarkers[t] = model->ExtractTypedElements(markers);
+			positions[t] = model->FindElementLatticePosition("MQD.1");
+		});
+	}
+	for(thread& th : threads)
+	{
+		th.join();
+	}
+	for(size_t t = 0; t < 4; t++)
+	{
+		assert(nquads[t] == ncells && nmarkers[t] == ncells && positions[t] == 7);
+	}
+
+	// adding an element updates the index
+	model->InstallModelElement(new Marker("NEW"), 7.0);
+	assert(model->GetIndexes("Marker.NEW").size() == 1);
+	assert(model->GetIndexes("Drift.D1.1_part*").size() == 2);
+	assert(model->GetIndexes("Drift.D1.1").empty());
+
+	cout << "model_index_test passed" << endl;
+	return 0;
+}
@@ -0,0 +1,170 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+#include <typeinfo>
+#include <vector>
+
+#include "AcceleratorModelConstructor.h"
+#include "AcceleratorModelSnapshot.h"
+#include "Aperture.h"
+#include "CollimatorAperture.h"
+#include "Components.h"
+#include "MaterialDatabase.h"
+#include "MerlinException.h"
+
+/*
+ * Write a small ring to a snapshot, read it back and compare the
+ * components, fields and apertures.
+ */
+
+using namespace std;
+
+template<class T>
+T* find_element(AcceleratorModel* model, const string& name)
+{
+	vector<T*> found;
+	model->ExtractTypedElements(found, name);
+	assert(found.size() == 1);
+	return found[0];
+}
+
+AcceleratorModel* build_ring(MaterialDatabase& materials, vector<unique_ptr<Aperture> >& apertures)
+{
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	apertures.emplace_back(CircularAperture::getInstance("CIRCLE", 0, 0, 0, 0.022, 0));
+	Aperture* pipe = apertures.back().get();
+	double z = 0;
+	auto append = [&](AcceleratorComponent* c) {
+		ctor.AppendComponent(c);
+		c->SetComponentLatticePosition(z);
+		c->SetAperture(pipe);
+		z += c->GetLength();
+	};
+
+	Collimator* tcp = new Collimator("TCP", 0.6, materials.FindMaterial("C"), 7000);
+	tcp->SetCollID(3);
+	CollimatorAperture* jaw = new CollimatorAperture(0.002, 0.1, 0.3, 0.6, 1e-4, 0);
+	jaw->SetExitWidth(0.003);
+	apertures.emplace_back(jaw);
+	append(tcp);
+	tcp->SetAperture(apertures.back().get());
+
+	for(int n = 0; n < 4; n++)
+	{
+		Quadrupole* q = new Quadrupole("MQ." + to_string(n), 3.1, n % 2 ? -20.0 : 20.0);
+		q->GetField().SetCoefficient(5, Complex(1e-4, -2e-4));
+		append(q);
+		append(new Drift("D." + to_string(n), 1.5));
+		SectorBend* mb = new SectorBend("MB." + to_string(n), 14.3, 0.0012, 8.3);
+		if(n == 0)
+		{
+			mb->SetPoleFaceInfo(new SectorBend::PoleFace(0.01, 0.5, 0.02), new SectorBend::PoleFace(0.02));
+		}
+		else if(n == 1)
+		{
+			mb->SetPoleFaceInfo(new SectorBend::PoleFace(0.01));
+		}
+		append(mb);
+		append(new Marker("M." + to_string(n)));
+	}
+	append(new SWRFStructure("RF", 2, 400e6, 5e6, 0.1));
+	append(new BPM("BPM", 0.1, 0.05));
+	return ctor.GetModel();
+}
+
+int main()
+{
+	MaterialDatabase materials;
+	vector<unique_ptr<Aperture> > apertures;
+	unique_ptr<AcceleratorModel> model(build_ring(materials, apertures));
+	const string filename = "model_snapshot_test.model";
+
+	ModelSnapshotKey key;
+	key.Add("ring");
+	key.Add(7000.0);
+	ModelSnapshotKey other = key;
+	other.Add(1.0);
+	assert(key.Value() != other.Value());
+
+	assert(AcceleratorModelSnapshot::Read(filename + ".missing", key.Value()) == nullptr);
+	AcceleratorModelSnapshot::Write(model.get(), filename, key.Value());
+	assert(AcceleratorModelSnapshot::Read(filename, other.Value(), &materials) == nullptr);
+	assert_throws(AcceleratorModelSnapshot::Read(filename, key.Value()), MerlinException);
+
+	unique_ptr<AcceleratorModel> copy(AcceleratorModelSnapshot::Read(filename, key.Value(), &materials));
+	assert(copy);
+
+	AcceleratorModel::Beamline bl0 = model->GetBeamline();
+	AcceleratorModel::Beamline bl1 = copy->GetBeamline();
+	assert(std::distance(bl0.begin(), bl0.end()) == std::distance(bl1.begin(), bl1.end()));
+	for(auto i = bl0.begin(), j = bl1.begin(); i != bl0.end(); i++, j++)
+	{
+		AcceleratorComponent& a = (*i)->GetComponent();
+		AcceleratorComponent& b = (*j)->GetComponent();
+		assert(typeid(**i) == typeid(**j));
+		assert(a.GetQualifiedName() == b.GetQualifiedName());
+		// RF cavities are rebuilt from the cell count and frequency
+		assert(fabs(a.GetLength() - b.GetLength()) <= 1e-12 * a.GetLength());
+		assert(a.GetComponentLatticePosition() == b.GetComponentLatticePosition());
+		Aperture* ap = b.GetAperture();
+		assert(ap && ap->getType() == a.GetAperture()->getType());
+		assert(ap->getRectHalfWidth() == a.GetAperture()->getRectHalfWidth());
+		assert(dynamic_cast<CollimatorAperture*>(ap) || ap->getEllipHalfWidth() == a.GetAperture()->getEllipHalfWidth());
+	}
+
+	for(int n = 0; n < 4; n++)
+	{
+		string name = "MQ." + to_string(n);
+		const MultipoleField& f0 = find_element<Quadrupole>(model.get(), name)->GetField();
+		const MultipoleField& f1 = find_element<Quadrupole>(copy.get(), name)->GetField();
+		assert(f0.GetFieldScale() == f1.GetFieldScale());
+		assert(f0.HighestMultipole() == f1.HighestMultipole());
+		for(int k = 0; k <= f0.HighestMultipole(); k++)
+		{
+			assert(f0.GetCoefficient(k) == f1.GetCoefficient(k));
+		}
+	}
+
+	SectorBend* mb = find_element<SectorBend>(copy.get(), "MB.0");
+	assert(mb->GetGeometry().GetCurvature() == 0.0012 && mb->GetB0() == 8.3);
+	const SectorBend::PoleFaceInfo& pf0 = mb->GetPoleFaceInfo();
+	assert(pf0.entrance != pf0.exit && pf0.entrance->fint == 0.5 && pf0.exit->rot == 0.02);
+	const SectorBend::PoleFaceInfo& pf1 = find_element<SectorBend>(copy.get(), "MB.1")->GetPoleFaceInfo();
+	assert(pf1.entrance && pf1.entrance == pf1.exit && pf1.entrance->rot == 0.01);
+	assert(!find_element<SectorBend>(copy.get(), "MB.2")->GetPoleFaceInfo().entrance);
+
+	Collimator* tcp = find_element<Collimator>(copy.get(), "TCP");
+	assert(tcp->GetCollID() == 3);
+	assert(tcp->GetMaterial() == materials.FindMaterial("C"));
+	CollimatorAperture* jaw = dynamic_cast<CollimatorAperture*>(tcp->GetAperture());
+	assert(jaw && jaw->GetFullEntranceWidth() == 0.002 && jaw->GetCollimatorTilt() == 0.3);
+	assert(jaw->GetEntranceXOffset() == 1e-4 && jaw->GetFullExitWidth() == 0.003);
+
+	SWRFStructure* rf = find_element<SWRFStructure>(copy.get(), "RF");
+	assert(rf->GetAmplitude() == 5e6 && rf->GetPhase() == 0.1);
+	assert(fabs(rf->GetFrequency() - 400e6) < 1e-3);
+
+	// a stale snapshot is replaced by a new build
+	int builds = 0;
+	auto build = [&]() {
+		builds++;
+		return build_ring(materials, apertures);
+	};
+	delete AcceleratorModelSnapshot::Cached(filename, other.Value(), build, &materials);
+	delete AcceleratorModelSnapshot::Cached(filename, other.Value(), build, &materials);
+	assert(builds == 1);
+
+	std::remove(filename.c_str());
+	cout << "model_snapshot_test passed" << endl;
+	return 0;
+}
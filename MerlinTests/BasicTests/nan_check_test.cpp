@@ -0,0 +1,86 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "Drift.h"
+#include "NANCheckProcess.h"
+#include "ParticleBunch.h"
+
+/*
+ * Check NANCheckProcess::AllFinite() with a NaN or infinity in each
+ * coordinate of particles in different places in the bunch, and that
+ * culling removes just the invalid particles.
+ */
+
+using namespace std;
+using namespace ParticleTracking;
+
+int main()
+{
+	const double nan = numeric_limits<double>::quiet_NaN();
+	const double inf = numeric_limits<double>::infinity();
+
+	PSvectorArray particles(37);
+	for(size_t n = 0; n < particles.size(); n++)
+	{
+		for(int i = 0; i < 6; i++)
+		{
+			particles[n][i] = 1e300 * (i % 2 ? 1 : -1) + n;
+		}
+		particles[n].id() = n;
+	}
+	assert(NANCheckProcess::AllFinite(particles));
+	assert(NANCheckProcess::AllFinite(PSvectorArray()));
+
+	for(size_t n : {size_t(0), size_t(17), particles.size() - 1})
+	{
+		for(int i = 0; i < 6; i++)
+		{
+			for(double bad : {nan, inf, -inf})
+			{
+				PSvectorArray p = particles;
+				p[n][i] = bad;
+				assert(!NANCheckProcess::AllFinite(p));
+			}
+		}
+	}
+
+	// the extra coordinates are not checked
+	PSvectorArray q = particles;
+	q[3].sd() = nan;
+	assert(NANCheckProcess::AllFinite(q));
+
+	ParticleBunch bunch(450.0, 1e11);
+	for(const PSvector& p : particles)
+	{
+		bunch.push_back(p);
+	}
+	bunch.GetParticles()[5].xp() = nan;
+	bunch.GetParticles()[20].ct() = inf;
+	const double q0 = bunch.GetTotalCharge() / bunch.size();
+
+	Drift drift("D", 1.0);
+	NANCheckProcess check;
+	check.SetCullNAN();
+	check.InitialiseProcess(bunch);
+	check.SetCurrentComponent(drift);
+	check.DoProcess(0);
+
+	assert(bunch.size() == particles.size() - 2);
+	assert(NANCheckProcess::AllFinite(bunch.GetParticles()));
+	assert(fabs(bunch.GetTotalCharge() / bunch.size() - q0) < 1e-6 * q0);
+	for(const PSvector& p : bunch)
+	{
+		assert(p.id() != 5 && p.id() != 20);
+	}
+
+	return 0;
+}
@@ -0,0 +1,161 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "BPM.h"
+#include "ClosedOrbit.h"
+#include "Components.h"
+#include "CorrectorDipoles.h"
+#include "NumericalConstants.h"
+#include "OrbitResponseMatrix.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+
+/*
+ * Find the orbit response matrix of a ring with sextupoles, on an
+ * orbit displaced by a corrector, from the linear maps and by
+ * tracking, and check both against the change of the closed orbit
+ * found by ClosedOrbit for each corrector in turn. Then check the
+ * trajectory response of the same lattice as a transfer line.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+const double beam_energy = 450.0;
+const double brho = beam_energy / eV / SpeedOfLight;
+const int ncells = 6;
+
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.sextupoles = 1;
+	ring.k2f = 0.5;
+	ring.correctors = true;
+	ring.bpms = true;
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new XCor("MCX", 0.5, 2e-4 * brho / 0.5));
+	ring.AppendCells(ctor);
+	return ctor.GetModel();
+}
+
+// largest difference relative to the largest element
+double compare(const RealMatrix& A, const RealMatrix& B)
+{
+	assert(A.nrows() == B.nrows() && A.ncols() == B.ncols());
+	double d = 0;
+	double scale = 0;
+	for(size_t i = 0; i < A.nrows(); i++)
+	{
+		for(size_t j = 0; j < A.ncols(); j++)
+		{
+			d = max(d, fabs(A(i, j) - B(i, j)));
+			scale = max(scale, fabs(B(i, j)));
+		}
+	}
+	return d / scale;
+}
+
+// closed orbit at the entrance of element n
+PSvector closed_orbit(AcceleratorModel* model, int n)
+{
+	PSvector p(0);
+	ClosedOrbit co(model, beam_energy);
+	co.TransverseOnly(true);
+	co.FindClosedOrbit(p, n);
+	return p;
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+
+	vector<XCor*> xcors;
+	vector<YCor*> ycors;
+	vector<BPM*> bpms;
+	model->ExtractTypedElements(xcors, "MCH.*");
+	model->ExtractTypedElements(ycors, "MCV.*");
+	model->ExtractTypedElements(bpms, "BPM.*");
+	assert(xcors.size() == ncells && ycors.size() == ncells && bpms.size() == ncells);
+
+	OrbitResponseMatrix orm(model.get(), beam_energy);
+	orm.SetDelta(1e-7 * brho);
+	orm.AddCorrectors(xcors);
+	orm.AddCorrectors(ycors);
+	orm.AddBPMs(bpms, true);
+	orm.AddBPMs(bpms, false);
+
+	const RealMatrix R = orm.Calculate();
+	const RealMatrix RT = orm.CalculateByTracking();
+	assert(R.nrows() == 2 * ncells && R.ncols() == 2 * ncells);
+	cout << "ring, maps - tracking: " << compare(R, RT) << endl;
+	assert(compare(R, RT) < 2e-5);
+
+	// no coupling between the planes
+	for(int i = 0; i < ncells; i++)
+	{
+		for(int j = 0; j < ncells; j++)
+		{
+			assert(fabs(R(ncells + i, j)) < 1e-10 && fabs(R(i, ncells + j)) < 1e-10);
+			assert(fabs(R(i, j)) > 1e-4);
+		}
+	}
+
+	// each corrector in turn
+	RealMatrix RB(2 * ncells, 2 * ncells);
+	vector<RectMultipole*> cors(xcors.begin(), xcors.end());
+	cors.insert(cors.end(), ycors.begin(), ycors.end());
+	const int idx[] = {1, 9, 17, 25, 33, 41};
+	for(size_t c = 0; c < cors.size(); c++)
+	{
+		const double b = cors[c]->GetFieldStrength();
+		for(int n = 0; n < ncells; n++)
+		{
+			const PSvector p0 = closed_orbit(model.get(), idx[n]);
+			cors[c]->SetFieldStrength(b + 1e-7 * brho);
+			const PSvector p1 = closed_orbit(model.get(), idx[n]);
+			cors[c]->SetFieldStrength(b);
+			RB(n, c) = (p1.x() - p0.x()) / (1e-7 * brho);
+			RB(ncells + n, c) = (p1.y() - p0.y()) / (1e-7 * brho);
+		}
+	}
+	cout << "ring, maps - closed orbit: " << compare(R, RB) << endl;
+	assert(compare(R, RB) < 2e-5);
+
+	// as a transfer line, from an offset initial orbit
+	PSvector x0(0);
+	x0.x() = 1e-3;
+	x0.yp() = -1e-4;
+	orm.SetRing(false);
+	orm.SetInitialOrbit(x0);
+	const RealMatrix L = orm.Calculate();
+	const RealMatrix LT = orm.CalculateByTracking();
+	cout << "line, maps - tracking: " << compare(L, LT) << endl;
+	assert(compare(L, LT) < 2e-5);
+
+	// only the BPMs after a corrector see it
+	for(int n = 0; n < ncells; n++)
+	{
+		for(int c = 0; c < ncells; c++)
+		{
+			assert((L(n, c) == 0) == (n <= c));
+			assert((L(ncells + n, ncells + c) == 0) == (n <= c));
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include <iostream>
+#include <cmath>
+
+#include "../tests.h"
+#include "BeamData.h"
+#include "BunchFilter.h"
+#include "ParticleBunch.h"
+#include "ParticleBunchUtilities.h"
+#include "RandomNG.h"
+#include "ParticleDistributionGenerator.h"
+#include "HaloParticleDistributionGenerator.h"
+
+using namespace std;
+using namespace ParticleTracking;
+
+/*
+ * Check GenerateBunchParticles()
+ *
+ * Same seed gives identical particles
+ * Unfiltered normal bunch has the right size, centroid and rms
+ * Tail generator only gives particles beyond the cut, with the right mean amplitude
+ * Filtered generation only keeps particles passing the filter
+ *
+ */
+
+int main(int argc, char* argv[])
+{
+	const size_t npart = 200000;
+	RandomNG::init(1);
+
+	BeamData beam;
+	beam.emit_x = 2;
+	beam.emit_y = 3;
+	beam.beta_x = 4;
+	beam.beta_y = 1;
+	beam.x0 = 1;
+	beam.p0 = 1;
+
+	// reproducibility
+	NormalParticleDistributionGenerator normal;
+	PSvectorArray pa, pb;
+	GenerateBunchParticles(pa, npart, normal, beam);
+	RandomNG::reset();
+	GenerateBunchParticles(pb, npart, normal, beam);
+	assert(pa.size() == npart);
+	assert(pb.size() == npart);
+	for(size_t i = 0; i < npart; i++)
+	{
+		for(int j = 0; j < PS_LENGTH; j++)
+		{
+			assert(pa[i][j] == pb[i][j]);
+		}
+		assert(pa[i].id() == i);
+	}
+
+	// first particle is the centroid, moments match the beam
+	assert(pa[0].x() == beam.x0);
+	ParticleBunch bunch(beam.p0, beam.charge, pa);
+	auto mx = bunch.GetMoments(ps_X);
+	auto my = bunch.GetMoments(ps_Y);
+	assert_close(mx.first, beam.x0, 1e-2);
+	assert_close(mx.second, sqrt(beam.emit_x * beam.beta_x), 1e-2);
+	assert_close(my.second, sqrt(beam.emit_y * beam.beta_y), 1e-2);
+
+	// direct tail sampling
+	const double cut = 6.0;
+	HorizontalHaloTailParticleDistributionGenerator tail(cut);
+	PSvectorArray pt;
+	size_t filtered = GenerateBunchParticles(pt, npart, tail, beam);
+	assert(filtered == 0);
+	assert(pt.size() == npart);
+	double sig_x = sqrt(beam.emit_x * beam.beta_x);
+	double mean_amp = 0;
+	for(size_t i = 1; i < npart; i++)
+	{
+		double xn = fabs(pt[i].x() - beam.x0) / sig_x;
+		assert(xn >= cut);
+		mean_amp += xn;
+	}
+	mean_amp /= (npart - 1);
+	// E(|x| : |x| > a) = phi(a) / Q(a)
+	double expected = sqrt(2 / M_PI) * exp(-cut * cut / 2) / erfc(cut / sqrt(2));
+	cout << "tail mean amplitude " << mean_amp << " expected " << expected << endl;
+	assert_close(mean_amp, expected, 1e-2);
+
+	// filtered generation
+	HorizontalHaloParticleBunchFilter filter;
+	filter.SetHorizontalLimit(1.5 * sig_x);
+	filter.SetHorizontalOrbit(beam.x0);
+	PSvectorArray pf;
+	filtered = GenerateBunchParticles(pf, 10000, normal, beam, &filter, 1000);
+	assert(pf.size() == 10000);
+	assert(filtered > 0);
+	for(size_t i = 1; i < pf.size(); i++)
+	{
+		assert(filter.Apply(pf[i]));
+	}
+
+	cout << "Done" << endl;
+	return 0;
+}
@@ -0,0 +1,167 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "ParticleBunch.h"
+#include "ParticleRecorder.h"
+
+/*
+ * Record a bunch at three observation points, two found by name and one
+ * by position, over several turns with ParticleRecorder, selecting particles by id, by scattering and by
+ * amplitude, and check that reading the file back gives exactly the
+ * selected particles, in order, when the rows are written in several
+ * chunks.
+ */
+
+using namespace std;
+using namespace ParticleTracking;
+
+const int nturns = 6;
+const double beta_x = 20, alpha_x = -1.5, beta_y = 35, alpha_y = 0.5;
+
+// the bunch changes on each turn, and loses a particle
+void change_bunch(ParticleBunch& bunch, int turn)
+{
+	for(Particle& p : bunch)
+	{
+		p.x() += 1e-5 * turn;
+		p.yp() -= 1e-7 * p.id();
+		if(int(p.id()) % 5 == turn % 5)
+		{
+			p.type() = 1;
+		}
+	}
+	bunch.erase(bunch.begin() + turn);
+}
+
+bool amplitude_ok(const PSvector& p)
+{
+	const double ux = alpha_x * p.x() + beta_x * p.xp();
+	const double uy = alpha_y * p.y() + beta_y * p.yp();
+	const double a = sqrt((p.x() * p.x() + ux * ux) / beta_x + (p.y() * p.y() + uy * uy) / beta_y);
+	return a >= 1e-3 && a <= 4e-3;
+}
+
+int main()
+{
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new Drift("D1", 1.0));
+	ctor.AppendComponent(new Marker("OBS1"));
+	ctor.AppendComponent(new Quadrupole("Q1", 0.5, 0.1));
+	ctor.AppendComponent(new Drift("D2", 2.0));
+	ctor.AppendComponent(new Marker("OBS2"));
+	ctor.AppendComponent(new Marker("OTHER"));
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+	ParticleBunch bunch(450.0, 1e11);
+	for(int n = 0; n < 100; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		p.type() = -1;
+		p.x() = 1e-4 * (n - 50);
+		p.xp() = 2e-6 * (n % 13);
+		p.y() = -3e-5 * n;
+		p.yp() = 1e-6 * (n % 7);
+		p.ct() = n;
+		bunch.push_back(p);
+	}
+
+	const vector<int> ids = {3, 4, 17, 18, 40, 41, 42, 60, 77, 78, 79, 95, 250};
+	vector<char> in_ids(100, 0);
+	for(int id : ids)
+	{
+		if(id < 100)
+		{
+			in_ids[id] = 1;
+		}
+	}
+
+	vector<ParticleRecorder::Columns> expected(3);
+	size_t total = 0;
+	{
+		ParticleRecorder recorder("particle_recorder_test.dat", 7);
+		recorder.AddObservationPoint("*.OBS*");
+		recorder.AddObservationRange(2.6, 2.4);
+		recorder.SelectIds(ids);
+		recorder.SelectScattered();
+		recorder.SelectAmplitude(1e-3, 4e-3, beta_x, alpha_x, beta_y, alpha_y);
+
+		for(int turn = 0; turn < nturns; turn++)
+		{
+			// everything is recorded on the last turn
+			if(turn == nturns - 1)
+			{
+				recorder.ClearSelection();
+			}
+			assert(recorder.GetTurn() == turn);
+
+			AcceleratorModel::Beamline bline = model->GetBeamline();
+			int point = 0;
+			for(AcceleratorModel::BeamlineIterator f = bline.begin(); f != bline.end(); f++)
+			{
+				recorder.DoRecord(*f, &bunch);
+
+				const string name = (*f)->GetComponent().GetName();
+				if(name.compare(0, 3, "OBS") == 0 || name == "D2")
+				{
+					for(const Particle& p : bunch)
+					{
+						const bool all = turn == nturns - 1;
+						if(all || (in_ids[int(p.id())] && p.type() != -1 && amplitude_ok(p)))
+						{
+							ParticleRecorder::Columns& c = expected[point];
+							c.turn.push_back(turn);
+							c.id.push_back(p.id());
+							for(int k = 0; k < 6; k++)
+							{
+								c.coord[k].push_back(p[k]);
+							}
+							total++;
+						}
+					}
+					point++;
+				}
+			}
+			assert(point == 3);
+			assert(recorder.GetNumberOfPoints() == 3);
+
+			recorder.DoRecordFinalBunch(&bunch);
+			change_bunch(bunch, turn);
+		}
+	}
+	cout << "selected " << total - 3 * (100 - nturns + 1) << " rows before the last turn" << endl;
+	assert(total > 3 * (100 - nturns + 1) + 10);
+
+	vector<string> points;
+	vector<ParticleRecorder::Columns> data;
+	ParticleRecorder::Read("particle_recorder_test.dat", points, data);
+	assert(points.size() == 3);
+	assert(points[0] == "Marker.OBS1" && points[1] == "Drift.D2" && points[2] == "Marker.OBS2");
+	for(int point = 0; point < 3; point++)
+	{
+		const ParticleRecorder::Columns& c = data[point];
+		const ParticleRecorder::Columns& e = expected[point];
+		assert(c.size() == e.size() && c.size() > 0);
+		assert(c.turn == e.turn && c.id == e.id);
+		for(int k = 0; k < 6; k++)
+		{
+			assert(c.coord[k] == e.coord[k]);
+		}
+	}
+	remove("particle_recorder_test.dat");
+
+	return 0;
+}
@@ -0,0 +1,137 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <iostream>
+#include <sstream>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "PhysicalUnits.h"
+#include "ParticleBunchTypes.h"
+#include "ParticleTracker.h"
+#include "ScopeProfiler.h"
+
+/*
+ * Check the ScopeProfiler
+ *
+ * Nothing is recorded while disabled
+ * Nested user scopes give the expected call tree
+ * Tracking records element type, element and process scopes with particle counts
+ * Output formats contain the expected entries
+ */
+
+using namespace std;
+using namespace PhysicalUnits;
+
+const ScopeProfiler::Entry* find_entry(const vector<ScopeProfiler::Entry>& entries, const vector<string>& path)
+{
+	for(auto& e : entries)
+	{
+		if(e.path.size() != path.size())
+		{
+			continue;
+		}
+		bool match = true;
+		for(size_t i = 0; i < path.size(); i++)
+		{
+			match = match && ScopeProfiler::GetScopeName(e.path[i]) == path[i];
+		}
+		if(match)
+		{
+			return &e;
+		}
+	}
+	return nullptr;
+}
+
+int main(int argc, char* argv[])
+{
+	auto outer = ScopeProfiler::RegisterScope("outer");
+	auto inner = ScopeProfiler::RegisterScope("inner");
+	assert(ScopeProfiler::RegisterScope("outer") == outer);
+	assert(ScopeProfiler::GetScopeName(inner) == "inner");
+
+	// disabled: nothing recorded
+	{
+		ProfileScope s(outer, 1);
+	}
+	assert(ScopeProfiler::GetEntries().empty());
+
+	ScopeProfiler::Enable();
+	for(int i = 0; i < 10; i++)
+	{
+		ProfileScope o(outer, 5);
+		volatile double x = 0;
+		for(int j = 0; j < 1000; j++)
+		{
+			x += j;
+		}
+		ProfileScope in(inner, 2);
+	}
+
+	auto entries = ScopeProfiler::GetEntries();
+	auto eo = find_entry(entries, {"outer"});
+	auto ei = find_entry(entries, {"outer", "inner"});
+	assert(eo && ei);
+	assert(eo->calls == 10 && eo->particles == 50);
+	assert(ei->calls == 10 && ei->particles == 20);
+	assert(eo->total_time >= ei->total_time);
+	assert(eo->self_time <= eo->total_time);
+
+	// tracking
+	ScopeProfiler::Reset();
+	assert(ScopeProfiler::GetEntries().empty());
+
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new Drift("d1", 1 * meter));
+	ctor.AppendComponent(new Quadrupole("q1", 1 * meter, 0.01));
+	ctor.AppendComponent(new Drift("d2", 1 * meter));
+	AcceleratorModel* model = ctor.GetModel();
+
+	const size_t npart = 100;
+	ProtonBunch bunch(7000, 1);
+	for(size_t i = 0; i < npart; i++)
+	{
+		Particle p(0);
+		p.x() = 1e-4 * i;
+		bunch.push_back(p);
+	}
+
+	AcceleratorModel::Beamline beamline = model->GetBeamline();
+	ParticleTracker tracker(beamline, &bunch, false);
+	for(int turn = 0; turn < 3; turn++)
+	{
+		tracker.Track(&bunch);
+	}
+	ScopeProfiler::Disable();
+
+	entries = ScopeProfiler::GetEntries();
+	auto etype = find_entry(entries, {"Drift"});
+	auto eelem = find_entry(entries, {"Drift", "Drift.d1"});
+	auto eproc = find_entry(entries, {"Quadrupole", "Quadrupole.q1", "TRANSPORT"});
+	assert(etype && eelem && eproc);
+	assert(etype->calls == 6);
+	assert(eelem->calls == 3);
+	assert(eelem->particles == 3 * npart);
+	assert(eproc->calls == 3);
+	assert(eproc->particles == 3 * npart);
+
+	ostringstream csv, json, folded, summary;
+	ScopeProfiler::WriteCSV(csv);
+	ScopeProfiler::WriteJSON(json);
+	ScopeProfiler::WriteFoldedStacks(folded);
+	ScopeProfiler::WriteSummary(summary);
+	cout << summary.str() << endl;
+	assert(csv.str().find("\"Quadrupole;Quadrupole.q1;TRANSPORT\",process,3,300,") != string::npos);
+	assert(json.str().find("\"name\": \"Drift.d2\", \"kind\": \"element\"") != string::npos);
+	assert(folded.str().find("Drift;Drift.d1;TRANSPORT") != string::npos || folded.str().empty());
+
+	delete model;
+	cout << "test successful" << endl;
+}
@@ -0,0 +1,180 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "SMPBunch.h"
+#include "SMPSliceMap.h"
+#include "SMPTracker.h"
+#include "TransportRMap.h"
+
+/*
+ * Check that SliceMap maps the centroid and moments of a slice as the
+ * sparse RMap does, that SMPBunch::GetMoments agrees with a direct sum
+ * over the slices, and that tracking a bunch of many slices through a
+ * beamline gives each slice the same result as tracking it on its own.
+ */
+
+using namespace std;
+using namespace SMPTracking;
+
+// a slice with an uncorrelated offset and a positive definite 4x4 sigma matrix
+SliceMacroParticle make_slice(int n)
+{
+	SliceMacroParticle p(1.0 + 0.1 * (n % 5));
+	for(int i = 0; i < 6; i++)
+	{
+		p[i] = 1e-4 * sin(1.3 * n + 0.7 * i);
+	}
+	p.ct() = 1e-5 * (n - 50);
+	p.dp() = 2e-3 * sin(0.37 * n);
+
+	double A[4][4];
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j < 4; j++)
+		{
+			A[i][j] = (i == j ? 1e-3 : 2e-4 * cos(0.9 * n + 1.7 * i + 2.3 * j)) * (i % 2 ? 0.1 : 1);
+		}
+	}
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j <= i; j++)
+		{
+			double s = 0;
+			for(int k = 0; k < 4; k++)
+			{
+				s += A[i][k] * A[j][k];
+			}
+			p(i, j) = s;
+		}
+	}
+	return p;
+}
+
+// largest difference relative to the size of each set of values
+double difference(const SliceMacroParticle& a, const SliceMacroParticle& b)
+{
+	double dx = 0, x = 0, ds = 0, s = 0;
+	for(int i = 0; i < 6; i++)
+	{
+		dx = max(dx, fabs(a[i] - b[i]));
+		x = max(x, fabs(b[i]));
+	}
+	for(int i = 0; i < 4; i++)
+	{
+		for(int j = 0; j <= i; j++)
+		{
+			ds = max(ds, fabs(a(i, j) - b(i, j)));
+			s = max(s, fabs(b(i, j)));
+		}
+	}
+	return max(dx / x, ds / s);
+}
+
+void check_map(const RMap& M, const char* name)
+{
+	double worst = 0;
+	for(int n = 0; n < 50; n++)
+	{
+		SliceMacroParticle a = make_slice(n), b = a, c = a, d = a;
+		SliceMap(M).Apply(a);
+		M.Apply(b);
+		worst = max(worst, difference(a, b));
+
+		SliceMap(M, 1.01).Apply(c);
+		map_applicator_dp<RMap, SliceMacroParticle>(M, 1.01)(d);
+		worst = max(worst, difference(c, d));
+		assert(c.dp() == d.dp());
+	}
+	cout << name << " " << worst << endl;
+	assert(worst < 1e-13);
+}
+
+SMPBunch* make_bunch(int first, int last)
+{
+	SMPBunch* bunch = new SMPBunch(250.0, 1.0);
+	for(int n = first; n < last; n++)
+	{
+		bunch->AddParticle(make_slice(n));
+	}
+	return bunch;
+}
+
+int main()
+{
+	// each kind of map used by the SMP integrators
+	RMap bend, quad, solenoid, rotation, pole_face, cavity;
+	TransportRMap::SectorBend(2.0, 0.01, 0.05, bend);
+	check_map(bend, "sector bend");
+	TransportRMap::Quadrupole(0.5, -0.3, quad);
+	check_map(quad, "quadrupole");
+	TransportRMap::Solenoid(1.5, 0.2, 0, true, true, solenoid);
+	check_map(solenoid, "solenoid");
+	TransportRMap::Srot(0.3, rotation);
+	check_map(rotation, "rotation");
+	TransportRMap::PoleFaceRot(0.01, 0.1, 0.5, 0.02, pole_face);
+	check_map(pole_face, "pole face");
+	TransportRMap::TWRFCavity(1.0, 30e-3, 1.3e9, 0.1, 250.0, true, false, cavity);
+	check_map(cavity, "cavity");
+
+	// moments of the whole bunch
+	unique_ptr<SMPBunch> bunch(make_bunch(0, 200));
+	PSmoments sigma, expected;
+	bunch->GetMoments(sigma);
+	const double Qt = bunch->GetTotalCharge();
+	for(const SliceMacroParticle& x : *bunch)
+	{
+		const double w = x.Q() / Qt;
+		for(int i = 0; i < 6; i++)
+		{
+			expected[i] += w * x[i];
+			for(int j = 0; j <= i; j++)
+			{
+				expected(i, j) += w * (x[i] * x[j] + x(i, j));
+			}
+		}
+	}
+	for(int i = 0; i < 6; i++)
+	{
+		assert(fabs(sigma[i] - expected[i]) <= 1e-12 * fabs(expected[i]) + 1e-20);
+		for(int j = 0; j <= i; j++)
+		{
+			expected(i, j) -= expected[i] * expected[j];
+			assert(fabs(sigma(i, j) - expected(i, j)) <= 1e-10 * sqrt(expected(i, i) * expected(j, j)));
+		}
+	}
+
+	// each slice tracks as if it were alone
+	AcceleratorModelConstructor ctor;
+	ctor.NewModel();
+	ctor.AppendComponent(new Drift("D1", 1.0));
+	ctor.AppendComponent(new Quadrupole("Q1", 0.5, 20.0));
+	ctor.AppendComponent(new SectorBend("B1", 3.0, 1e-3, 250.0 / 0.299792458 * 1e-3));
+	ctor.AppendComponent(new Drift("D2", 2.0));
+	ctor.AppendComponent(new Solenoid("S1", 1.0, 2.0));
+	ctor.AppendComponent(new Quadrupole("Q2", 0.5, -20.0));
+	ctor.AppendComponent(new Marker("END"));
+	unique_ptr<AcceleratorModel> model(ctor.GetModel());
+
+	SMPTracker tracker(model->GetBeamline());
+	tracker.Track(bunch.get());
+	for(int n = 0; n < 200; n += 13)
+	{
+		unique_ptr<SMPBunch> single(make_bunch(n, n + 1));
+		SMPTracker single_tracker(model->GetBeamline());
+		single_tracker.Track(single.get());
+		assert(difference(bunch->Get(n), single->Get(0)) == 0);
+	}
+
+	return 0;
+}
@@ -0,0 +1,186 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#include <limits>
+
+#include "Components.h"
+#include "NANCheckProcess.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "SpinParticleProcess.h"
+
+/*
+ * Check that the spins of a SpinParticleBunch follow their particles
+ * when particles are erased, culled, sorted, swapped and cleared, and that
+ * SpinParticleProcess gives the expected precession in a sector bend
+ * and a solenoid, and in a quadrupole for particles off axis.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+
+const double beam_energy = 5.0;
+const double brho = beam_energy / eV / SpeedOfLight;
+const double gamma0 = beam_energy / (ElectronMassMeV * MeV);
+
+// spin x holds the id of each particle
+void check_sync(SpinParticleBunch& bunch)
+{
+	for(size_t n = 0; n < bunch.size(); n++)
+	{
+		assert(bunch.GetSpin(n).x() == bunch.GetParticles()[n].id());
+	}
+}
+
+void track(SpinParticleBunch& bunch, AcceleratorComponent& c, int nstep)
+{
+	SpinParticleProcess proc(1, nstep);
+	proc.InitialiseProcess(bunch);
+	proc.SetCurrentComponent(c);
+	assert(proc.IsActive());
+	for(int n = 0; n < nstep; n++)
+	{
+		proc.DoProcess(c.GetLength() / nstep);
+	}
+}
+
+void rotate(const Vector3D& w, double angle, SpinVector& s)
+{
+	const double W = sqrt(w.x * w.x + w.y * w.y + w.z * w.z);
+	const Vector3D a(w.x / W, w.y / W, w.z / W);
+	const Vector3D v(s.x(), s.y(), s.z());
+	const double d = a.x * v.x + a.y * v.y + a.z * v.z;
+	const Vector3D c(a.y * v.z - a.z * v.y, a.z * v.x - a.x * v.z, a.x * v.y - a.y * v.x);
+	s.x() = v.x * cos(angle) + c.x * sin(angle) + a.x * d * (1 - cos(angle));
+	s.y() = v.y * cos(angle) + c.y * sin(angle) + a.y * d * (1 - cos(angle));
+	s.z() = v.z * cos(angle) + c.z * sin(angle) + a.z * d * (1 - cos(angle));
+}
+
+bool close(const SpinVector& a, const SpinVector& b)
+{
+	return fabs(a.x() - b.x()) < 1e-12 && fabs(a.y() - b.y()) < 1e-12 && fabs(a.z() - b.z()) < 1e-12;
+}
+
+int main()
+{
+	// the spins follow the particles
+	SpinParticleBunch bunch(beam_energy, 1);
+	for(int n = 0; n < 12; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		p.ct() = (n * 7) % 12;
+		bunch.AddParticle(p, SpinVector(n, 0, 1));
+	}
+	bunch.erase(bunch.begin() + 2);
+	check_sync(bunch);
+
+	vector<char> lost(bunch.size(), 0);
+	lost[0] = lost[4] = lost[10] = 1;
+	bunch.RemoveParticles(lost);
+	assert(bunch.size() == 8);
+	check_sync(bunch);
+
+	bunch.GetParticles()[3].xp() = numeric_limits<double>::quiet_NaN();
+	const int bad = bunch.GetParticles()[3].id();
+	Drift drift("D", 1.0);
+	NANCheckProcess check;
+	check.SetCullNAN();
+	check.InitialiseProcess(bunch);
+	check.SetCurrentComponent(drift);
+	check.DoProcess(0);
+	assert(bunch.size() == 7);
+	check_sync(bunch);
+	for(const Particle& p : bunch)
+	{
+		assert(p.id() != bad);
+	}
+
+	bunch.SortByCT();
+	check_sync(bunch);
+	for(size_t n = 1; n < bunch.size(); n++)
+	{
+		assert(bunch.GetParticles()[n - 1].ct() <= bunch.GetParticles()[n].ct());
+	}
+
+	// through the base class, with another spin bunch and with a plain one
+	SpinParticleBunch other(beam_energy, 1);
+	for(int n = 20; n < 23; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		other.AddParticle(p, SpinVector(n, 0, 1));
+	}
+	ParticleBunch& base = bunch;
+	base.swap(other);
+	assert(bunch.size() == 3 && other.size() == 7);
+	check_sync(bunch);
+	check_sync(other);
+	ParticleBunch plain(beam_energy, 1);
+	plain.AddParticle(Particle(0));
+	other.swap(plain);
+	assert(other.size() == 1 && plain.size() == 7);
+	assert(other.GetSpin(0).z() == 1);
+
+	bunch.clear();
+	assert(bunch.size() == 0);
+	bunch.push_back(Particle(0));
+	assert(bunch.GetSpin(0).z() == 1);
+
+	// precession about the vertical field of a bend is G gamma times the bend angle, for any energy
+	const double h = 0.01;
+	const double L = 2.0;
+	SectorBend bend("B", L, h, h * brho);
+	SpinParticleBunch b1(beam_energy, 1);
+	for(double dp : {0.0, 0.01, -0.02})
+	{
+		Particle p(0);
+		p.dp() = dp;
+		b1.AddParticle(p, SpinVector(0, 0, 1));
+	}
+	track(b1, bend, 3);
+	const double phi = ElectronGe * gamma0 * h * L;
+	for(size_t n = 0; n < b1.size(); n++)
+	{
+		assert(close(b1.GetSpin(n), SpinVector(-sin(phi), 0, cos(phi))));
+	}
+
+	// and about the longitudinal field of a solenoid (1 + G) B L / Brho
+	const double Bz = 2.0;
+	Solenoid sol("S", L, Bz);
+	SpinParticleBunch b2(beam_energy, 1);
+	b2.AddParticle(Particle(0), SpinVector(1, 0, 0));
+	track(b2, sol, 1);
+	const double phis = (1 + ElectronGe) * Bz * L / brho;
+	assert(close(b2.GetSpin(0), SpinVector(cos(phis), -sin(phis), 0)));
+
+	// off axis in a quadrupole, about the local field
+	Quadrupole quad("Q", L, 0.1 * brho);
+	SpinParticleBunch b3(beam_energy, 1);
+	Particle q(0);
+	q.x() = 1e-3;
+	q.y() = -2e-3;
+	q.dp() = 0.005;
+	b3.AddParticle(q, SpinVector(0, 0.6, 0.8));
+	track(b3, quad, 1);
+
+	const Vector3D b = quad.GetEMField()->GetBFieldAt(Point3D(q.x(), q.y(), 0));
+	const double g = gamma0 * (1 + q.dp());
+	const Vector3D w(-(1 + ElectronGe * g) * b.x, -(1 + ElectronGe * g) * b.y, -(1 + ElectronGe) * b.z);
+	const double W = sqrt(w.x * w.x + w.y * w.y + w.z * w.z);
+	SpinVector s(0, 0.6, 0.8);
+	rotate(w, W * L / (brho * (1 + q.dp())), s);
+	cout << b3.GetSpin(0).x() << " " << b3.GetSpin(0).y() << " " << b3.GetSpin(0).z() << endl;
+	assert(close(b3.GetSpin(0), s));
+	assert(fabs(s.x()) > 1e-6);
+
+	return 0;
+}
@@ -0,0 +1,149 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include <cmath>
+#include <iostream>
+#ifdef ENABLE_OPENMP
+#include <omp.h>
+#endif
+
+#include "NumericalConstants.h"
+#include "ParticleBunchTypes.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+#include "RandomNG.h"
+#include "SectorBend.h"
+#include "SynchRadParticleProcess.h"
+
+/*
+ * Check the moments of the tabulated synchrotron radiation photon
+ * spectrum, and that the energy lost by a bunch of electrons in a
+ * bend with photon generation has the mean and spread expected from
+ * the classical loss. The result must be the same when the random
+ * number generator is reset, and with any number of threads.
+ */
+
+using namespace std;
+using namespace PhysicalConstants;
+using namespace PhysicalUnits;
+using namespace ParticleTracking;
+
+const double beam_energy = 5.0;
+const size_t npart = 20000;
+
+// energy loss of each particle in one pass of the bend
+vector<double> radiate(SectorBend& bend, bool photons, SynchRadParticleProcess::PhotonGenerator pg = nullptr)
+{
+	ElectronBunch bunch(beam_energy, 1);
+	for(size_t n = 0; n < npart; n++)
+	{
+		Particle p(0);
+		p.id() = n;
+		bunch.push_back(p);
+	}
+
+	if(pg)
+	{
+		SynchRadParticleProcess::SetPhotonGenerator(pg);
+	}
+	SynchRadParticleProcess proc(1, photons);
+	proc.AdjustBunchReferenceEnergy(false);
+	proc.InitialiseProcess(bunch);
+	proc.SetCurrentComponent(bend);
+	assert(proc.IsActive());
+	proc.DoProcess(bend.GetLength());
+	SynchRadParticleProcess::SetPhotonGenerator(HBSpectrumGen);
+
+	vector<double> u;
+	for(const Particle& p : bunch)
+	{
+		u.push_back(-p.dp() * beam_energy);
+	}
+	return u;
+}
+
+void moments(const vector<double>& u, double& mean, double& var)
+{
+	mean = var = 0;
+	for(double x : u)
+	{
+		mean += x;
+	}
+	mean /= u.size();
+	for(double x : u)
+	{
+		var += (x - mean) * (x - mean);
+	}
+	var /= u.size() - 1;
+}
+
+int main()
+{
+	// spectrum moments, from a uniform grid of the cumulative distribution
+	const SynchRadSpectrumTable& table = SynchRadSpectrumTable::Get();
+	cout << "total: " << table.Total() << endl;
+	assert(fabs(table.Total() / (5 * pi / 3) - 1) < 1e-6);
+
+	const int nu = 1000000;
+	double m1 = 0;
+	double m2 = 0;
+	for(int k = 0; k < nu; k++)
+	{
+		const double x = table.Sample((k + 0.5) / nu);
+		m1 += x / nu;
+		m2 += x * x / nu;
+	}
+	cout << "<x> = " << m1 << ", <x^2> = " << m2 << endl;
+	assert(fabs(m1 / (8 / (15 * sqrt(3.))) - 1) < 1e-4);
+	assert(fabs(m2 / (11. / 27.) - 1) < 1e-3);
+	assert(table.Sample(0) == 0);
+
+	// electrons in a bend
+	RandomNG::init(1234);
+	const double brho = beam_energy / eV / SpeedOfLight;
+	const double h = 0.01;
+	SectorBend bend("B", 10.0, h, h * brho);
+
+	vector<double> uc = radiate(bend, false);
+	const double U0 = uc[0];
+	for(double u : uc)
+	{
+		assert(u == U0);
+	}
+
+	const vector<double> u1 = radiate(bend, true, TabulatedSpectrumGen);
+	double mean, var;
+	moments(u1, mean, var);
+
+	cout << "mean loss " << mean << " classical " << U0 << ", rms " << sqrt(var) << endl;
+	assert(fabs(mean / U0 - 1) < 0.015);
+	assert(var > 0);
+
+	// with the serial Burkhardt generator, the default
+	double meanHB, varHB;
+	moments(radiate(bend, true), meanHB, varHB);
+	cout << "HB mean loss " << meanHB << ", rms " << sqrt(varHB) << endl;
+	assert(fabs(meanHB / U0 - 1) < 0.015);
+	assert(fabs(varHB / var - 1) < 0.1);
+
+	// reproducible
+	RandomNG::reset(1234);
+	radiate(bend, false);
+	assert(radiate(bend, true, TabulatedSpectrumGen) == u1);
+
+#ifdef ENABLE_OPENMP
+	for(int nthreads : {1, 3})
+	{
+		omp_set_num_threads(nthreads);
+		RandomNG::reset(1234);
+		assert(radiate(bend, true, TabulatedSpectrumGen) == u1);
+	}
+#endif
+
+	return 0;
+}
@@ -0,0 +1,114 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#include "../tests.h"
+#include "../fodo_ring.h"
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+#include "ClosedOrbit.h"
+#include "Components.h"
+#include "CorrectorDipoles.h"
+#include "NumericalConstants.h"
+#include "PhaseAdvance.h"
+#include "TransferMatrix.h"
+
+/*
+ * Check the transfer maps and phase advances looked up in the
+ * cached optics of PhaseAdvance against direct calculation, on
+ * a ring of identical FODO cells.
+ */
+
+using namespace std;
+
+const double beam_energy = 450.0;
+const int ncells = 8;
+const int cell_length = 5;
+
+AcceleratorModel* build_ring()
+{
+	FodoRing ring;
+	ring.beam_energy = beam_energy;
+	ring.ncells = ncells;
+	ring.markers = true;
+	return ring.Build();
+}
+
+int main()
+{
+	unique_ptr<AcceleratorModel> model(build_ring());
+	const int nelm = ncells * cell_length;
+
+	PhaseAdvance pa(model.get(), nullptr, beam_energy);
+	TransferMapTable& maps = pa.GetTransferMaps();
+	assert(maps.NumberOfRows() == nelm + 1);
+
+	// maps between elements agree with the map of that section alone, found
+	// by the same linear map concatenation as the table
+	TransferMatrix tm(model.get(), beam_energy);
+	tm.ScaleBendPathLength(1E-16);
+	tm.UseMapConcatenation(true);
+	RealMatrix M(6, 6);
+	for(int n1 : {0, 3, 17})
+	{
+		for(int n2 : {n1, n1 + 1, nelm - 1})
+		{
+			PSvector orbit = maps.GetOrbit(n1);
+			tm.FindTM(M, orbit, n1, n2);
+			assert(max_diff(pa.TransferMapBetween(n1, n2), M) < 1e-10);
+		}
+	}
+
+	// past the end of the ring
+	RealMatrix M1(6, 6), M2(6, 6);
+	PSvector orbit = maps.GetOrbit(30);
+	tm.FindTM(M1, orbit, 30, nelm - 1);
+	orbit = maps.GetOrbit(0);
+	tm.FindTM(M2, orbit, 0, 4);
+	assert(max_diff(pa.TransferMapBetween(30, 4), M2 * M1) < 1e-10);
+
+	// tune from the one turn map
+	const RealMatrix& R = maps.GetMap(nelm);
+	for(int i : {0, 2})
+	{
+		const bool horizontal = i == 0;
+		double Q = maps.GetTune(horizontal);
+		double q = acos((R(i, i) + R(i + 1, i + 1)) / 2) / twoPi;
+		if(R(i, i + 1) < 0)
+		{
+			q = 1 - q;
+		}
+		cout << "Q = " << Q << endl;
+		assert(Q > 1 && Q < ncells / 2);
+		assert_close(Q - floor(Q), q, 1e-10);
+
+		// identical cells have equal phase advances
+		for(int n = 0; n <= ncells; n++)
+		{
+			pair<double, double> mu = pa.CalcIntegerPart(n * cell_length);
+			double mu_n = horizontal ? mu.first : mu.second;
+			assert_close(mu_n, n * Q / ncells, 1e-10);
+		}
+		assert_close(pa.PhaseAdvanceBetween(cell_length, 3 * cell_length, horizontal), 2 * Q / ncells, 1e-10);
+	}
+
+	// the cache follows changes to the model once invalidated
+	const double Qx = maps.GetTune(true);
+	vector<Quadrupole*> qf;
+	model->ExtractTypedElements(qf, "QF.*");
+	for(Quadrupole* q : qf)
+	{
+		q->SetFieldStrength(q->GetFieldStrength() * 1.01);
+	}
+	assert(maps.GetTune(true) == Qx);
+	pa.Invalidate();
+	assert(maps.GetTune(true) > Qx);
+
+	cout << "transfer_map_table_test passed" << endl;
+	return 0;
+}
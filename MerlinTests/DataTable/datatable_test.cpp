@@ -7,6 +7,7 @@
 
 #include "DataTable.h"
 #include "../tests.h"
+#include <cmath>
 #include <iostream>
 using namespace std;
 
@@ -164,6 +165,61 @@ void test_has_key()
 	assert(dt2.HeaderHasKey("w", 'i') == false);
 }
 
+void test_handles()
+{
+	cout << "test_handles()" << endl;
+	auto dt = make_example_dt();
+	auto a = dt.GetColumnHandle("a");
+	auto b = dt.GetColumnHandle("b");
+	auto c = dt.GetColumnHandle("c");
+
+	assert(dt.Get_s(a, 1) == "beta");
+	assert(dt.Get_d(b, 2) == 3.1);
+	assert(dt.Get_i(c, 1) == -2);
+
+	dt.Set_d(b, 0, 4.5);
+	dt.Set_i(c, 0, 7);
+	dt.Set_s(a, 0, "delta");
+	assert(dt.Get_d("b", 0) == 4.5);
+	assert(dt.Get_i("c", 0) == 7);
+	assert(dt.Get_s("a", 0) == "delta");
+
+	// handles survive adding rows and columns
+	dt.AddColumn("d", 'd');
+	dt.AddRow("epsilon", 5.1, 5, 0.5);
+	assert(dt.Get_d(b, 3) == 5.1);
+	assert((*dt.begin()).Get_s(a) == "delta");
+
+	assert_throws(dt.GetColumnHandle("z"), std::out_of_range);
+	assert_throws(dt.Get_d(a, 0), WrongTypeException);
+	assert_throws(dt.Set_i(b, 0, 1), WrongTypeException);
+	assert_throws(dt.Get_d(b, 4), std::out_of_range);
+	assert_throws(dt.Get_d(DataTable::ColumnHandle(), 0), std::out_of_range);
+}
+
+void test_column_views()
+{
+	cout << "test_column_views()" << endl;
+	auto dt = make_example_dt();
+
+	double sum = 0;
+	for(double x : dt.GetColumn_d("b"))
+	{
+		sum += x;
+	}
+	assert(fabs(sum - 6.3) < 1e-12);
+
+	auto c = dt.GetColumn_i("c");
+	assert(c.size() == 3);
+	c[2] = 42;
+	assert(dt.Get_i("c", 2) == 42);
+
+	const DataTable& cdt = dt;
+	assert(cdt.GetColumn_s("a")[1] == "beta");
+	assert_throws(cdt.GetColumn_d("a"), WrongTypeException);
+	assert_throws(cdt.GetColumn_d("z"), std::out_of_range);
+}
+
 int main()
 {
 	test1();
@@ -178,6 +234,8 @@ int main()
 	test_const(dt2);
 
 	test_has_key();
+	test_handles();
+	test_column_views();
 
 	return 0;
 }
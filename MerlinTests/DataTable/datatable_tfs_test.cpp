@@ -8,8 +8,10 @@
 #include "DataTable.h"
 #include "DataTableTFS.h"
 #include "../tests.h"
+#include <cmath>
 #include <iostream>
 #include <sstream>
+#include <string>
 using namespace std;
 
 /*
@@ -56,6 +58,66 @@ void write_read(DataTable dt)
 	}
 }
 
+void read_values()
+{
+	cout << "read_values()" << endl;
+	// values that need the slow path of the number parser, quoted strings,
+	// and blank lines
+	string values[] = {"0.1", "-2.5e-3", "2.0915000000000003E+01", "1e-300", "-0", "123456789012345678901234",
+					   "1.7976931348623157e308", "+7", "0.000000000000000000000000001",
+					   "9007199254740993"};
+	stringstream ss;
+	ss << "@ NAME %05s \"TWISS\"\n* NAME X N\n$ %s %le %d\n";
+	int n = 0;
+	for(auto& v : values)
+	{
+		ss << " \"A B " << n << "\"\t" << v << "   " << n - 5 << "\r\n\n";
+		n++;
+	}
+	unique_ptr<DataTable> dt(DataTableReaderTFS(&ss).Read());
+
+	assert(dt->Length() == size_t(n));
+	for(int i = 0; i < n; i++)
+	{
+		assert(dt->Get_s("NAME", i) == "A B " + to_string(i));
+		assert(dt->Get_d("X", i) == stod(values[i]));
+		assert(dt->Get_i("N", i) == i - 5);
+	}
+	assert(signbit(dt->Get_d("X", 4)));
+
+	stringstream bad1("* A B\n$ %le %le\n 1.0 2.0\n 3.0\n");
+	assert_throws(DataTableReaderTFS(&bad1).Read(), BadFormatException);
+	stringstream bad2("* A B\n$ %le %le\n 1.0 2.0 3.0\n");
+	assert_throws(DataTableReaderTFS(&bad2).Read(), BadFormatException);
+	stringstream bad3("* A\n$ %le\n abc\n");
+	assert_throws(DataTableReaderTFS(&bad3).Read(), std::invalid_argument);
+}
+
+void read_chunked()
+{
+	cout << "read_chunked()" << endl;
+	string fname = find_data_file("Aperture_B1_6p5TeV_2016.tfs");
+
+	DataTableReaderTFS serial_reader(fname);
+	serial_reader.SetChunkSize(0);
+	unique_ptr<DataTable> serial(serial_reader.Read());
+
+	DataTableReaderTFS chunked_reader(fname);
+	chunked_reader.SetChunkSize(100000);
+	unique_ptr<DataTable> chunked(chunked_reader.Read());
+
+	assert(serial->Length() > 20000);
+	assert(serial->Length() == chunked->Length());
+	assert(serial->Get_s("NAME", 0) == "LHCB1$START");
+	for(auto& col : serial->ColumnNames())
+	{
+		for(size_t i = 0; i < serial->Length(); i++)
+		{
+			assert(serial->GetAsStr(col, i) == chunked->GetAsStr(col, i));
+		}
+	}
+}
+
 void read_big()
 {
 	cout << "read_big()" << endl;
@@ -90,6 +152,8 @@ int main()
 	auto dt1 = make_example_dt();
 
 	write_read(dt1);
+	read_values();
+	read_chunked();
 	read_big();
 
 	return 0;
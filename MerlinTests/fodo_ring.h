@@ -0,0 +1,136 @@
+/*
+ * Merlin++: C++ Class Library for Charged Particle Accelerator Simulations
+ * Copyright (c) 2001-2018 The Merlin++ developers
+ * This file is covered by the terms the GNU GPL version 2, or (at your option) any later version, see the file COPYING
+ * This file is derived from software bearing the copyright notice in merlin4_copyright.txt
+ */
+
+#ifndef _fodo_ring_h_
+#define _fodo_ring_h_
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+#include "AcceleratorModelConstructor.h"
+#include "Components.h"
+#include "LinearAlgebra.h"
+#include "NumericalConstants.h"
+#include "PhysicalConstants.h"
+#include "PhysicalUnits.h"
+
+/*
+ * The ring of FODO cells shared by the lattice tests. Each cell n is a
+ * 2 m focusing quadrupole QF.n, a 10 m bend MB.An, a 2 m defocusing
+ * quadrupole QD.n and a 10 m bend MB.Bn, and the bends of all the cells
+ * close the ring. The options add sextupoles, correctors, BPMs and
+ * markers to every cell.
+ */
+struct FodoRing
+{
+	double beam_energy = 450.0; // GeV
+	int ncells = 8;
+	double kq = 0.05;           // quadrupole gradients / brho
+	int sextupoles = 0;         // 0.5 m sextupoles: MSF.n after QF, then MSD.n after QD
+	double k2f = 0;             // MSF strength / brho
+	double k2d = 0;             // MSD strength / brho
+	bool correctors = false;    // 0.5 m MCH.n after QF and MCV.n after QD
+	bool bpms = false;          // BPM.n at the start of the cell
+	bool markers = false;       // M.n at the end of the cell
+
+	double Brho() const
+	{
+		return beam_energy / PhysicalUnits::eV / PhysicalConstants::SpeedOfLight;
+	}
+
+	// appends c at lattice position s, and moves s to its end
+	template<class T> static void Append(AcceleratorModelConstructor& ctor, T* c, double& s)
+	{
+		c->SetComponentLatticePosition(s);
+		s += c->GetLength();
+		ctor.AppendComponent(c);
+	}
+
+	// appends count cells, numbered from first, at lattice positions from s; returns the position of the end
+	double AppendCells(AcceleratorModelConstructor& ctor, int first, int count, double s = 0) const
+	{
+		const double brho = Brho();
+		const double h = twoPi / (2 * ncells * 10.0);
+		for(int n = first; n < first + count; n++)
+		{
+			const std::string id = std::to_string(n);
+			if(bpms)
+			{
+				Append(ctor, new BPM("BPM." + id, 0), s);
+			}
+			Append(ctor, new Quadrupole("QF." + id, 2.0, kq * brho), s);
+			if(correctors)
+			{
+				Append(ctor, new XCor("MCH." + id, 0.5), s);
+			}
+			if(sextupoles > 0)
+			{
+				Append(ctor, new Sextupole("MSF." + id, 0.5, k2f * brho), s);
+			}
+			Append(ctor, new SectorBend("MB.A" + id, 10.0, h, h * brho), s);
+			Append(ctor, new Quadrupole("QD." + id, 2.0, -kq * brho), s);
+			if(correctors)
+			{
+				Append(ctor, new YCor("MCV." + id, 0.5), s);
+			}
+			if(sextupoles > 1)
+			{
+				Append(ctor, new Sextupole("MSD." + id, 0.5, k2d * brho), s);
+			}
+			Append(ctor, new SectorBend("MB.B" + id, 10.0, h, h * brho), s);
+			if(markers)
+			{
+				Append(ctor, new Marker("M." + id), s);
+			}
+		}
+		return s;
+	}
+
+	void AppendCells(AcceleratorModelConstructor& ctor) const
+	{
+		AppendCells(ctor, 0, ncells);
+	}
+
+	AcceleratorModel* Build() const
+	{
+		AcceleratorModelConstructor ctor;
+		ctor.NewModel();
+		AppendCells(ctor);
+		return ctor.GetModel();
+	}
+};
+
+// the largest absolute difference between the elements of two matrices
+double max_diff(const RealMatrix& A, const RealMatrix& B)
+{
+	double d = 0;
+	for(size_t i = 0; i < A.nrows(); i++)
+	{
+		for(size_t j = 0; j < A.ncols(); j++)
+		{
+			d = std::max(d, std::fabs(A(i, j) - B(i, j)));
+		}
+	}
+	return d;
+}
+
+// the largest difference between the elements of two matrices, relative to 1 + |B(i,j)|
+double max_rel_diff(const RealMatrix& A, const RealMatrix& B)
+{
+	double d = 0;
+	for(size_t i = 0; i < A.nrows(); i++)
+	{
+		for(size_t j = 0; j < A.ncols(); j++)
+		{
+			d = std::max(d, std::fabs(A(i, j) - B(i, j)) / (1 + std::fabs(B(i, j))));
+		}
+	}
+	return d;
+}
+
+#endif
@@ -0,0 +1,160 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/CMakeLists.txt"
+  "/root/repo/CTestConfig.cmake"
+  "/root/repo/Merlin/MerlinVersion.cpp.in"
+  "/root/repo/MerlinBenchmarks/CMakeLists.txt"
+  "/root/repo/MerlinExamples/CMakeLists.txt"
+  "/root/repo/MerlinTests/CMakeLists.txt"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseImplicitLinkInfo.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CTest.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestTargets.cmake"
+  "/usr/share/cmake-3.25/Modules/CTestUseLaunchers.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Dart.cmake"
+  "/usr/share/cmake-3.25/Modules/DartConfiguration.tcl.in"
+  "/usr/share/cmake-3.25/Modules/FindDart.cmake"
+  "/usr/share/cmake-3.25/Modules/FindDoxygen.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenMP.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "Merlin/MerlinVersion.cpp"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "MerlinExamples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "DartConfiguration.tcl"
+  "MerlinTests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "MerlinBenchmarks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/gitrev.dir/DependInfo.cmake"
+  "CMakeFiles/merlin.dir/DependInfo.cmake"
+  "CMakeFiles/doxygen.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/ExampleDataFiles.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/AccErr.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/ClosedOrbit.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/HaloCollimation.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/ILCDFS.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/ILCML.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/LatticeFunctions.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/SpinTracking.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/StrayFieldClosedOrbit.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/Tracking.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/Trajectory.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/wakefile_ex1.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/wakefile_ex2.dir/DependInfo.cmake"
+  "MerlinExamples/CMakeFiles/wakefile_ex3.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/TestDataFiles.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/have_python.py.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/bunch_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/bunch_io_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/aperture_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/collimate_particle_process_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/particle_bunch_constructor_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/parallel_bunch_generation_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/scope_profiler_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/model_index_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/model_snapshot_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/linear_map_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/transfer_map_table_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lattice_update_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/frequency_map_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/dynamic_aperture_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/orbit_response_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lattice_derivative_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/nan_check_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/hel_kick_table_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/synch_rad_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/spin_tracking_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/cc_failure_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/async_output_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/particle_recorder_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/smp_transport_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/collimator_wake_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/bunch_train_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/random_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/random_test.py.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lhc_optics_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lhc_fft_tune_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ground_movement.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/cu50_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/cu50_test.py.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lhc_collimation_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/lhc_collimation_test.py.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/basic_hollow_electron_lens_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/basic_hollow_electron_lens_test.py.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/diffusive_hollow_electron_lens_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/datatable_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/datatable_tfs_test.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/Experimental.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/Nightly.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/Continuous.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyMemoryCheck.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyStart.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyUpdate.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyConfigure.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyBuild.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyTest.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyCoverage.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlyMemCheck.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/NightlySubmit.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalStart.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalUpdate.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalConfigure.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalBuild.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalTest.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalCoverage.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalMemCheck.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ExperimentalSubmit.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousStart.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousUpdate.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousConfigure.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousBuild.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousTest.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousCoverage.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousMemCheck.dir/DependInfo.cmake"
+  "MerlinTests/CMakeFiles/ContinuousSubmit.dir/DependInfo.cmake"
+  "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/DependInfo.cmake"
+  )
@@ -0,0 +1,9 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/gitrev"
+  "gitrev_file"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/gitrev.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,194 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/Merlin/ATL2D.cpp" "CMakeFiles/merlin.dir/Merlin/ATL2D.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ATL2D.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorComponent.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorComponent.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorComponent.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorErrors.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorErrors.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorErrors.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorGeometry.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorGeometry.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorGeometry.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorModel.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorModel.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorModel.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorModelConstructor.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelConstructor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelConstructor.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorModelIndex.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelIndex.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelIndex.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorModelSnapshot.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelSnapshot.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorModelSnapshot.cpp.o.d"
+  "/root/repo/Merlin/AcceleratorSupport.cpp" "CMakeFiles/merlin.dir/Merlin/AcceleratorSupport.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AcceleratorSupport.cpp.o.d"
+  "/root/repo/Merlin/Aperture.cpp" "CMakeFiles/merlin.dir/Merlin/Aperture.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Aperture.cpp.o.d"
+  "/root/repo/Merlin/ApertureConfiguration.cpp" "CMakeFiles/merlin.dir/Merlin/ApertureConfiguration.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ApertureConfiguration.cpp.o.d"
+  "/root/repo/Merlin/ApertureSurvey.cpp" "CMakeFiles/merlin.dir/Merlin/ApertureSurvey.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ApertureSurvey.cpp.o.d"
+  "/root/repo/Merlin/ArcGeometry.cpp" "CMakeFiles/merlin.dir/Merlin/ArcGeometry.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ArcGeometry.cpp.o.d"
+  "/root/repo/Merlin/AsyncOutput.cpp" "CMakeFiles/merlin.dir/Merlin/AsyncOutput.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AsyncOutput.cpp.o.d"
+  "/root/repo/Merlin/AxisRotations.cpp" "CMakeFiles/merlin.dir/Merlin/AxisRotations.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/AxisRotations.cpp.o.d"
+  "/root/repo/Merlin/BPM.cpp" "CMakeFiles/merlin.dir/Merlin/BPM.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BPM.cpp.o.d"
+  "/root/repo/Merlin/BPMChannel.cpp" "CMakeFiles/merlin.dir/Merlin/BPMChannel.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BPMChannel.cpp.o.d"
+  "/root/repo/Merlin/BPMChannelCtor.cpp" "CMakeFiles/merlin.dir/Merlin/BPMChannelCtor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BPMChannelCtor.cpp.o.d"
+  "/root/repo/Merlin/BPMDataBuffer.cpp" "CMakeFiles/merlin.dir/Merlin/BPMDataBuffer.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BPMDataBuffer.cpp.o.d"
+  "/root/repo/Merlin/BPMDataBufferServer.cpp" "CMakeFiles/merlin.dir/Merlin/BPMDataBufferServer.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BPMDataBufferServer.cpp.o.d"
+  "/root/repo/Merlin/BasicTransportMaps.cpp" "CMakeFiles/merlin.dir/Merlin/BasicTransportMaps.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BasicTransportMaps.cpp.o.d"
+  "/root/repo/Merlin/Bessel.cpp" "CMakeFiles/merlin.dir/Merlin/Bessel.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Bessel.cpp.o.d"
+  "/root/repo/Merlin/BetatronTunes.cpp" "CMakeFiles/merlin.dir/Merlin/BetatronTunes.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BetatronTunes.cpp.o.d"
+  "/root/repo/Merlin/BunchFilter.cpp" "CMakeFiles/merlin.dir/Merlin/BunchFilter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BunchFilter.cpp.o.d"
+  "/root/repo/Merlin/BunchTrainTracker.cpp" "CMakeFiles/merlin.dir/Merlin/BunchTrainTracker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BunchTrainTracker.cpp.o.d"
+  "/root/repo/Merlin/BzField.cpp" "CMakeFiles/merlin.dir/Merlin/BzField.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/BzField.cpp.o.d"
+  "/root/repo/Merlin/CCFailureProcess.cpp" "CMakeFiles/merlin.dir/Merlin/CCFailureProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CCFailureProcess.cpp.o.d"
+  "/root/repo/Merlin/CPUFeatures.cpp" "CMakeFiles/merlin.dir/Merlin/CPUFeatures.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CPUFeatures.cpp.o.d"
+  "/root/repo/Merlin/ChannelServer.cpp" "CMakeFiles/merlin.dir/Merlin/ChannelServer.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ChannelServer.cpp.o.d"
+  "/root/repo/Merlin/Channels.cpp" "CMakeFiles/merlin.dir/Merlin/Channels.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Channels.cpp.o.d"
+  "/root/repo/Merlin/ClosedOrbit.cpp" "CMakeFiles/merlin.dir/Merlin/ClosedOrbit.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ClosedOrbit.cpp.o.d"
+  "/root/repo/Merlin/CollimateParticleProcess.cpp" "CMakeFiles/merlin.dir/Merlin/CollimateParticleProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimateParticleProcess.cpp.o.d"
+  "/root/repo/Merlin/CollimateProtonProcess.cpp" "CMakeFiles/merlin.dir/Merlin/CollimateProtonProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimateProtonProcess.cpp.o.d"
+  "/root/repo/Merlin/CollimationOutput.cpp" "CMakeFiles/merlin.dir/Merlin/CollimationOutput.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimationOutput.cpp.o.d"
+  "/root/repo/Merlin/Collimator.cpp" "CMakeFiles/merlin.dir/Merlin/Collimator.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Collimator.cpp.o.d"
+  "/root/repo/Merlin/CollimatorAperture.cpp" "CMakeFiles/merlin.dir/Merlin/CollimatorAperture.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimatorAperture.cpp.o.d"
+  "/root/repo/Merlin/CollimatorDatabase.cpp" "CMakeFiles/merlin.dir/Merlin/CollimatorDatabase.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimatorDatabase.cpp.o.d"
+  "/root/repo/Merlin/CollimatorPotentialModels.cpp" "CMakeFiles/merlin.dir/Merlin/CollimatorPotentialModels.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimatorPotentialModels.cpp.o.d"
+  "/root/repo/Merlin/CollimatorWakeProcess.cpp" "CMakeFiles/merlin.dir/Merlin/CollimatorWakeProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CollimatorWakeProcess.cpp.o.d"
+  "/root/repo/Merlin/ComponentFrame.cpp" "CMakeFiles/merlin.dir/Merlin/ComponentFrame.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ComponentFrame.cpp.o.d"
+  "/root/repo/Merlin/ComponentStepper.cpp" "CMakeFiles/merlin.dir/Merlin/ComponentStepper.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ComponentStepper.cpp.o.d"
+  "/root/repo/Merlin/ComponentTracker.cpp" "CMakeFiles/merlin.dir/Merlin/ComponentTracker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ComponentTracker.cpp.o.d"
+  "/root/repo/Merlin/CompositeMaterial.cpp" "CMakeFiles/merlin.dir/Merlin/CompositeMaterial.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CompositeMaterial.cpp.o.d"
+  "/root/repo/Merlin/ConstructSrot.cpp" "CMakeFiles/merlin.dir/Merlin/ConstructSrot.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ConstructSrot.cpp.o.d"
+  "/root/repo/Merlin/CorrectorDipoles.cpp" "CMakeFiles/merlin.dir/Merlin/CorrectorDipoles.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CorrectorDipoles.cpp.o.d"
+  "/root/repo/Merlin/CorrectorWinding.cpp" "CMakeFiles/merlin.dir/Merlin/CorrectorWinding.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CorrectorWinding.cpp.o.d"
+  "/root/repo/Merlin/CouplerWakeFieldProcess.cpp" "CMakeFiles/merlin.dir/Merlin/CouplerWakeFieldProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CouplerWakeFieldProcess.cpp.o.d"
+  "/root/repo/Merlin/CrabMarker.cpp" "CMakeFiles/merlin.dir/Merlin/CrabMarker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CrabMarker.cpp.o.d"
+  "/root/repo/Merlin/CrossSections.cpp" "CMakeFiles/merlin.dir/Merlin/CrossSections.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/CrossSections.cpp.o.d"
+  "/root/repo/Merlin/DataTable.cpp" "CMakeFiles/merlin.dir/Merlin/DataTable.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/DataTable.cpp.o.d"
+  "/root/repo/Merlin/DataTableTFS.cpp" "CMakeFiles/merlin.dir/Merlin/DataTableTFS.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/DataTableTFS.cpp.o.d"
+  "/root/repo/Merlin/DetailedCollimationOutput.cpp" "CMakeFiles/merlin.dir/Merlin/DetailedCollimationOutput.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/DetailedCollimationOutput.cpp.o.d"
+  "/root/repo/Merlin/DiffractiveScatter.cpp" "CMakeFiles/merlin.dir/Merlin/DiffractiveScatter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/DiffractiveScatter.cpp.o.d"
+  "/root/repo/Merlin/Dispersion.cpp" "CMakeFiles/merlin.dir/Merlin/Dispersion.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Dispersion.cpp.o.d"
+  "/root/repo/Merlin/Drift.cpp" "CMakeFiles/merlin.dir/Merlin/Drift.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Drift.cpp.o.d"
+  "/root/repo/Merlin/DynamicAperture.cpp" "CMakeFiles/merlin.dir/Merlin/DynamicAperture.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/DynamicAperture.cpp.o.d"
+  "/root/repo/Merlin/EMField.cpp" "CMakeFiles/merlin.dir/Merlin/EMField.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/EMField.cpp.o.d"
+  "/root/repo/Merlin/ElasticScatter.cpp" "CMakeFiles/merlin.dir/Merlin/ElasticScatter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ElasticScatter.cpp.o.d"
+  "/root/repo/Merlin/ElectronBunch.cpp" "CMakeFiles/merlin.dir/Merlin/ElectronBunch.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ElectronBunch.cpp.o.d"
+  "/root/repo/Merlin/ElementRepository.cpp" "CMakeFiles/merlin.dir/Merlin/ElementRepository.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ElementRepository.cpp.o.d"
+  "/root/repo/Merlin/EquilibriumDistribution.cpp" "CMakeFiles/merlin.dir/Merlin/EquilibriumDistribution.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/EquilibriumDistribution.cpp.o.d"
+  "/root/repo/Merlin/FlukaCollimationOutput.cpp" "CMakeFiles/merlin.dir/Merlin/FlukaCollimationOutput.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/FlukaCollimationOutput.cpp.o.d"
+  "/root/repo/Merlin/FrameModifier.cpp" "CMakeFiles/merlin.dir/Merlin/FrameModifier.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/FrameModifier.cpp.o.d"
+  "/root/repo/Merlin/FrequencyMap.cpp" "CMakeFiles/merlin.dir/Merlin/FrequencyMap.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/FrequencyMap.cpp.o.d"
+  "/root/repo/Merlin/Gamma.cpp" "CMakeFiles/merlin.dir/Merlin/Gamma.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Gamma.cpp.o.d"
+  "/root/repo/Merlin/GeneralRotation.cpp" "CMakeFiles/merlin.dir/Merlin/GeneralRotation.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/GeneralRotation.cpp.o.d"
+  "/root/repo/Merlin/HaloParticleDistributionGenerator.cpp" "CMakeFiles/merlin.dir/Merlin/HaloParticleDistributionGenerator.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/HaloParticleDistributionGenerator.cpp.o.d"
+  "/root/repo/Merlin/Histogram.cpp" "CMakeFiles/merlin.dir/Merlin/Histogram.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Histogram.cpp.o.d"
+  "/root/repo/Merlin/HollowELensProcess.cpp" "CMakeFiles/merlin.dir/Merlin/HollowELensProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/HollowELensProcess.cpp.o.d"
+  "/root/repo/Merlin/HollowElectronLens.cpp" "CMakeFiles/merlin.dir/Merlin/HollowElectronLens.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/HollowElectronLens.cpp.o.d"
+  "/root/repo/Merlin/IdentityRotation.cpp" "CMakeFiles/merlin.dir/Merlin/IdentityRotation.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/IdentityRotation.cpp.o.d"
+  "/root/repo/Merlin/InterpolatedApertures.cpp" "CMakeFiles/merlin.dir/Merlin/InterpolatedApertures.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/InterpolatedApertures.cpp.o.d"
+  "/root/repo/Merlin/Interpolation.cpp" "CMakeFiles/merlin.dir/Merlin/Interpolation.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Interpolation.cpp.o.d"
+  "/root/repo/Merlin/Klystron.cpp" "CMakeFiles/merlin.dir/Merlin/Klystron.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Klystron.cpp.o.d"
+  "/root/repo/Merlin/LCAVintegrator.cpp" "CMakeFiles/merlin.dir/Merlin/LCAVintegrator.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LCAVintegrator.cpp.o.d"
+  "/root/repo/Merlin/LatticeFrame.cpp" "CMakeFiles/merlin.dir/Merlin/LatticeFrame.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LatticeFrame.cpp.o.d"
+  "/root/repo/Merlin/LatticeFunctions.cpp" "CMakeFiles/merlin.dir/Merlin/LatticeFunctions.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LatticeFunctions.cpp.o.d"
+  "/root/repo/Merlin/LinearAlgebra.cpp" "CMakeFiles/merlin.dir/Merlin/LinearAlgebra.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LinearAlgebra.cpp.o.d"
+  "/root/repo/Merlin/LinearFBSystem.cpp" "CMakeFiles/merlin.dir/Merlin/LinearFBSystem.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LinearFBSystem.cpp.o.d"
+  "/root/repo/Merlin/LinearMapTracker.cpp" "CMakeFiles/merlin.dir/Merlin/LinearMapTracker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LinearMapTracker.cpp.o.d"
+  "/root/repo/Merlin/LinearParticleMap.cpp" "CMakeFiles/merlin.dir/Merlin/LinearParticleMap.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LinearParticleMap.cpp.o.d"
+  "/root/repo/Merlin/LongRangeWakeProcess.cpp" "CMakeFiles/merlin.dir/Merlin/LongRangeWakeProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LongRangeWakeProcess.cpp.o.d"
+  "/root/repo/Merlin/LossMapCollimationOutput.cpp" "CMakeFiles/merlin.dir/Merlin/LossMapCollimationOutput.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/LossMapCollimationOutput.cpp.o.d"
+  "/root/repo/Merlin/MADInterface.cpp" "CMakeFiles/merlin.dir/Merlin/MADInterface.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MADInterface.cpp.o.d"
+  "/root/repo/Merlin/MagnetMover.cpp" "CMakeFiles/merlin.dir/Merlin/MagnetMover.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MagnetMover.cpp.o.d"
+  "/root/repo/Merlin/Marker.cpp" "CMakeFiles/merlin.dir/Merlin/Marker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Marker.cpp.o.d"
+  "/root/repo/Merlin/Material.cpp" "CMakeFiles/merlin.dir/Merlin/Material.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Material.cpp.o.d"
+  "/root/repo/Merlin/MaterialDatabase.cpp" "CMakeFiles/merlin.dir/Merlin/MaterialDatabase.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MaterialDatabase.cpp.o.d"
+  "/root/repo/Merlin/MaterialMixture.cpp" "CMakeFiles/merlin.dir/Merlin/MaterialMixture.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MaterialMixture.cpp.o.d"
+  "/root/repo/Merlin/MatrixMaps.cpp" "CMakeFiles/merlin.dir/Merlin/MatrixMaps.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MatrixMaps.cpp.o.d"
+  "/root/repo/Merlin/MatrixPrinter.cpp" "CMakeFiles/merlin.dir/Merlin/MatrixPrinter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MatrixPrinter.cpp.o.d"
+  "/root/repo/Merlin/MerlinIO.cpp" "CMakeFiles/merlin.dir/Merlin/MerlinIO.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MerlinIO.cpp.o.d"
+  "/root/repo/Merlin/MerlinProfile.cpp" "CMakeFiles/merlin.dir/Merlin/MerlinProfile.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MerlinProfile.cpp.o.d"
+  "/root/repo/_omp_build/Merlin/MerlinVersion.cpp" "CMakeFiles/merlin.dir/Merlin/MerlinVersion.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MerlinVersion.cpp.o.d"
+  "/root/repo/Merlin/ModelElement.cpp" "CMakeFiles/merlin.dir/Merlin/ModelElement.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ModelElement.cpp.o.d"
+  "/root/repo/Merlin/Monitor.cpp" "CMakeFiles/merlin.dir/Merlin/Monitor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Monitor.cpp.o.d"
+  "/root/repo/Merlin/MonitorProcess.cpp" "CMakeFiles/merlin.dir/Merlin/MonitorProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MonitorProcess.cpp.o.d"
+  "/root/repo/Merlin/MultipoleField.cpp" "CMakeFiles/merlin.dir/Merlin/MultipoleField.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MultipoleField.cpp.o.d"
+  "/root/repo/Merlin/MuonBunch.cpp" "CMakeFiles/merlin.dir/Merlin/MuonBunch.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/MuonBunch.cpp.o.d"
+  "/root/repo/Merlin/NANCheckProcess.cpp" "CMakeFiles/merlin.dir/Merlin/NANCheckProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/NANCheckProcess.cpp.o.d"
+  "/root/repo/Merlin/NormalTransform.cpp" "CMakeFiles/merlin.dir/Merlin/NormalTransform.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/NormalTransform.cpp.o.d"
+  "/root/repo/Merlin/NumericalConstants.cpp" "CMakeFiles/merlin.dir/Merlin/NumericalConstants.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/NumericalConstants.cpp.o.d"
+  "/root/repo/Merlin/OPFormat.cpp" "CMakeFiles/merlin.dir/Merlin/OPFormat.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/OPFormat.cpp.o.d"
+  "/root/repo/Merlin/OrbitResponseMatrix.cpp" "CMakeFiles/merlin.dir/Merlin/OrbitResponseMatrix.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/OrbitResponseMatrix.cpp.o.d"
+  "/root/repo/Merlin/PSvector.cpp" "CMakeFiles/merlin.dir/Merlin/PSvector.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PSvector.cpp.o.d"
+  "/root/repo/Merlin/PSvectorTransform3D.cpp" "CMakeFiles/merlin.dir/Merlin/PSvectorTransform3D.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PSvectorTransform3D.cpp.o.d"
+  "/root/repo/Merlin/ParticleBunch.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleBunch.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleBunch.cpp.o.d"
+  "/root/repo/Merlin/ParticleBunchConstructor.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleBunchConstructor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleBunchConstructor.cpp.o.d"
+  "/root/repo/Merlin/ParticleBunchConverter.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleBunchConverter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleBunchConverter.cpp.o.d"
+  "/root/repo/Merlin/ParticleBunchUtilities.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleBunchUtilities.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleBunchUtilities.cpp.o.d"
+  "/root/repo/Merlin/ParticleDistributionGenerator.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleDistributionGenerator.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleDistributionGenerator.cpp.o.d"
+  "/root/repo/Merlin/ParticleMapComponent.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleMapComponent.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleMapComponent.cpp.o.d"
+  "/root/repo/Merlin/ParticleMapPI.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleMapPI.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleMapPI.cpp.o.d"
+  "/root/repo/Merlin/ParticleRecorder.cpp" "CMakeFiles/merlin.dir/Merlin/ParticleRecorder.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ParticleRecorder.cpp.o.d"
+  "/root/repo/Merlin/PhaseAdvance.cpp" "CMakeFiles/merlin.dir/Merlin/PhaseAdvance.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PhaseAdvance.cpp.o.d"
+  "/root/repo/Merlin/PhotonSpectrumGen.cpp" "CMakeFiles/merlin.dir/Merlin/PhotonSpectrumGen.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PhotonSpectrumGen.cpp.o.d"
+  "/root/repo/Merlin/PhysicalConstants.cpp" "CMakeFiles/merlin.dir/Merlin/PhysicalConstants.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PhysicalConstants.cpp.o.d"
+  "/root/repo/Merlin/PhysicalUnits.cpp" "CMakeFiles/merlin.dir/Merlin/PhysicalUnits.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/PhysicalUnits.cpp.o.d"
+  "/root/repo/Merlin/ProcessStepManager.cpp" "CMakeFiles/merlin.dir/Merlin/ProcessStepManager.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ProcessStepManager.cpp.o.d"
+  "/root/repo/Merlin/ProtonBunch.cpp" "CMakeFiles/merlin.dir/Merlin/ProtonBunch.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ProtonBunch.cpp.o.d"
+  "/root/repo/Merlin/RFStructure.cpp" "CMakeFiles/merlin.dir/Merlin/RFStructure.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RFStructure.cpp.o.d"
+  "/root/repo/Merlin/RMSProfileMonitor.cpp" "CMakeFiles/merlin.dir/Merlin/RMSProfileMonitor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RMSProfileMonitor.cpp.o.d"
+  "/root/repo/Merlin/RMap.cpp" "CMakeFiles/merlin.dir/Merlin/RMap.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RMap.cpp.o.d"
+  "/root/repo/Merlin/RTMap.cpp" "CMakeFiles/merlin.dir/Merlin/RTMap.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RTMap.cpp.o.d"
+  "/root/repo/Merlin/RWChannelState.cpp" "CMakeFiles/merlin.dir/Merlin/RWChannelState.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RWChannelState.cpp.o.d"
+  "/root/repo/Merlin/RandomNG.cpp" "CMakeFiles/merlin.dir/Merlin/RandomNG.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RandomNG.cpp.o.d"
+  "/root/repo/Merlin/RectMultipole.cpp" "CMakeFiles/merlin.dir/Merlin/RectMultipole.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RectMultipole.cpp.o.d"
+  "/root/repo/Merlin/RectangularGeometry.cpp" "CMakeFiles/merlin.dir/Merlin/RectangularGeometry.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RectangularGeometry.cpp.o.d"
+  "/root/repo/Merlin/RingDeltaTProcess.cpp" "CMakeFiles/merlin.dir/Merlin/RingDeltaTProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/RingDeltaTProcess.cpp.o.d"
+  "/root/repo/Merlin/Rot3Drep.cpp" "CMakeFiles/merlin.dir/Merlin/Rot3Drep.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Rot3Drep.cpp.o.d"
+  "/root/repo/Merlin/SMPBunch.cpp" "CMakeFiles/merlin.dir/Merlin/SMPBunch.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPBunch.cpp.o.d"
+  "/root/repo/Merlin/SMPBunchConstructor.cpp" "CMakeFiles/merlin.dir/Merlin/SMPBunchConstructor.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPBunchConstructor.cpp.o.d"
+  "/root/repo/Merlin/SMPBunchConverter.cpp" "CMakeFiles/merlin.dir/Merlin/SMPBunchConverter.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPBunchConverter.cpp.o.d"
+  "/root/repo/Merlin/SMPComponentTracker.cpp" "CMakeFiles/merlin.dir/Merlin/SMPComponentTracker.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPComponentTracker.cpp.o.d"
+  "/root/repo/Merlin/SMPSliceMap.cpp" "CMakeFiles/merlin.dir/Merlin/SMPSliceMap.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPSliceMap.cpp.o.d"
+  "/root/repo/Merlin/SMPStdIntegrators.cpp" "CMakeFiles/merlin.dir/Merlin/SMPStdIntegrators.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPStdIntegrators.cpp.o.d"
+  "/root/repo/Merlin/SMPTransform3D.cpp" "CMakeFiles/merlin.dir/Merlin/SMPTransform3D.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPTransform3D.cpp.o.d"
+  "/root/repo/Merlin/SMPWakeFieldProcess.cpp" "CMakeFiles/merlin.dir/Merlin/SMPWakeFieldProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SMPWakeFieldProcess.cpp.o.d"
+  "/root/repo/Merlin/SWRFStructure.cpp" "CMakeFiles/merlin.dir/Merlin/SWRFStructure.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SWRFStructure.cpp.o.d"
+  "/root/repo/Merlin/SWRFfield.cpp" "CMakeFiles/merlin.dir/Merlin/SWRFfield.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SWRFfield.cpp.o.d"
+  "/root/repo/Merlin/ScatterParticle.cpp" "CMakeFiles/merlin.dir/Merlin/ScatterParticle.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ScatterParticle.cpp.o.d"
+  "/root/repo/Merlin/ScatteringModel.cpp" "CMakeFiles/merlin.dir/Merlin/ScatteringModel.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ScatteringModel.cpp.o.d"
+  "/root/repo/Merlin/ScatteringModelsMerlin.cpp" "CMakeFiles/merlin.dir/Merlin/ScatteringModelsMerlin.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ScatteringModelsMerlin.cpp.o.d"
+  "/root/repo/Merlin/ScatteringProcess.cpp" "CMakeFiles/merlin.dir/Merlin/ScatteringProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ScatteringProcess.cpp.o.d"
+  "/root/repo/Merlin/ScopeProfiler.cpp" "CMakeFiles/merlin.dir/Merlin/ScopeProfiler.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/ScopeProfiler.cpp.o.d"
+  "/root/repo/Merlin/SectorBend.cpp" "CMakeFiles/merlin.dir/Merlin/SectorBend.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SectorBend.cpp.o.d"
+  "/root/repo/Merlin/SequenceFrame.cpp" "CMakeFiles/merlin.dir/Merlin/SequenceFrame.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SequenceFrame.cpp.o.d"
+  "/root/repo/Merlin/SimpleATL.cpp" "CMakeFiles/merlin.dir/Merlin/SimpleATL.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SimpleATL.cpp.o.d"
+  "/root/repo/Merlin/SliceMacroParticle.cpp" "CMakeFiles/merlin.dir/Merlin/SliceMacroParticle.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SliceMacroParticle.cpp.o.d"
+  "/root/repo/Merlin/Solenoid.cpp" "CMakeFiles/merlin.dir/Merlin/Solenoid.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Solenoid.cpp.o.d"
+  "/root/repo/Merlin/SpinParticleProcess.cpp" "CMakeFiles/merlin.dir/Merlin/SpinParticleProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SpinParticleProcess.cpp.o.d"
+  "/root/repo/Merlin/StableOrbits.cpp" "CMakeFiles/merlin.dir/Merlin/StableOrbits.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/StableOrbits.cpp.o.d"
+  "/root/repo/Merlin/StandardMultipoles.cpp" "CMakeFiles/merlin.dir/Merlin/StandardMultipoles.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/StandardMultipoles.cpp.o.d"
+  "/root/repo/Merlin/StdChannelDefs.cpp" "CMakeFiles/merlin.dir/Merlin/StdChannelDefs.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/StdChannelDefs.cpp.o.d"
+  "/root/repo/Merlin/StdIntegrators.cpp" "CMakeFiles/merlin.dir/Merlin/StdIntegrators.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/StdIntegrators.cpp.o.d"
+  "/root/repo/Merlin/StringPattern.cpp" "CMakeFiles/merlin.dir/Merlin/StringPattern.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/StringPattern.cpp.o.d"
+  "/root/repo/Merlin/SupportStructure.cpp" "CMakeFiles/merlin.dir/Merlin/SupportStructure.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SupportStructure.cpp.o.d"
+  "/root/repo/Merlin/SymplecticIntegrators.cpp" "CMakeFiles/merlin.dir/Merlin/SymplecticIntegrators.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SymplecticIntegrators.cpp.o.d"
+  "/root/repo/Merlin/SynchRadParticleProcess.cpp" "CMakeFiles/merlin.dir/Merlin/SynchRadParticleProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/SynchRadParticleProcess.cpp.o.d"
+  "/root/repo/Merlin/TWRFStructure.cpp" "CMakeFiles/merlin.dir/Merlin/TWRFStructure.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TWRFStructure.cpp.o.d"
+  "/root/repo/Merlin/TWRFfield.cpp" "CMakeFiles/merlin.dir/Merlin/TWRFfield.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TWRFfield.cpp.o.d"
+  "/root/repo/Merlin/TrackingOutputAV.cpp" "CMakeFiles/merlin.dir/Merlin/TrackingOutputAV.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TrackingOutputAV.cpp.o.d"
+  "/root/repo/Merlin/TrackingSimulation.cpp" "CMakeFiles/merlin.dir/Merlin/TrackingSimulation.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TrackingSimulation.cpp.o.d"
+  "/root/repo/Merlin/TransRFIntegrator.cpp" "CMakeFiles/merlin.dir/Merlin/TransRFIntegrator.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransRFIntegrator.cpp.o.d"
+  "/root/repo/Merlin/TransRFfield.cpp" "CMakeFiles/merlin.dir/Merlin/TransRFfield.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransRFfield.cpp.o.d"
+  "/root/repo/Merlin/TransferMapTable.cpp" "CMakeFiles/merlin.dir/Merlin/TransferMapTable.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransferMapTable.cpp.o.d"
+  "/root/repo/Merlin/TransferMatrix.cpp" "CMakeFiles/merlin.dir/Merlin/TransferMatrix.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransferMatrix.cpp.o.d"
+  "/root/repo/Merlin/Transform3D.cpp" "CMakeFiles/merlin.dir/Merlin/Transform3D.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Transform3D.cpp.o.d"
+  "/root/repo/Merlin/Transformable.cpp" "CMakeFiles/merlin.dir/Merlin/Transformable.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/Transformable.cpp.o.d"
+  "/root/repo/Merlin/TransportIntegrators.cpp" "CMakeFiles/merlin.dir/Merlin/TransportIntegrators.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransportIntegrators.cpp.o.d"
+  "/root/repo/Merlin/TransportMatrix.cpp" "CMakeFiles/merlin.dir/Merlin/TransportMatrix.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransportMatrix.cpp.o.d"
+  "/root/repo/Merlin/TransportRMaps.cpp" "CMakeFiles/merlin.dir/Merlin/TransportRMaps.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransportRMaps.cpp.o.d"
+  "/root/repo/Merlin/TransverseRFStructure.cpp" "CMakeFiles/merlin.dir/Merlin/TransverseRFStructure.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/TransverseRFStructure.cpp.o.d"
+  "/root/repo/Merlin/WakeFieldProcess.cpp" "CMakeFiles/merlin.dir/Merlin/WakeFieldProcess.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/WakeFieldProcess.cpp.o.d"
+  "/root/repo/Merlin/XTFFInterface.cpp" "CMakeFiles/merlin.dir/Merlin/XTFFInterface.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/XTFFInterface.cpp.o.d"
+  "/root/repo/Merlin/erfcc.cpp" "CMakeFiles/merlin.dir/Merlin/erfcc.cpp.o" "gcc" "CMakeFiles/merlin.dir/Merlin/erfcc.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
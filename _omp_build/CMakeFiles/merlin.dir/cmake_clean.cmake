@@ -0,0 +1,361 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merlin.dir/Merlin/ATL2D.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ATL2D.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorComponent.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorComponent.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorErrors.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorErrors.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorGeometry.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorGeometry.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModel.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModel.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelConstructor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelConstructor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelIndex.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelIndex.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelSnapshot.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorModelSnapshot.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorSupport.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AcceleratorSupport.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Aperture.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Aperture.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ApertureConfiguration.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ApertureConfiguration.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ApertureSurvey.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ApertureSurvey.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ArcGeometry.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ArcGeometry.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AsyncOutput.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AsyncOutput.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/AxisRotations.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/AxisRotations.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BPM.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BPM.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BPMChannel.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BPMChannel.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BPMChannelCtor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BPMChannelCtor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BPMDataBuffer.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BPMDataBuffer.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BPMDataBufferServer.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BPMDataBufferServer.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BasicTransportMaps.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BasicTransportMaps.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Bessel.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Bessel.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BetatronTunes.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BetatronTunes.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BunchFilter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BunchFilter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BunchTrainTracker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BunchTrainTracker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/BzField.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/BzField.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CCFailureProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CCFailureProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CPUFeatures.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CPUFeatures.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ChannelServer.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ChannelServer.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Channels.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Channels.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ClosedOrbit.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ClosedOrbit.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimateParticleProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimateParticleProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimateProtonProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimateProtonProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimationOutput.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimationOutput.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Collimator.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Collimator.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorAperture.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorAperture.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorDatabase.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorDatabase.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorPotentialModels.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorPotentialModels.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorWakeProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CollimatorWakeProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ComponentFrame.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ComponentFrame.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ComponentStepper.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ComponentStepper.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ComponentTracker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ComponentTracker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CompositeMaterial.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CompositeMaterial.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ConstructSrot.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ConstructSrot.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CorrectorDipoles.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CorrectorDipoles.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CorrectorWinding.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CorrectorWinding.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CouplerWakeFieldProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CouplerWakeFieldProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CrabMarker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CrabMarker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/CrossSections.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/CrossSections.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/DataTable.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/DataTable.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/DataTableTFS.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/DataTableTFS.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/DetailedCollimationOutput.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/DetailedCollimationOutput.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/DiffractiveScatter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/DiffractiveScatter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Dispersion.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Dispersion.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Drift.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Drift.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/DynamicAperture.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/DynamicAperture.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/EMField.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/EMField.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ElasticScatter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ElasticScatter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ElectronBunch.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ElectronBunch.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ElementRepository.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ElementRepository.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/EquilibriumDistribution.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/EquilibriumDistribution.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/FlukaCollimationOutput.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/FlukaCollimationOutput.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/FrameModifier.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/FrameModifier.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/FrequencyMap.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/FrequencyMap.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Gamma.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Gamma.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/GeneralRotation.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/GeneralRotation.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/HaloParticleDistributionGenerator.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/HaloParticleDistributionGenerator.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Histogram.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Histogram.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/HollowELensProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/HollowELensProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/HollowElectronLens.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/HollowElectronLens.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/IdentityRotation.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/IdentityRotation.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/InterpolatedApertures.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/InterpolatedApertures.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Interpolation.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Interpolation.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Klystron.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Klystron.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LCAVintegrator.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LCAVintegrator.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LatticeFrame.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LatticeFrame.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LatticeFunctions.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LatticeFunctions.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LinearAlgebra.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LinearAlgebra.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LinearFBSystem.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LinearFBSystem.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LinearMapTracker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LinearMapTracker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LinearParticleMap.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LinearParticleMap.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LongRangeWakeProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LongRangeWakeProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/LossMapCollimationOutput.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/LossMapCollimationOutput.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MADInterface.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MADInterface.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MagnetMover.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MagnetMover.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Marker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Marker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Material.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Material.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MaterialDatabase.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MaterialDatabase.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MaterialMixture.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MaterialMixture.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MatrixMaps.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MatrixMaps.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MatrixPrinter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MatrixPrinter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MerlinIO.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MerlinIO.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MerlinProfile.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MerlinProfile.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MerlinVersion.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MerlinVersion.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ModelElement.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ModelElement.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Monitor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Monitor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MonitorProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MonitorProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MultipoleField.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MultipoleField.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/MuonBunch.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/MuonBunch.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/NANCheckProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/NANCheckProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/NormalTransform.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/NormalTransform.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/NumericalConstants.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/NumericalConstants.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/OPFormat.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/OPFormat.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/OrbitResponseMatrix.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/OrbitResponseMatrix.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PSvector.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PSvector.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PSvectorTransform3D.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PSvectorTransform3D.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunch.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunch.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchConstructor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchConstructor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchConverter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchConverter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchUtilities.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleBunchUtilities.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleDistributionGenerator.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleDistributionGenerator.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleMapComponent.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleMapComponent.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleMapPI.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleMapPI.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ParticleRecorder.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ParticleRecorder.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PhaseAdvance.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PhaseAdvance.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PhotonSpectrumGen.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PhotonSpectrumGen.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PhysicalConstants.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PhysicalConstants.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/PhysicalUnits.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/PhysicalUnits.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ProcessStepManager.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ProcessStepManager.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ProtonBunch.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ProtonBunch.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RFStructure.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RFStructure.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RMSProfileMonitor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RMSProfileMonitor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RMap.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RMap.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RTMap.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RTMap.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RWChannelState.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RWChannelState.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RandomNG.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RandomNG.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RectMultipole.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RectMultipole.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RectangularGeometry.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RectangularGeometry.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/RingDeltaTProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/RingDeltaTProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Rot3Drep.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Rot3Drep.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunch.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunch.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunchConstructor.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunchConstructor.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunchConverter.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPBunchConverter.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPComponentTracker.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPComponentTracker.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPSliceMap.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPSliceMap.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPStdIntegrators.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPStdIntegrators.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPTransform3D.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPTransform3D.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SMPWakeFieldProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SMPWakeFieldProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SWRFStructure.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SWRFStructure.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SWRFfield.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SWRFfield.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ScatterParticle.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ScatterParticle.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringModel.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringModel.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringModelsMerlin.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringModelsMerlin.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ScatteringProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/ScopeProfiler.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/ScopeProfiler.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SectorBend.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SectorBend.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SequenceFrame.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SequenceFrame.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SimpleATL.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SimpleATL.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SliceMacroParticle.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SliceMacroParticle.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Solenoid.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Solenoid.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SpinParticleProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SpinParticleProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/StableOrbits.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/StableOrbits.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/StandardMultipoles.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/StandardMultipoles.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/StdChannelDefs.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/StdChannelDefs.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/StdIntegrators.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/StdIntegrators.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/StringPattern.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/StringPattern.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SupportStructure.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SupportStructure.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SymplecticIntegrators.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SymplecticIntegrators.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/SynchRadParticleProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/SynchRadParticleProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TWRFStructure.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TWRFStructure.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TWRFfield.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TWRFfield.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TrackingOutputAV.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TrackingOutputAV.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TrackingSimulation.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TrackingSimulation.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransRFIntegrator.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransRFIntegrator.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransRFfield.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransRFfield.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransferMapTable.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransferMapTable.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransferMatrix.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransferMatrix.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Transform3D.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Transform3D.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/Transformable.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/Transformable.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransportIntegrators.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransportIntegrators.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransportMatrix.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransportMatrix.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransportRMaps.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransportRMaps.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/TransverseRFStructure.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/TransverseRFStructure.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/WakeFieldProcess.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/WakeFieldProcess.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/XTFFInterface.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/XTFFInterface.cpp.o.d"
+  "CMakeFiles/merlin.dir/Merlin/erfcc.cpp.o"
+  "CMakeFiles/merlin.dir/Merlin/erfcc.cpp.o.d"
+  "libmerlin.pdb"
+  "libmerlin.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merlin.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,42 @@
+#include <string>
+#include <cstdlib>
+
+#include "git_rev.h"
+
+std::string merlin_version()
+{
+	return "5.02";
+}
+
+int merlin_version_major()
+{
+	// defend against leading zeros being interpreted as octal
+	return strtol("5", NULL, 10);
+}
+
+int merlin_version_minor()
+{
+	return strtol("02", NULL, 10);
+}
+
+int merlin_version_patch()
+{
+	return strtol("0", NULL, 10);
+}
+
+std::string merlin_version_git()
+{
+	return GIT_REV;
+}
+
+std::string merlin_version_info()
+{
+	std::string info;
+	info += "MERLIN++ version: 5.02\n";
+
+	std::string git_tag = merlin_version_git();
+	if(git_tag.size()){
+		info += "MERLIN GIT tag: "+git_tag+"\n";
+	}
+	return info;
+}
@@ -0,0 +1 @@
+const std::string GIT_REV="ed3d4f2fed2531cd54d7862736264cf1c6a4bc5e+";
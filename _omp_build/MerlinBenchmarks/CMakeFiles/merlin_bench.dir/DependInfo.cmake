@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinBenchmarks/bench_runner.cpp" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/bench_runner.cpp.o" "gcc" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/bench_runner.cpp.o.d"
+  "/root/repo/MerlinBenchmarks/macro_benchmarks.cpp" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/macro_benchmarks.cpp.o" "gcc" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/macro_benchmarks.cpp.o.d"
+  "/root/repo/MerlinBenchmarks/merlin_bench.cpp" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/merlin_bench.cpp.o" "gcc" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/merlin_bench.cpp.o.d"
+  "/root/repo/MerlinBenchmarks/micro_benchmarks.cpp" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/micro_benchmarks.cpp.o" "gcc" "MerlinBenchmarks/CMakeFiles/merlin_bench.dir/micro_benchmarks.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/merlin_bench.dir/bench_runner.cpp.o"
+  "CMakeFiles/merlin_bench.dir/bench_runner.cpp.o.d"
+  "CMakeFiles/merlin_bench.dir/macro_benchmarks.cpp.o"
+  "CMakeFiles/merlin_bench.dir/macro_benchmarks.cpp.o.d"
+  "CMakeFiles/merlin_bench.dir/merlin_bench.cpp.o"
+  "CMakeFiles/merlin_bench.dir/merlin_bench.cpp.o.d"
+  "CMakeFiles/merlin_bench.dir/micro_benchmarks.cpp.o"
+  "CMakeFiles/merlin_bench.dir/micro_benchmarks.cpp.o.d"
+  "merlin_bench"
+  "merlin_bench.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/merlin_bench.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
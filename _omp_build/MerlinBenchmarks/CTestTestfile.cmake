@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/MerlinBenchmarks
+# Build directory: /root/repo/_omp_build/MerlinBenchmarks
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
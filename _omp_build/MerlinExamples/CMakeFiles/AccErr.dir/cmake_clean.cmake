@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "AcceleratorErrors/AccErr"
+  "AcceleratorErrors/AccErr.pdb"
+  "CMakeFiles/AccErr.dir/AcceleratorErrors/main.cpp.o"
+  "CMakeFiles/AccErr.dir/AcceleratorErrors/main.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/AccErr.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
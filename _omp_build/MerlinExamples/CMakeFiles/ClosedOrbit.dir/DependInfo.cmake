@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/ClosedOrbit/ClosedOrbit_Main.cpp" "MerlinExamples/CMakeFiles/ClosedOrbit.dir/ClosedOrbit/ClosedOrbit_Main.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ClosedOrbit.dir/ClosedOrbit/ClosedOrbit_Main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
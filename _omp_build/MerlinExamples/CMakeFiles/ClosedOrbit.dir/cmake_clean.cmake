@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ClosedOrbit.dir/ClosedOrbit/ClosedOrbit_Main.cpp.o"
+  "CMakeFiles/ClosedOrbit.dir/ClosedOrbit/ClosedOrbit_Main.cpp.o.d"
+  "ClosedOrbit/ClosedOrbit"
+  "ClosedOrbit/ClosedOrbit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ClosedOrbit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
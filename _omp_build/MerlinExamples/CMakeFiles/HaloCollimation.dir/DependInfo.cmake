@@ -0,0 +1,23 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/HaloCollimation/ConstructModel.cpp" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/ConstructModel.cpp.o" "gcc" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/ConstructModel.cpp.o.d"
+  "/root/repo/MerlinExamples/HaloCollimation/HaloCollimation_main.cpp" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloCollimation_main.cpp.o" "gcc" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloCollimation_main.cpp.o.d"
+  "/root/repo/MerlinExamples/HaloCollimation/HaloTracker.cpp" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloTracker.cpp.o" "gcc" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloTracker.cpp.o.d"
+  "/root/repo/MerlinExamples/HaloCollimation/QuadIntegrator.cpp" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/QuadIntegrator.cpp.o" "gcc" "MerlinExamples/CMakeFiles/HaloCollimation.dir/HaloCollimation/QuadIntegrator.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/ConstructModel.cpp.o"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/ConstructModel.cpp.o.d"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloCollimation_main.cpp.o"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloCollimation_main.cpp.o.d"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloTracker.cpp.o"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/HaloTracker.cpp.o.d"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/QuadIntegrator.cpp.o"
+  "CMakeFiles/HaloCollimation.dir/HaloCollimation/QuadIntegrator.cpp.o.d"
+  "HaloCollimation/HaloCollimation"
+  "HaloCollimation/HaloCollimation.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/HaloCollimation.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
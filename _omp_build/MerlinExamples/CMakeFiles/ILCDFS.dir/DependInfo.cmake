@@ -0,0 +1,38 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/ILCDFS/src/Accelerator.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/Accelerator.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/Accelerator.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/AcceleratorWithErrors.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/AcceleratorWithErrors.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/AcceleratorWithErrors.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ConstantGradientAdjustment.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstantGradientAdjustment.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstantGradientAdjustment.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ConstructSrot.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstructSrot.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstructSrot.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/DFSApp.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSApp.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSApp.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/DFSCorrection.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSCorrection.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSCorrection.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/DFSOutput.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSOutput.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSOutput.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/EnergyAdjustmentPolicy.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/EnergyAdjustmentPolicy.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/EnergyAdjustmentPolicy.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ILCDFS_IO.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_IO.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_IO.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ILCDFS_main.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_main.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_main.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/KSEnergyAdjustment.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/KSEnergyAdjustment.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/KSEnergyAdjustment.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ModelConstruction.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ModelConstruction.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ModelConstruction.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/OneToOneCorrection.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/OneToOneCorrection.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/OneToOneCorrection.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/OptimumDispersionMatch.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/OptimumDispersionMatch.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/OptimumDispersionMatch.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ParticleTrackingModel.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ParticleTrackingModel.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ParticleTrackingModel.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/ResponseMatrixGenerator.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ResponseMatrixGenerator.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/ResponseMatrixGenerator.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/SMPTrackingModel.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/SMPTrackingModel.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/SMPTrackingModel.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/TeslaWakePotential.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/TeslaWakePotential.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/TeslaWakePotential.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCDFS/src/XTFFInterface_1.cpp" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/XTFFInterface_1.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCDFS.dir/ILCDFS/src/XTFFInterface_1.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
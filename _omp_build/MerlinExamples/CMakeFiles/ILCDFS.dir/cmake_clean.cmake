@@ -0,0 +1,47 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/Accelerator.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/Accelerator.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/AcceleratorWithErrors.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/AcceleratorWithErrors.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstantGradientAdjustment.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstantGradientAdjustment.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstructSrot.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ConstructSrot.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSApp.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSApp.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSCorrection.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSCorrection.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSOutput.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/DFSOutput.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/EnergyAdjustmentPolicy.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/EnergyAdjustmentPolicy.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_IO.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_IO.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_main.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ILCDFS_main.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/KSEnergyAdjustment.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/KSEnergyAdjustment.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ModelConstruction.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ModelConstruction.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/OneToOneCorrection.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/OneToOneCorrection.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/OptimumDispersionMatch.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/OptimumDispersionMatch.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ParticleTrackingModel.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ParticleTrackingModel.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ResponseMatrixGenerator.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/ResponseMatrixGenerator.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/SMPTrackingModel.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/SMPTrackingModel.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/TeslaWakePotential.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/TeslaWakePotential.cpp.o.d"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/XTFFInterface_1.cpp.o"
+  "CMakeFiles/ILCDFS.dir/ILCDFS/src/XTFFInterface_1.cpp.o.d"
+  "ILCDFS/ILCDFS"
+  "ILCDFS/ILCDFS.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ILCDFS.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
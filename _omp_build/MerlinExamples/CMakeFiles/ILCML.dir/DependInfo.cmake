@@ -0,0 +1,24 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/ILCML/ILCML_main.cpp" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/ILCML_main.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/ILCML_main.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCML/QuadReferenceOutput.cpp" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/QuadReferenceOutput.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/QuadReferenceOutput.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCML/TeslaWakePotential.cpp" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/TeslaWakePotential.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/TeslaWakePotential.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCML/TrackingOutput.cpp" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/TrackingOutput.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/TrackingOutput.cpp.o.d"
+  "/root/repo/MerlinExamples/ILCML/model_construction.cpp" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/model_construction.cpp.o" "gcc" "MerlinExamples/CMakeFiles/ILCML.dir/ILCML/model_construction.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,19 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ILCML.dir/ILCML/ILCML_main.cpp.o"
+  "CMakeFiles/ILCML.dir/ILCML/ILCML_main.cpp.o.d"
+  "CMakeFiles/ILCML.dir/ILCML/QuadReferenceOutput.cpp.o"
+  "CMakeFiles/ILCML.dir/ILCML/QuadReferenceOutput.cpp.o.d"
+  "CMakeFiles/ILCML.dir/ILCML/TeslaWakePotential.cpp.o"
+  "CMakeFiles/ILCML.dir/ILCML/TeslaWakePotential.cpp.o.d"
+  "CMakeFiles/ILCML.dir/ILCML/TrackingOutput.cpp.o"
+  "CMakeFiles/ILCML.dir/ILCML/TrackingOutput.cpp.o.d"
+  "CMakeFiles/ILCML.dir/ILCML/model_construction.cpp.o"
+  "CMakeFiles/ILCML.dir/ILCML/model_construction.cpp.o.d"
+  "ILCML/ILCML"
+  "ILCML/ILCML.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ILCML.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/LatticeFunctions.dir/LatticeFunctions/LatticeFunctions_Main.cpp.o"
+  "CMakeFiles/LatticeFunctions.dir/LatticeFunctions/LatticeFunctions_Main.cpp.o.d"
+  "LatticeFunctions/LatticeFunctions"
+  "LatticeFunctions/LatticeFunctions.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/LatticeFunctions.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/SpinTracking.dir/SpinTracking/SpinTracking_Main.cpp.o"
+  "CMakeFiles/SpinTracking.dir/SpinTracking/SpinTracking_Main.cpp.o.d"
+  "SpinTracking/SpinTracking"
+  "SpinTracking/SpinTracking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/SpinTracking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/StrayFieldClosedOrbit/ConstantStrayFieldProcess.cpp" "MerlinExamples/CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/ConstantStrayFieldProcess.cpp.o" "gcc" "MerlinExamples/CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/ConstantStrayFieldProcess.cpp.o.d"
+  "/root/repo/MerlinExamples/StrayFieldClosedOrbit/StrayFieldClosedOrbit_Main.cpp" "MerlinExamples/CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/StrayFieldClosedOrbit_Main.cpp.o" "gcc" "MerlinExamples/CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/StrayFieldClosedOrbit_Main.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
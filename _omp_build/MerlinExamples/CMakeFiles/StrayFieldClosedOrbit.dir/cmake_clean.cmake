@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/ConstantStrayFieldProcess.cpp.o"
+  "CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/ConstantStrayFieldProcess.cpp.o.d"
+  "CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/StrayFieldClosedOrbit_Main.cpp.o"
+  "CMakeFiles/StrayFieldClosedOrbit.dir/StrayFieldClosedOrbit/StrayFieldClosedOrbit_Main.cpp.o.d"
+  "StrayFieldClosedOrbit/StrayFieldClosedOrbit"
+  "StrayFieldClosedOrbit/StrayFieldClosedOrbit.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/StrayFieldClosedOrbit.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Tracking.dir/Tracking/Tracking_Main.cpp.o"
+  "CMakeFiles/Tracking.dir/Tracking/Tracking_Main.cpp.o.d"
+  "Tracking/Tracking"
+  "Tracking/Tracking.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Tracking.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
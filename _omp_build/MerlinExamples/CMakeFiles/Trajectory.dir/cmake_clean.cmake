@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/Trajectory.dir/Trajectory/Trajectory_Main.cpp.o"
+  "CMakeFiles/Trajectory.dir/Trajectory/Trajectory_Main.cpp.o.d"
+  "Trajectory/Trajectory"
+  "Trajectory/Trajectory.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/Trajectory.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wakefile_ex1.dir/Wakefields/TeslaWakePotential.cpp.o"
+  "CMakeFiles/wakefile_ex1.dir/Wakefields/TeslaWakePotential.cpp.o.d"
+  "CMakeFiles/wakefile_ex1.dir/Wakefields/ex1.cpp.o"
+  "CMakeFiles/wakefile_ex1.dir/Wakefields/ex1.cpp.o.d"
+  "Wakefields/wakefile_ex1"
+  "Wakefields/wakefile_ex1.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wakefile_ex1.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinExamples/Wakefields/TeslaWakePotential.cpp" "MerlinExamples/CMakeFiles/wakefile_ex2.dir/Wakefields/TeslaWakePotential.cpp.o" "gcc" "MerlinExamples/CMakeFiles/wakefile_ex2.dir/Wakefields/TeslaWakePotential.cpp.o.d"
+  "/root/repo/MerlinExamples/Wakefields/ex2.cpp" "MerlinExamples/CMakeFiles/wakefile_ex2.dir/Wakefields/ex2.cpp.o" "gcc" "MerlinExamples/CMakeFiles/wakefile_ex2.dir/Wakefields/ex2.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wakefile_ex2.dir/Wakefields/TeslaWakePotential.cpp.o"
+  "CMakeFiles/wakefile_ex2.dir/Wakefields/TeslaWakePotential.cpp.o.d"
+  "CMakeFiles/wakefile_ex2.dir/Wakefields/ex2.cpp.o"
+  "CMakeFiles/wakefile_ex2.dir/Wakefields/ex2.cpp.o.d"
+  "Wakefields/wakefile_ex2"
+  "Wakefields/wakefile_ex2.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wakefile_ex2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
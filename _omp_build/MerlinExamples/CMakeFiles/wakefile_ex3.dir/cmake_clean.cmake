@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/wakefile_ex3.dir/Wakefields/TeslaWakePotential.cpp.o"
+  "CMakeFiles/wakefile_ex3.dir/Wakefields/TeslaWakePotential.cpp.o.d"
+  "CMakeFiles/wakefile_ex3.dir/Wakefields/ex3.cpp.o"
+  "CMakeFiles/wakefile_ex3.dir/Wakefields/ex3.cpp.o.d"
+  "Wakefields/wakefile_ex3"
+  "Wakefields/wakefile_ex3.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/wakefile_ex3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/aperture_test"
+  "BasicTests/aperture_test.pdb"
+  "CMakeFiles/aperture_test.dir/BasicTests/aperture_test.cpp.o"
+  "CMakeFiles/aperture_test.dir/BasicTests/aperture_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/aperture_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
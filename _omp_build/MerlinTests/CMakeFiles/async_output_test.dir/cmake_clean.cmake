@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/async_output_test"
+  "BasicTests/async_output_test.pdb"
+  "CMakeFiles/async_output_test.dir/BasicTests/async_output_test.cpp.o"
+  "CMakeFiles/async_output_test.dir/BasicTests/async_output_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/async_output_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/basic_hollow_electron_lens_test.dir/HollowElectronLens/basic_hollow_electron_lens_test.cpp.o"
+  "CMakeFiles/basic_hollow_electron_lens_test.dir/HollowElectronLens/basic_hollow_electron_lens_test.cpp.o.d"
+  "HollowElectronLens/basic_hollow_electron_lens_test"
+  "HollowElectronLens/basic_hollow_electron_lens_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/basic_hollow_electron_lens_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
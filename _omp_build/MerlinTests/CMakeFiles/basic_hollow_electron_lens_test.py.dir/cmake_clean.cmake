@@ -0,0 +1,5 @@
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/basic_hollow_electron_lens_test.py.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
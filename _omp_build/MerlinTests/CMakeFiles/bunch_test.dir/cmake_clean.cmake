@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/bunch_test"
+  "BasicTests/bunch_test.pdb"
+  "CMakeFiles/bunch_test.dir/BasicTests/bunch_test.cpp.o"
+  "CMakeFiles/bunch_test.dir/BasicTests/bunch_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bunch_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/bunch_train_test"
+  "BasicTests/bunch_train_test.pdb"
+  "CMakeFiles/bunch_train_test.dir/BasicTests/bunch_train_test.cpp.o"
+  "CMakeFiles/bunch_train_test.dir/BasicTests/bunch_train_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/bunch_train_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
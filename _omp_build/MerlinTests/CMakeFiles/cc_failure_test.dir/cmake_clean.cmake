@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/cc_failure_test"
+  "BasicTests/cc_failure_test.pdb"
+  "CMakeFiles/cc_failure_test.dir/BasicTests/cc_failure_test.cpp.o"
+  "CMakeFiles/cc_failure_test.dir/BasicTests/cc_failure_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cc_failure_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/collimate_particle_process_test"
+  "BasicTests/collimate_particle_process_test.pdb"
+  "CMakeFiles/collimate_particle_process_test.dir/BasicTests/collimate_particle_process_test.cpp.o"
+  "CMakeFiles/collimate_particle_process_test.dir/BasicTests/collimate_particle_process_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collimate_particle_process_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
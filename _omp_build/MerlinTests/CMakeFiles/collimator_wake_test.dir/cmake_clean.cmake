@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/collimator_wake_test"
+  "BasicTests/collimator_wake_test.pdb"
+  "CMakeFiles/collimator_wake_test.dir/BasicTests/collimator_wake_test.cpp.o"
+  "CMakeFiles/collimator_wake_test.dir/BasicTests/collimator_wake_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/collimator_wake_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
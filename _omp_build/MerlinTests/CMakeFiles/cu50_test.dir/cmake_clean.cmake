@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cu50_test.dir/ScatteringTests/cu50_test.cpp.o"
+  "CMakeFiles/cu50_test.dir/ScatteringTests/cu50_test.cpp.o.d"
+  "ScatteringTests/cu50_test"
+  "ScatteringTests/cu50_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/cu50_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
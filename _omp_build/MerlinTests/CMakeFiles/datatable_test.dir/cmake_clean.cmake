@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/datatable_test.dir/DataTable/datatable_test.cpp.o"
+  "CMakeFiles/datatable_test.dir/DataTable/datatable_test.cpp.o.d"
+  "DataTable/datatable_test"
+  "DataTable/datatable_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/datatable_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/datatable_tfs_test.dir/DataTable/datatable_tfs_test.cpp.o"
+  "CMakeFiles/datatable_tfs_test.dir/DataTable/datatable_tfs_test.cpp.o.d"
+  "DataTable/datatable_tfs_test"
+  "DataTable/datatable_tfs_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/datatable_tfs_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/MerlinTests/HollowElectronLens/diffusive_hollow_electron_lens_test.cpp" "MerlinTests/CMakeFiles/diffusive_hollow_electron_lens_test.dir/HollowElectronLens/diffusive_hollow_electron_lens_test.cpp.o" "gcc" "MerlinTests/CMakeFiles/diffusive_hollow_electron_lens_test.dir/HollowElectronLens/diffusive_hollow_electron_lens_test.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_omp_build/CMakeFiles/merlin.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/diffusive_hollow_electron_lens_test.dir/HollowElectronLens/diffusive_hollow_electron_lens_test.cpp.o"
+  "CMakeFiles/diffusive_hollow_electron_lens_test.dir/HollowElectronLens/diffusive_hollow_electron_lens_test.cpp.o.d"
+  "HollowElectronLens/diffusive_hollow_electron_lens_test"
+  "HollowElectronLens/diffusive_hollow_electron_lens_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/diffusive_hollow_electron_lens_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
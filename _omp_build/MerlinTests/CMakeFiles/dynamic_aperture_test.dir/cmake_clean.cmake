@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/dynamic_aperture_test"
+  "BasicTests/dynamic_aperture_test.pdb"
+  "CMakeFiles/dynamic_aperture_test.dir/BasicTests/dynamic_aperture_test.cpp.o"
+  "CMakeFiles/dynamic_aperture_test.dir/BasicTests/dynamic_aperture_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/dynamic_aperture_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
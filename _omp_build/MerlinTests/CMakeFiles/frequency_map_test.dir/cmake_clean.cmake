@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/frequency_map_test"
+  "BasicTests/frequency_map_test.pdb"
+  "CMakeFiles/frequency_map_test.dir/BasicTests/frequency_map_test.cpp.o"
+  "CMakeFiles/frequency_map_test.dir/BasicTests/frequency_map_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frequency_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
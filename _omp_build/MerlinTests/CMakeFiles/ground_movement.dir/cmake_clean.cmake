@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ground_movement.dir/OpticsTests/ground_movement.cpp.o"
+  "CMakeFiles/ground_movement.dir/OpticsTests/ground_movement.cpp.o.d"
+  "OpticsTests/ground_movement"
+  "OpticsTests/ground_movement.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ground_movement.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/hel_kick_table_test"
+  "BasicTests/hel_kick_table_test.pdb"
+  "CMakeFiles/hel_kick_table_test.dir/BasicTests/hel_kick_table_test.cpp.o"
+  "CMakeFiles/hel_kick_table_test.dir/BasicTests/hel_kick_table_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/hel_kick_table_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/lattice_derivative_test"
+  "BasicTests/lattice_derivative_test.pdb"
+  "CMakeFiles/lattice_derivative_test.dir/BasicTests/lattice_derivative_test.cpp.o"
+  "CMakeFiles/lattice_derivative_test.dir/BasicTests/lattice_derivative_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lattice_derivative_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
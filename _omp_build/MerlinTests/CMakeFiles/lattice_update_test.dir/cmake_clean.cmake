@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/lattice_update_test"
+  "BasicTests/lattice_update_test.pdb"
+  "CMakeFiles/lattice_update_test.dir/BasicTests/lattice_update_test.cpp.o"
+  "CMakeFiles/lattice_update_test.dir/BasicTests/lattice_update_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lattice_update_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lhc_collimation_test.dir/ScatteringTests/lhc_collimation_test.cpp.o"
+  "CMakeFiles/lhc_collimation_test.dir/ScatteringTests/lhc_collimation_test.cpp.o.d"
+  "ScatteringTests/lhc_collimation_test"
+  "ScatteringTests/lhc_collimation_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lhc_collimation_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
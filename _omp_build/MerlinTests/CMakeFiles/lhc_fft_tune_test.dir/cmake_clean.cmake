@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/lhc_fft_tune_test.dir/OpticsTests/lhc_fft_tune_test.cpp.o"
+  "CMakeFiles/lhc_fft_tune_test.dir/OpticsTests/lhc_fft_tune_test.cpp.o.d"
+  "OpticsTests/lhc_fft_tune_test"
+  "OpticsTests/lhc_fft_tune_test.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/lhc_fft_tune_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/linear_map_test"
+  "BasicTests/linear_map_test.pdb"
+  "CMakeFiles/linear_map_test.dir/BasicTests/linear_map_test.cpp.o"
+  "CMakeFiles/linear_map_test.dir/BasicTests/linear_map_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/linear_map_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
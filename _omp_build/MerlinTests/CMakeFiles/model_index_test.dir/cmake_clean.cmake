@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/model_index_test"
+  "BasicTests/model_index_test.pdb"
+  "CMakeFiles/model_index_test.dir/BasicTests/model_index_test.cpp.o"
+  "CMakeFiles/model_index_test.dir/BasicTests/model_index_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/model_index_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/model_snapshot_test"
+  "BasicTests/model_snapshot_test.pdb"
+  "CMakeFiles/model_snapshot_test.dir/BasicTests/model_snapshot_test.cpp.o"
+  "CMakeFiles/model_snapshot_test.dir/BasicTests/model_snapshot_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/model_snapshot_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
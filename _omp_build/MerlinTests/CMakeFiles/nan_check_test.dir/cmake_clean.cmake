@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/nan_check_test"
+  "BasicTests/nan_check_test.pdb"
+  "CMakeFiles/nan_check_test.dir/BasicTests/nan_check_test.cpp.o"
+  "CMakeFiles/nan_check_test.dir/BasicTests/nan_check_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/nan_check_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/orbit_response_test"
+  "BasicTests/orbit_response_test.pdb"
+  "CMakeFiles/orbit_response_test.dir/BasicTests/orbit_response_test.cpp.o"
+  "CMakeFiles/orbit_response_test.dir/BasicTests/orbit_response_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/orbit_response_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
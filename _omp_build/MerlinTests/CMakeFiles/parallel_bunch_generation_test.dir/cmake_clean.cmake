@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/parallel_bunch_generation_test"
+  "BasicTests/parallel_bunch_generation_test.pdb"
+  "CMakeFiles/parallel_bunch_generation_test.dir/BasicTests/parallel_bunch_generation_test.cpp.o"
+  "CMakeFiles/parallel_bunch_generation_test.dir/BasicTests/parallel_bunch_generation_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/parallel_bunch_generation_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
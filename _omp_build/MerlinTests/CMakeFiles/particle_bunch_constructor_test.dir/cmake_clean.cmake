@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/particle_bunch_constructor_test"
+  "BasicTests/particle_bunch_constructor_test.pdb"
+  "CMakeFiles/particle_bunch_constructor_test.dir/BasicTests/particle_bunch_constructor_test.cpp.o"
+  "CMakeFiles/particle_bunch_constructor_test.dir/BasicTests/particle_bunch_constructor_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/particle_bunch_constructor_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/particle_recorder_test"
+  "BasicTests/particle_recorder_test.pdb"
+  "CMakeFiles/particle_recorder_test.dir/BasicTests/particle_recorder_test.cpp.o"
+  "CMakeFiles/particle_recorder_test.dir/BasicTests/particle_recorder_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/particle_recorder_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/random_test"
+  "BasicTests/random_test.pdb"
+  "CMakeFiles/random_test.dir/BasicTests/random_test.cpp.o"
+  "CMakeFiles/random_test.dir/BasicTests/random_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/random_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
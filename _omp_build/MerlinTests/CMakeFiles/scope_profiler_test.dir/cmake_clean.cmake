@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/scope_profiler_test"
+  "BasicTests/scope_profiler_test.pdb"
+  "CMakeFiles/scope_profiler_test.dir/BasicTests/scope_profiler_test.cpp.o"
+  "CMakeFiles/scope_profiler_test.dir/BasicTests/scope_profiler_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/scope_profiler_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/smp_transport_test"
+  "BasicTests/smp_transport_test.pdb"
+  "CMakeFiles/smp_transport_test.dir/BasicTests/smp_transport_test.cpp.o"
+  "CMakeFiles/smp_transport_test.dir/BasicTests/smp_transport_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/smp_transport_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/spin_tracking_test"
+  "BasicTests/spin_tracking_test.pdb"
+  "CMakeFiles/spin_tracking_test.dir/BasicTests/spin_tracking_test.cpp.o"
+  "CMakeFiles/spin_tracking_test.dir/BasicTests/spin_tracking_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/spin_tracking_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
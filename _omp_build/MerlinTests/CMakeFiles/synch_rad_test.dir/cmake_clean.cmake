@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/synch_rad_test"
+  "BasicTests/synch_rad_test.pdb"
+  "CMakeFiles/synch_rad_test.dir/BasicTests/synch_rad_test.cpp.o"
+  "CMakeFiles/synch_rad_test.dir/BasicTests/synch_rad_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/synch_rad_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
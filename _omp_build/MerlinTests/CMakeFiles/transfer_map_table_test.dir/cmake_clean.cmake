@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "BasicTests/transfer_map_table_test"
+  "BasicTests/transfer_map_table_test.pdb"
+  "CMakeFiles/transfer_map_table_test.dir/BasicTests/transfer_map_table_test.cpp.o"
+  "CMakeFiles/transfer_map_table_test.dir/BasicTests/transfer_map_table_test.cpp.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transfer_map_table_test.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
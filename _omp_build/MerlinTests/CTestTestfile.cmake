@@ -0,0 +1,82 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/MerlinTests
+# Build directory: /root/repo/_omp_build/MerlinTests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(have_python "BasicTests/have_python.py")
+set_tests_properties(have_python PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;44;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(bunch_test "BasicTests/bunch_test")
+set_tests_properties(bunch_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;47;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(bunch_io_test "BasicTests/bunch_io_test")
+set_tests_properties(bunch_io_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;50;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(aperture_test "BasicTests/aperture_test")
+set_tests_properties(aperture_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;53;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(collimate_particle_process_test "BasicTests/collimate_particle_process_test")
+set_tests_properties(collimate_particle_process_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;56;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(particle_bunch_constructor_test "BasicTests/particle_bunch_constructor_test")
+set_tests_properties(particle_bunch_constructor_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;59;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(parallel_bunch_generation_test "BasicTests/parallel_bunch_generation_test")
+set_tests_properties(parallel_bunch_generation_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;62;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(scope_profiler_test "BasicTests/scope_profiler_test")
+set_tests_properties(scope_profiler_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;65;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(model_index_test "BasicTests/model_index_test")
+set_tests_properties(model_index_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;68;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(model_snapshot_test "BasicTests/model_snapshot_test")
+set_tests_properties(model_snapshot_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;71;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(linear_map_test "BasicTests/linear_map_test")
+set_tests_properties(linear_map_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;73;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(transfer_map_table_test "BasicTests/transfer_map_table_test")
+set_tests_properties(transfer_map_table_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;75;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(lattice_update_test "BasicTests/lattice_update_test")
+set_tests_properties(lattice_update_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;77;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(frequency_map_test "BasicTests/frequency_map_test")
+set_tests_properties(frequency_map_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;79;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(dynamic_aperture_test "BasicTests/dynamic_aperture_test")
+set_tests_properties(dynamic_aperture_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;81;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(orbit_response_test "BasicTests/orbit_response_test")
+set_tests_properties(orbit_response_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;83;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(lattice_derivative_test "BasicTests/lattice_derivative_test")
+set_tests_properties(lattice_derivative_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;85;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(nan_check_test "BasicTests/nan_check_test")
+set_tests_properties(nan_check_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;87;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(hel_kick_table_test "BasicTests/hel_kick_table_test")
+set_tests_properties(hel_kick_table_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;89;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(synch_rad_test "BasicTests/synch_rad_test")
+set_tests_properties(synch_rad_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;91;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(spin_tracking_test "BasicTests/spin_tracking_test")
+set_tests_properties(spin_tracking_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;93;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(cc_failure_test "BasicTests/cc_failure_test")
+set_tests_properties(cc_failure_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;95;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(async_output_test "BasicTests/async_output_test")
+set_tests_properties(async_output_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;97;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(particle_recorder_test "BasicTests/particle_recorder_test")
+set_tests_properties(particle_recorder_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;99;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(smp_transport_test "BasicTests/smp_transport_test")
+set_tests_properties(smp_transport_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;101;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(collimator_wake_test "BasicTests/collimator_wake_test")
+set_tests_properties(collimator_wake_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;103;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(bunch_train_test "BasicTests/bunch_train_test")
+set_tests_properties(bunch_train_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;105;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(random_test.py "BasicTests/random_test.py")
+set_tests_properties(random_test.py PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;109;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(lhc_optics_test "OpticsTests/lhc_optics_test")
+set_tests_properties(lhc_optics_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;112;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(lhc_fft_tune_test "OpticsTests/lhc_fft_tune_test")
+set_tests_properties(lhc_fft_tune_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;115;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(ground_movement "OpticsTests/ground_movement")
+set_tests_properties(ground_movement PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;118;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(cu50_test.py_1e7 "ScatteringTests/cu50_test.py" "0" "10000000")
+set_tests_properties(cu50_test.py_1e7 PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;122;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(cu50_test.py_1e7_sixtrack "ScatteringTests/cu50_test.py" "0" "10000000" "sixtrack")
+set_tests_properties(cu50_test.py_1e7_sixtrack PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;123;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(lhc_collimation_test.py_1e4 "ScatteringTests/lhc_collimation_test.py" "0" "10000")
+set_tests_properties(lhc_collimation_test.py_1e4 PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;129;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(basic_hollow_electron_lens_test.py "HollowElectronLens/basic_hollow_electron_lens_test.py")
+set_tests_properties(basic_hollow_electron_lens_test.py PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;134;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(diffusive_hollow_electron_lens_test "HollowElectronLens/diffusive_hollow_electron_lens_test")
+set_tests_properties(diffusive_hollow_electron_lens_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;137;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(datatable_test "DataTable/datatable_test")
+set_tests_properties(datatable_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;140;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")
+add_test(datatable_tfs_test "DataTable/datatable_tfs_test")
+set_tests_properties(datatable_tfs_test PROPERTIES  TIMEOUT "7200" _BACKTRACE_TRIPLES "/root/repo/MerlinTests/CMakeLists.txt;32;add_test;/root/repo/MerlinTests/CMakeLists.txt;143;add_test_t;/root/repo/MerlinTests/CMakeLists.txt;0;")